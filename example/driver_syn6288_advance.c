@@ -59,6 +59,8 @@ uint8_t syn6288_advance_init(void)
     DRIVER_SYN6288_LINK_UART_FLUSH(&gs_handle, syn6288_interface_uart_flush);
     DRIVER_SYN6288_LINK_DELAY_MS(&gs_handle, syn6288_interface_delay_ms);
     DRIVER_SYN6288_LINK_DEBUG_PRINT(&gs_handle, syn6288_interface_debug_print);
+    DRIVER_SYN6288_LINK_TIMESTAMP_MS(&gs_handle, syn6288_interface_timestamp_ms);
+    DRIVER_SYN6288_LINK_EVENT(&gs_handle, syn6288_interface_event);
     
     /* syn6288 init */
     res = syn6288_init(&gs_handle);
@@ -288,6 +290,44 @@ uint8_t syn6288_advance_ring(syn6288_ring_t ring)
     }
 }
 
+/**
+ * @brief     advance example play a sequence of prompt tones and text
+ * @param[in] *item pointer to a sequence item buffer
+ * @param[in] len item buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 play sequence failed
+ * @note      none
+ */
+uint8_t syn6288_advance_sequence(syn6288_sequence_item_t *item, uint8_t len)
+{
+    uint8_t res;
+    syn6288_status_t status;
+
+    /* get status */
+    res = syn6288_get_status(&gs_handle, &status);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    /* check status */
+    if (status == SYN6288_STATUS_BUSY)
+    {
+        return 1;
+    }
+    
+    /* synthesis sequence */
+    if (syn6288_synthesis_sequence(&gs_handle, item, len) != 0)
+    {
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
 /**
  * @brief  advance example pause
  * @return status code
@@ -124,6 +124,17 @@ uint8_t syn6288_advance_message(syn6288_message_t message);
  */
 uint8_t syn6288_advance_ring(syn6288_ring_t ring);
 
+/**
+ * @brief     advance example play a sequence of prompt tones and text
+ * @param[in] *item pointer to a sequence item buffer
+ * @param[in] len item buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 play sequence failed
+ * @note      none
+ */
+uint8_t syn6288_advance_sequence(syn6288_sequence_item_t *item, uint8_t len);
+
 /**
  * @brief  advance example sync
  * @return status code
@@ -59,6 +59,8 @@ uint8_t syn6288_basic_init(void)
     DRIVER_SYN6288_LINK_UART_FLUSH(&gs_handle, syn6288_interface_uart_flush);
     DRIVER_SYN6288_LINK_DELAY_MS(&gs_handle, syn6288_interface_delay_ms);
     DRIVER_SYN6288_LINK_DEBUG_PRINT(&gs_handle, syn6288_interface_debug_print);
+    DRIVER_SYN6288_LINK_TIMESTAMP_MS(&gs_handle, syn6288_interface_timestamp_ms);
+    DRIVER_SYN6288_LINK_EVENT(&gs_handle, syn6288_interface_event);
     
     /* syn6288 init */
     res = syn6288_init(&gs_handle);
@@ -0,0 +1,1098 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_syn6288_service.c
+ * @brief     driver syn6288 service source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_syn6288_service.h"
+#include "driver_syn6288_queue.h"
+
+/**
+ * @brief syn6288 service in-flight segment number definition
+ */
+#define SYN6288_SERVICE_FLIGHT (SYN6288_QUEUE_MAX_ITEM * 2)        /**< twice the queue */
+
+/**
+ * @brief syn6288 service request slot structure definition
+ */
+typedef struct syn6288_service_slot_s
+{
+    uint32_t id;                                 /**< request id */
+    uint32_t client;                             /**< client id */
+    uint32_t tag;                                /**< client tag */
+    uint32_t seq;                                /**< submit order */
+    uint32_t cost;                               /**< estimated speaking time in ms */
+    uint32_t submit;                             /**< submit timestamp in ms */
+    uint32_t start;                              /**< start timestamp in ms */
+    uint32_t deadline;                           /**< latest start timestamp in ms */
+    uint8_t deadline_valid;                      /**< deadline flag */
+    uint8_t used;                                /**< used flag */
+    uint8_t started;                             /**< started flag */
+    uint8_t dropped;                             /**< dropped flag */
+    uint8_t priority;                            /**< queue priority */
+    uint8_t type;                                /**< text type */
+    uint8_t mode;                                /**< background mode */
+    uint8_t volume;                              /**< synthesis volume */
+    uint8_t background_volume;                   /**< background volume */
+    uint8_t speed;                               /**< synthesis speed */
+    uint8_t flight;                              /**< segments in the queue */
+    uint8_t producer;                            /**< producer slot */
+    uint16_t len;                                /**< text length */
+    uint16_t pos;                                /**< start of the next segment */
+    uint8_t *text;                               /**< point to the text, the buffer or the caller memory */
+    uint8_t buf[SYN6288_SERVICE_MAX_TEXT];       /**< text buffer */
+} syn6288_service_slot_t;
+
+/**
+ * @brief syn6288 service in-flight segment structure definition
+ */
+typedef struct syn6288_service_flight_s
+{
+    uint32_t id;              /**< queue item id */
+    uint8_t slot;             /**< request slot */
+} syn6288_service_flight_t;
+
+/**
+ * @brief syn6288 service producer structure definition
+ */
+typedef struct syn6288_service_producer_s
+{
+    uint32_t id;              /**< producer id */
+    uint8_t used;             /**< used flag */
+    uint8_t weight;           /**< producer weight */
+    int32_t deficit;          /**< unspent speaking time of the round in ms, negative after a deadline jump */
+    uint32_t pending;         /**< requests waiting or playing */
+    uint32_t submitted;       /**< accepted requests */
+    uint32_t done;            /**< played requests */
+    uint32_t dropped;         /**< dropped requests */
+    uint32_t time;            /**< estimated speaking time of the played requests in ms */
+    uint32_t wait_sum;        /**< wait sum in ms */
+    uint32_t wait_num;        /**< wait number */
+    uint32_t wait_max;        /**< max wait in ms */
+} syn6288_service_producer_t;
+
+static syn6288_handle_t gs_handle;                                                  /**< syn6288 handle */
+static syn6288_queue_t gs_queue;                                                    /**< syn6288 queue */
+static void (*gs_callback)(syn6288_service_event_t *event);                         /**< event callback */
+static uint32_t gs_id;                                                              /**< next request id */
+static uint32_t gs_seq;                                                             /**< next submit order */
+static uint32_t gs_wait_sum;                                                        /**< wait sum in ms */
+static uint32_t gs_wait_num;                                                        /**< wait number */
+static syn6288_service_stats_t gs_stats;                                            /**< service stats */
+static syn6288_service_flight_t gs_flight[SYN6288_SERVICE_FLIGHT];                  /**< in-flight segments */
+static syn6288_service_slot_t gs_slot[SYN6288_SERVICE_MAX_REQUEST];                 /**< request slots */
+static syn6288_service_producer_t gs_producer[SYN6288_SERVICE_MAX_PRODUCER];        /**< producers */
+static uint8_t gs_round;                                                            /**< producer of the round */
+static uint8_t gs_turn;                                                             /**< 1 if the producer of the round got its quantum */
+static uint32_t gs_time;                                                            /**< estimated speaking time of the played requests in ms */
+
+/**
+ * @brief     report an event of a request
+ * @param[in] *s pointer to a request slot
+ * @param[in] type event type
+ * @param[in] now current timestamp in ms
+ * @note      none
+ */
+static void a_service_report(syn6288_service_slot_t *s, syn6288_service_event_type_t type, uint32_t now)
+{
+    syn6288_service_event_t event;
+    
+    event.id = s->id;
+    event.client = s->client;
+    event.tag = s->tag;
+    event.type = (uint8_t)type;
+    event.wait = (s->started != 0) ? (s->start - s->submit) : (now - s->submit);
+    event.time = now - s->submit;
+    if (gs_callback != NULL)
+    {
+        gs_callback(&event);
+    }
+}
+
+/**
+ * @brief     free a request slot
+ * @param[in] *s pointer to a request slot
+ * @note      none
+ */
+static void a_service_free(syn6288_service_slot_t *s)
+{
+    s->used = 0;
+    gs_stats.pending--;
+    gs_producer[s->producer].pending--;
+}
+
+/**
+ * @brief     find an in-flight segment
+ * @param[in] id queue item id, 0 finds a free entry
+ * @return    flight entry or SYN6288_SERVICE_FLIGHT if none
+ * @note      the ids are the ones returned by syn6288_queue_push
+ */
+static uint8_t a_service_flight(uint32_t id)
+{
+    uint8_t i;
+    
+    for (i = 0; i < SYN6288_SERVICE_FLIGHT; i++)
+    {
+        if (gs_flight[i].id == id)
+        {
+            return i;
+        }
+    }
+    
+    return SYN6288_SERVICE_FLIGHT;
+}
+
+/**
+ * @brief     service receive callback
+ * @param[in] type event type
+ * @param[in] id item id
+ * @note      a request is started by its first segment and done after its last segment
+ */
+static void a_service_receive_callback(uint8_t type, uint32_t id)
+{
+    uint8_t i;
+    uint32_t now;
+    syn6288_service_slot_t *s;
+    syn6288_service_flight_t *f;
+    syn6288_service_producer_t *p;
+    
+    i = a_service_flight(id);
+    if ((id == 0) || (i == SYN6288_SERVICE_FLIGHT))
+    {
+        return;
+    }
+    f = &gs_flight[i];
+    s = &gs_slot[f->slot];
+    now = syn6288_interface_timestamp_ms();
+    switch (type)
+    {
+        case SYN6288_QUEUE_EVENT_START :
+        {
+            if ((s->started == 0) && (s->dropped == 0))
+            {
+                s->started = 1;
+                s->start = now;
+                gs_wait_sum += now - s->submit;
+                gs_wait_num++;
+                if ((now - s->submit) > gs_stats.wait_max)
+                {
+                    gs_stats.wait_max = now - s->submit;
+                }
+                p = &gs_producer[s->producer];
+                p->wait_sum += now - s->submit;
+                p->wait_num++;
+                if ((now - s->submit) > p->wait_max)
+                {
+                    p->wait_max = now - s->submit;
+                }
+                a_service_report(s, SYN6288_SERVICE_EVENT_START, now);
+            }
+            
+            return;
+        }
+        case SYN6288_QUEUE_EVENT_PREEMPT :
+        {
+            if (s->dropped == 0)
+            {
+                gs_stats.preempted++;
+                a_service_report(s, SYN6288_SERVICE_EVENT_PREEMPT, now);
+            }
+            
+            return;
+        }
+        case SYN6288_QUEUE_EVENT_DONE :
+        {
+            f->id = 0;
+            s->flight--;
+            if ((s->flight == 0) && (s->pos == s->len) && (s->dropped == 0))
+            {
+                gs_stats.done++;
+                gs_producer[s->producer].done++;
+                gs_producer[s->producer].time += s->cost;
+                gs_time += s->cost;
+                a_service_report(s, SYN6288_SERVICE_EVENT_DONE, now);
+            }
+            if ((s->flight == 0) && ((s->pos == s->len) || (s->dropped != 0)))
+            {
+                a_service_free(s);
+            }
+            
+            return;
+        }
+        case SYN6288_QUEUE_EVENT_DROP :
+        {
+            f->id = 0;
+            s->flight--;
+            if (s->dropped == 0)
+            {
+                s->dropped = 1;
+                gs_stats.dropped++;
+                gs_producer[s->producer].dropped++;
+                a_service_report(s, SYN6288_SERVICE_EVENT_DROP, now);
+            }
+            if (s->flight == 0)
+            {
+                a_service_free(s);
+            }
+            
+            return;
+        }
+        default :
+        {
+            return;
+        }
+    }
+}
+
+/**
+ * @brief     check a cut point after a char
+ * @param[in] type text type
+ * @param[in] c char code
+ * @return    1 if a segment can end after the char, else 0
+ * @note      spaces, ascii punctuation and full width commas and sentence ends are cut points
+ */
+static uint8_t a_service_is_cut(uint8_t type, uint16_t c)
+{
+    if ((c == ' ') || (c == ',') || (c == '.') || (c == ';') || (c == '!') || (c == '?') || (c == '\n'))
+    {
+        return 1;
+    }
+    if (type == SYN6288_TYPE_UNICODE)
+    {
+        return ((c == 0xFF0C) || (c == 0x3001) || (c == 0x3002) ||
+                (c == 0xFF1B) || (c == 0xFF01) || (c == 0xFF1F)) ? 1 : 0;
+    }
+    else if (type == SYN6288_TYPE_BIG5)
+    {
+        return ((c >= 0xA141) && (c <= 0xA149)) ? 1 : 0;
+    }
+    else
+    {
+        return ((c == 0xA3AC) || (c == 0xA1A2) || (c == 0xA1A3) ||
+                (c == 0xA3BB) || (c == 0xA3A1) || (c == 0xA3BF)) ? 1 : 0;
+    }
+}
+
+/**
+ * @brief     get the length of the next segment of a request
+ * @param[in] *s pointer to a request slot
+ * @return    segment length
+ * @note      a long text is cut after the last punctuation or space that fits,
+ *            else on the last char boundary that fits
+ */
+static uint16_t a_service_cut(syn6288_service_slot_t *s)
+{
+    uint16_t i;
+    uint16_t w;
+    uint16_t c;
+    uint16_t cut;
+    uint16_t boundary;
+    
+    if ((s->len - s->pos) <= SYN6288_SERVICE_MAX_SEGMENT)
+    {
+        return (uint16_t)(s->len - s->pos);
+    }
+    cut = 0;
+    boundary = 0;
+    i = s->pos;
+    while (i < s->len)
+    {
+        if (s->type == SYN6288_TYPE_UNICODE)
+        {
+            w = 2;
+        }
+        else
+        {
+            w = (s->text[i] >= 0x80) ? 2 : 1;
+        }
+        if ((i + w - s->pos) > SYN6288_SERVICE_MAX_SEGMENT)
+        {
+            break;
+        }
+        c = (w == 2) ? (uint16_t)(((uint16_t)s->text[i] << 8) | s->text[i + 1]) : s->text[i];
+        i = (uint16_t)(i + w);
+        boundary = (uint16_t)(i - s->pos);
+        if (a_service_is_cut(s->type, c) != 0)
+        {
+            cut = boundary;
+        }
+    }
+    
+    return (cut != 0) ? cut : boundary;
+}
+
+/**
+ * @brief      get the top priority of the waiting requests
+ * @param[out] *priority pointer to a priority buffer
+ * @return     1 if a request has a segment to play, else 0
+ * @note       none
+ */
+static uint8_t a_service_top(uint8_t *priority)
+{
+    uint8_t i;
+    uint8_t found;
+    syn6288_service_slot_t *s;
+    
+    found = 0;
+    *priority = 0;
+    for (i = 0; i < SYN6288_SERVICE_MAX_REQUEST; i++)
+    {
+        s = &gs_slot[i];
+        if ((s->used == 0) || (s->dropped != 0) || (s->pos == s->len))
+        {
+            continue;
+        }
+        if ((found == 0) || (s->priority > *priority))
+        {
+            *priority = s->priority;
+            found = 1;
+        }
+    }
+    
+    return found;
+}
+
+/**
+ * @brief     get the next request of a producer
+ * @param[in] producer producer slot
+ * @param[in] priority request priority
+ * @return    request slot or SYN6288_SERVICE_MAX_REQUEST if none
+ * @note      only the requests not started yet are taken, the earlier deadline goes first and then the earlier submit
+ */
+static uint8_t a_service_head(uint8_t producer, uint8_t priority)
+{
+    uint8_t i;
+    uint8_t best;
+    syn6288_service_slot_t *s;
+    syn6288_service_slot_t *b;
+    
+    best = SYN6288_SERVICE_MAX_REQUEST;
+    for (i = 0; i < SYN6288_SERVICE_MAX_REQUEST; i++)
+    {
+        s = &gs_slot[i];
+        if ((s->used == 0) || (s->dropped != 0) || (s->pos != 0) ||
+            (s->producer != producer) || (s->priority != priority))
+        {
+            continue;
+        }
+        if (best == SYN6288_SERVICE_MAX_REQUEST)
+        {
+            best = i;
+            
+            continue;
+        }
+        b = &gs_slot[best];
+        if (s->deadline_valid != b->deadline_valid)
+        {
+            if (s->deadline_valid != 0)
+            {
+                best = i;
+            }
+            
+            continue;
+        }
+        if ((s->deadline_valid != 0) && (s->deadline != b->deadline))
+        {
+            if ((int32_t)(s->deadline - b->deadline) < 0)
+            {
+                best = i;
+            }
+            
+            continue;
+        }
+        if ((int32_t)(s->seq - b->seq) < 0)
+        {
+            best = i;
+        }
+    }
+    
+    return best;
+}
+
+/**
+ * @brief     pick the next request by deficit round robin
+ * @param[in] priority request priority
+ * @return    request slot or SYN6288_SERVICE_MAX_REQUEST if none
+ * @note      each visit gives the producer its weight times the quantum, a request is started
+ *            when the estimated speaking time fits the deficit, an idle producer loses its unspent time
+ */
+static uint8_t a_service_round(uint8_t priority)
+{
+    uint8_t i;
+    uint8_t idle;
+    syn6288_service_producer_t *p;
+    
+    idle = 0;
+    while (idle < SYN6288_SERVICE_MAX_PRODUCER)
+    {
+        p = &gs_producer[gs_round];
+        i = (p->used != 0) ? a_service_head(gs_round, priority) : SYN6288_SERVICE_MAX_REQUEST;
+        if (i == SYN6288_SERVICE_MAX_REQUEST)
+        {
+            if (p->deficit > 0)
+            {
+                p->deficit = 0;
+            }
+            idle++;
+        }
+        else
+        {
+            idle = 0;
+            if (gs_turn == 0)
+            {
+                p->deficit += (int32_t)(p->weight * SYN6288_SERVICE_QUANTUM_MS);
+                gs_turn = 1;
+            }
+            if ((int32_t)gs_slot[i].cost <= p->deficit)
+            {
+                p->deficit -= (int32_t)gs_slot[i].cost;
+                
+                return i;
+            }
+        }
+        gs_round = (uint8_t)((gs_round + 1) % SYN6288_SERVICE_MAX_PRODUCER);
+        gs_turn = 0;
+    }
+    
+    return SYN6288_SERVICE_MAX_REQUEST;
+}
+
+/**
+ * @brief     pick the next request to play
+ * @param[in] priority top priority
+ * @return    request slot or SYN6288_SERVICE_MAX_REQUEST if none
+ * @note      only the top priority is played, the request already playing is finished first,
+ *            then a deadline request of a producer not in debt and then the producers share the speaking time by weight
+ */
+static uint8_t a_service_pick(uint8_t priority)
+{
+    uint8_t i;
+    uint8_t best;
+    syn6288_service_slot_t *s;
+    
+    /* a started request is paid, finish it so that the messages are never interleaved */
+    best = SYN6288_SERVICE_MAX_REQUEST;
+    for (i = 0; i < SYN6288_SERVICE_MAX_REQUEST; i++)
+    {
+        s = &gs_slot[i];
+        if ((s->used == 0) || (s->dropped != 0) || (s->pos == 0) || (s->pos == s->len) || (s->priority != priority))
+        {
+            continue;
+        }
+        if ((best == SYN6288_SERVICE_MAX_REQUEST) || ((int32_t)(s->seq - gs_slot[best].seq) < 0))
+        {
+            best = i;
+        }
+    }
+    if (best != SYN6288_SERVICE_MAX_REQUEST)
+    {
+        return best;
+    }
+    
+    /* then a deadline jumps the round and is paid back from the next quantums */
+    for (i = 0; i < SYN6288_SERVICE_MAX_REQUEST; i++)
+    {
+        s = &gs_slot[i];
+        if ((s->used == 0) || (s->dropped != 0) || (s->pos != 0) || (s->priority != priority) ||
+            (s->deadline_valid == 0) || (gs_producer[s->producer].deficit < 0))
+        {
+            continue;
+        }
+        if ((best == SYN6288_SERVICE_MAX_REQUEST) || ((int32_t)(s->deadline - gs_slot[best].deadline) < 0))
+        {
+            best = i;
+        }
+    }
+    if (best != SYN6288_SERVICE_MAX_REQUEST)
+    {
+        gs_producer[gs_slot[best].producer].deficit -= (int32_t)gs_slot[best].cost;
+        
+        return best;
+    }
+    
+    return a_service_round(priority);
+}
+
+/**
+ * @brief     drop the waiting requests past their deadline
+ * @param[in] now current timestamp in ms
+ * @note      a request is only dropped before its first segment is handed to the queue
+ */
+static void a_service_expire(uint32_t now)
+{
+    uint8_t i;
+    syn6288_service_slot_t *s;
+    
+    for (i = 0; i < SYN6288_SERVICE_MAX_REQUEST; i++)
+    {
+        s = &gs_slot[i];
+        if ((s->used != 0) && (s->pos == 0) && (s->deadline_valid != 0) &&
+            ((int32_t)(now - s->deadline) >= 0))
+        {
+            s->dropped = 1;
+            gs_stats.dropped++;
+            gs_producer[s->producer].dropped++;
+            a_service_report(s, SYN6288_SERVICE_EVENT_DROP, now);
+            a_service_free(s);
+        }
+    }
+}
+
+/**
+ * @brief  hand the next segments to the queue
+ * @return status code
+ *         - 0 success
+ *         - 1 push failed
+ * @note   emergency requests are pushed past the queue depth so the queue can preempt the playing frame
+ */
+static uint8_t a_service_feed(void)
+{
+    uint8_t i;
+    uint8_t j;
+    uint8_t count;
+    uint8_t priority;
+    uint16_t len;
+    uint32_t id;
+    uint32_t now;
+    syn6288_service_slot_t *s;
+    syn6288_service_flight_t *f;
+    
+    a_service_expire(syn6288_interface_timestamp_ms());
+    while (1)
+    {
+        if (syn6288_queue_get_count(&gs_queue, &count) != 0)
+        {
+            return 1;
+        }
+        if ((a_service_top(&priority) == 0) || (count >= SYN6288_QUEUE_MAX_ITEM))
+        {
+            return 0;
+        }
+        if ((count >= SYN6288_SERVICE_QUEUE_DEPTH) && (priority != SYN6288_QUEUE_PRIORITY_EMERGENCY))
+        {
+            return 0;
+        }
+        j = a_service_flight(0);
+        if (j == SYN6288_SERVICE_FLIGHT)
+        {
+            return 0;
+        }
+        
+        /* the pick charges the producer, so it's done only when a segment is pushed */
+        i = a_service_pick(priority);
+        if (i == SYN6288_SERVICE_MAX_REQUEST)
+        {
+            return 0;
+        }
+        s = &gs_slot[i];
+        now = syn6288_interface_timestamp_ms();
+        
+        /* the queue keeps the item settings and sends them inline, the playing text is not cut */
+        (void)syn6288_set_text_type(&gs_handle, (syn6288_type_t)s->type);
+        (void)syn6288_set_mode(&gs_handle, (syn6288_mode_t)s->mode);
+        (void)syn6288_queue_set_synthesis_volume(&gs_queue, s->volume);
+        (void)syn6288_queue_set_background_volume(&gs_queue, s->background_volume);
+        (void)syn6288_queue_set_synthesis_speed(&gs_queue, s->speed);
+        (void)syn6288_queue_set_priority(&gs_queue, (syn6288_queue_priority_t)s->priority);
+        if ((s->pos == 0) && (s->deadline_valid != 0))
+        {
+            (void)syn6288_queue_set_deadline(&gs_queue, ((int32_t)(s->deadline - now) > 0) ? (s->deadline - now) : 1);
+        }
+        else
+        {
+            (void)syn6288_queue_set_deadline(&gs_queue, 0);
+        }
+        len = a_service_cut(s);
+        if (syn6288_queue_push(&gs_queue, &s->text[s->pos], len, &id) != 0)
+        {
+            if (s->pos == 0)
+            {
+                gs_producer[s->producer].deficit += (int32_t)s->cost;
+            }
+            
+            return 1;
+        }
+        f = &gs_flight[j];
+        f->id = id;
+        f->slot = i;
+        s->pos = (uint16_t)(s->pos + len);
+        s->flight++;
+        gs_stats.segments++;
+    }
+}
+
+/**
+ * @brief     find or add a producer
+ * @param[in] id producer id
+ * @param[in] weight producer weight, 0 keeps the current weight
+ * @return    producer slot or SYN6288_SERVICE_MAX_PRODUCER if the table is full
+ * @note      an idle producer is replaced when the table is full and its stats are lost
+ */
+static uint8_t a_service_producer(uint32_t id, uint8_t weight)
+{
+    uint8_t i;
+    uint8_t free_slot;
+    syn6288_service_producer_t *p;
+    
+    free_slot = SYN6288_SERVICE_MAX_PRODUCER;
+    for (i = 0; i < SYN6288_SERVICE_MAX_PRODUCER; i++)
+    {
+        p = &gs_producer[i];
+        if ((p->used != 0) && (p->id == id))
+        {
+            if (weight != 0)
+            {
+                p->weight = weight;
+            }
+            
+            return i;
+        }
+        if ((p->used == 0) && (free_slot == SYN6288_SERVICE_MAX_PRODUCER))
+        {
+            free_slot = i;
+        }
+    }
+    if (free_slot == SYN6288_SERVICE_MAX_PRODUCER)
+    {
+        for (i = 0; i < SYN6288_SERVICE_MAX_PRODUCER; i++)
+        {
+            if ((gs_producer[i].pending == 0) && (gs_producer[i].deficit >= 0))
+            {
+                free_slot = i;
+                
+                break;
+            }
+        }
+        if (free_slot == SYN6288_SERVICE_MAX_PRODUCER)
+        {
+            return SYN6288_SERVICE_MAX_PRODUCER;
+        }
+    }
+    p = &gs_producer[free_slot];
+    memset(p, 0, sizeof(syn6288_service_producer_t));
+    p->id = id;
+    p->used = 1;
+    p->weight = (weight != 0) ? weight : SYN6288_SERVICE_DEFAULT_WEIGHT;
+    
+    return free_slot;
+}
+
+/**
+ * @brief      transcode utf-8 to utf-16be
+ * @param[in]  *in pointer to a utf-8 text
+ * @param[in]  len utf-8 text length
+ * @param[out] *out pointer to an output buffer
+ * @param[out] *out_len pointer to an output length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 text is too long
+ * @note       invalid bytes and chars out of the basic plane are skipped
+ */
+static uint8_t a_service_utf8(uint8_t *in, uint16_t len, uint8_t *out, uint16_t *out_len)
+{
+    uint16_t i;
+    uint16_t j;
+    uint8_t k;
+    uint8_t need;
+    uint32_t c;
+    
+    i = 0;
+    j = 0;
+    while (i < len)
+    {
+        if (in[i] < 0x80)
+        {
+            c = in[i];
+            need = 1;
+        }
+        else if ((in[i] >= 0xC2) && (in[i] <= 0xDF))
+        {
+            c = in[i] & 0x1F;
+            need = 2;
+        }
+        else if ((in[i] >= 0xE0) && (in[i] <= 0xEF))
+        {
+            c = in[i] & 0x0F;
+            need = 3;
+        }
+        else
+        {
+            i++;
+            
+            continue;
+        }
+        for (k = 1; k < need; k++)
+        {
+            if (((i + k) >= len) || ((in[i + k] & 0xC0) != 0x80))
+            {
+                break;
+            }
+            c = (c << 6) | (in[i + k] & 0x3F);
+        }
+        if (k != need)
+        {
+            i = (uint16_t)(i + k);
+            
+            continue;
+        }
+        i = (uint16_t)(i + need);
+        if (((need == 3) && (c < 0x800)) || ((c >= 0xD800) && (c <= 0xDFFF)) || (c == 0xFEFF))
+        {
+            continue;
+        }
+        if ((j + 2) > SYN6288_SERVICE_MAX_TEXT)
+        {
+            return 1;
+        }
+        out[j++] = (uint8_t)(c >> 8);
+        out[j++] = (uint8_t)(c & 0xFF);
+    }
+    *out_len = j;
+    
+    return 0;
+}
+
+/**
+ * @brief     service example init
+ * @param[in] *callback pointer to an event callback
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the service owns the handle and the queue until the deinit
+ */
+uint8_t syn6288_service_init(void (*callback)(syn6288_service_event_t *event))
+{
+    uint8_t res;
+    
+    /* link interface function */
+    DRIVER_SYN6288_LINK_INIT(&gs_handle, syn6288_handle_t);
+    DRIVER_SYN6288_LINK_UART_INIT(&gs_handle, syn6288_interface_uart_init);
+    DRIVER_SYN6288_LINK_UART_DEINIT(&gs_handle, syn6288_interface_uart_deinit);
+    DRIVER_SYN6288_LINK_UART_READ(&gs_handle, syn6288_interface_uart_read);
+    DRIVER_SYN6288_LINK_UART_WRITE(&gs_handle, syn6288_interface_uart_write);
+    DRIVER_SYN6288_LINK_UART_FLUSH(&gs_handle, syn6288_interface_uart_flush);
+    DRIVER_SYN6288_LINK_DELAY_MS(&gs_handle, syn6288_interface_delay_ms);
+    DRIVER_SYN6288_LINK_DEBUG_PRINT(&gs_handle, syn6288_interface_debug_print);
+    DRIVER_SYN6288_LINK_TIMESTAMP_MS(&gs_handle, syn6288_interface_timestamp_ms);
+    DRIVER_SYN6288_LINK_EVENT(&gs_handle, syn6288_interface_event);
+    
+    /* link queue function */
+    DRIVER_SYN6288_QUEUE_LINK_INIT(&gs_queue, syn6288_queue_t);
+    DRIVER_SYN6288_QUEUE_LINK_TIMESTAMP_MS(&gs_queue, syn6288_interface_timestamp_ms);
+    DRIVER_SYN6288_QUEUE_LINK_RECEIVE_CALLBACK(&gs_queue, a_service_receive_callback);
+    
+    /* syn6288 init */
+    res = syn6288_init(&gs_handle);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* queue init */
+    res = syn6288_queue_init(&gs_queue, &gs_handle);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue init failed.\n");
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* reset the state */
+    gs_callback = callback;
+    gs_id = 1;
+    gs_seq = 0;
+    gs_wait_sum = 0;
+    gs_wait_num = 0;
+    memset(&gs_stats, 0, sizeof(syn6288_service_stats_t));
+    memset(gs_flight, 0, sizeof(gs_flight));
+    memset(gs_slot, 0, sizeof(gs_slot));
+    memset(gs_producer, 0, sizeof(gs_producer));
+    gs_round = 0;
+    gs_turn = 0;
+    gs_time = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief      submit a request
+ * @param[in]  *request pointer to a request structure
+ * @param[out] *id pointer to a request id buffer
+ * @param[in]  copy 1 to copy the text, 0 to play it from the caller memory
+ * @return     status code
+ *             - 0 success
+ *             - 1 service is full
+ *             - 2 request is invalid
+ * @note       utf-8 is always transcoded to the buffer
+ */
+static uint8_t a_service_submit(syn6288_service_request_t *request, uint32_t *id, uint8_t copy)
+{
+    uint8_t i;
+    uint8_t producer;
+    syn6288_service_slot_t *s;
+    
+    if ((request == NULL) || (request->buf == NULL) || (request->len == 0) ||
+        (request->encoding > SYN6288_SERVICE_ENCODING_UTF8) ||
+        (request->priority > SYN6288_QUEUE_PRIORITY_EMERGENCY) ||
+        ((request->mode != SYN6288_SERVICE_SETTING_DEFAULT) && (request->mode > SYN6288_MODE_BACKGROUND_15)) ||
+        ((request->volume != SYN6288_SERVICE_SETTING_DEFAULT) && (request->volume > 16)) ||
+        ((request->background_volume != SYN6288_SERVICE_SETTING_DEFAULT) && (request->background_volume > 16)) ||
+        ((request->speed != SYN6288_SERVICE_SETTING_DEFAULT) && (request->speed > 5)))
+    {
+        gs_stats.rejected++;
+        
+        return 2;
+    }
+    for (i = 0; i < SYN6288_SERVICE_MAX_REQUEST; i++)
+    {
+        if (gs_slot[i].used == 0)
+        {
+            break;
+        }
+    }
+    if (i == SYN6288_SERVICE_MAX_REQUEST)
+    {
+        gs_stats.rejected++;
+        
+        return 1;
+    }
+    producer = a_service_producer(request->producer, request->weight);
+    if (producer == SYN6288_SERVICE_MAX_PRODUCER)
+    {
+        gs_stats.rejected++;
+        
+        return 1;
+    }
+    s = &gs_slot[i];
+    if (request->encoding == SYN6288_SERVICE_ENCODING_UTF8)
+    {
+        if (a_service_utf8(request->buf, request->len, s->buf, &s->len) != 0)
+        {
+            gs_stats.rejected++;
+            
+            return 2;
+        }
+        s->text = s->buf;
+        s->type = SYN6288_TYPE_UNICODE;
+    }
+    else
+    {
+        if ((request->len > SYN6288_SERVICE_MAX_TEXT) ||
+            ((request->encoding == SYN6288_SERVICE_ENCODING_UNICODE) && ((request->len % 2) != 0)))
+        {
+            gs_stats.rejected++;
+            
+            return 2;
+        }
+        if (copy != 0)
+        {
+            memcpy(s->buf, request->buf, request->len);
+            s->text = s->buf;
+        }
+        else
+        {
+            s->text = request->buf;
+            gs_stats.zero_copy++;
+        }
+        s->len = request->len;
+        s->type = request->encoding;
+    }
+    if (s->len == 0)
+    {
+        gs_stats.rejected++;
+        
+        return 2;
+    }
+    s->id = gs_id++;
+    if (gs_id == 0)
+    {
+        gs_id = 1;
+    }
+    s->client = request->client;
+    s->tag = request->tag;
+    s->seq = gs_seq++;
+    s->submit = syn6288_interface_timestamp_ms();
+    s->start = 0;
+    s->deadline_valid = (request->deadline != 0) ? 1 : 0;
+    s->deadline = s->submit + request->deadline;
+    s->started = 0;
+    s->dropped = 0;
+    s->priority = request->priority;
+    s->mode = (request->mode != SYN6288_SERVICE_SETTING_DEFAULT) ?
+              request->mode : SYN6288_SERVICE_DEFAULT_MODE;
+    s->volume = (request->volume != SYN6288_SERVICE_SETTING_DEFAULT) ?
+                request->volume : SYN6288_SERVICE_DEFAULT_SYNTHESIS_VOLUME;
+    s->background_volume = (request->background_volume != SYN6288_SERVICE_SETTING_DEFAULT) ?
+                           request->background_volume : SYN6288_SERVICE_DEFAULT_BACKGROUND_VOLUME;
+    s->speed = (request->speed != SYN6288_SERVICE_SETTING_DEFAULT) ?
+               request->speed : SYN6288_SERVICE_DEFAULT_SYNTHESIS_SPEED;
+    (void)syn6288_queue_estimate_duration((syn6288_type_t)s->type, s->speed, s->text, s->len, &s->cost);
+    s->producer = producer;
+    s->flight = 0;
+    s->pos = 0;
+    s->used = 1;
+    gs_stats.submitted++;
+    gs_stats.pending++;
+    gs_producer[producer].submitted++;
+    gs_producer[producer].pending++;
+    if (id != NULL)
+    {
+        *id = s->id;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      service example submit a request
+ * @param[in]  *request pointer to a request structure
+ * @param[out] *id pointer to a request id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 service is full
+ *             - 2 request is invalid
+ * @note       the text is copied, utf-8 is transcoded to unicode
+ */
+uint8_t syn6288_service_submit(syn6288_service_request_t *request, uint32_t *id)
+{
+    return a_service_submit(request, id, 1);
+}
+
+/**
+ * @brief      service example submit a request without a copy
+ * @param[in]  *request pointer to a request structure
+ * @param[out] *id pointer to a request id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 service is full
+ *             - 2 request is invalid
+ * @note       the segments are read from the caller memory, which must stay valid
+ *             until the done or drop event of the request, utf-8 is transcoded and copied
+ */
+uint8_t syn6288_service_submit_zero_copy(syn6288_service_request_t *request, uint32_t *id)
+{
+    return a_service_submit(request, id, 0);
+}
+
+/**
+ * @brief  service example process
+ * @return status code
+ *         - 0 success
+ *         - 1 process failed
+ * @note   call this function periodically, the events are reported from it
+ */
+uint8_t syn6288_service_process(void)
+{
+    uint8_t res;
+    
+    res = a_service_feed();
+    if (syn6288_queue_process(&gs_queue) != 0)
+    {
+        res = 1;
+    }
+    
+    return res;
+}
+
+/**
+ * @brief      service example get the stats
+ * @param[out] *stats pointer to a stats buffer
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+uint8_t syn6288_service_get_stats(syn6288_service_stats_t *stats)
+{
+    *stats = gs_stats;
+    stats->wait_avg = (gs_wait_num != 0) ? (gs_wait_sum / gs_wait_num) : 0;
+    
+    return 0;
+}
+
+/**
+ * @brief      service example get the stats of a producer
+ * @param[in]  index producer index
+ * @param[out] *stats pointer to a stats buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 index is unused
+ * @note       index is 0 - SYN6288_SERVICE_MAX_PRODUCER - 1
+ */
+uint8_t syn6288_service_get_producer_stats(uint8_t index, syn6288_service_producer_stats_t *stats)
+{
+    syn6288_service_producer_t *p;
+    
+    if ((index >= SYN6288_SERVICE_MAX_PRODUCER) || (gs_producer[index].used == 0))
+    {
+        return 1;
+    }
+    p = &gs_producer[index];
+    stats->producer = p->id;
+    stats->weight = p->weight;
+    stats->deficit = p->deficit;
+    stats->submitted = p->submitted;
+    stats->done = p->done;
+    stats->dropped = p->dropped;
+    stats->pending = p->pending;
+    stats->time = p->time;
+    stats->share = (gs_time != 0) ? (uint32_t)(((uint64_t)p->time * 1000) / gs_time) : 0;
+    stats->wait_avg = (p->wait_num != 0) ? (p->wait_sum / p->wait_num) : 0;
+    stats->wait_max = p->wait_max;
+    
+    return 0;
+}
+
+/**
+ * @brief  service example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   the requests still waiting are dropped without events
+ */
+uint8_t syn6288_service_deinit(void)
+{
+    uint8_t res;
+    
+    res = syn6288_queue_deinit(&gs_queue);
+    if (syn6288_deinit(&gs_handle) != 0)
+    {
+        res = 1;
+    }
+    memset(gs_slot, 0, sizeof(gs_slot));
+    gs_callback = NULL;
+    
+    return (res != 0) ? 1 : 0;
+}
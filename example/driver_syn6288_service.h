@@ -0,0 +1,288 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_syn6288_service.h
+ * @brief     driver syn6288 service header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SYN6288_SERVICE_H
+#define DRIVER_SYN6288_SERVICE_H
+
+#include "driver_syn6288_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup syn6288_example_driver
+ * @{
+ */
+
+/**
+ * @brief syn6288 service max request definition
+ */
+#ifndef SYN6288_SERVICE_MAX_REQUEST
+    #define SYN6288_SERVICE_MAX_REQUEST 32        /**< 32 requests */
+#endif
+
+/**
+ * @brief syn6288 service max encoded text length definition
+ */
+#ifndef SYN6288_SERVICE_MAX_TEXT
+    #define SYN6288_SERVICE_MAX_TEXT 512        /**< 512 bytes */
+#endif
+
+/**
+ * @brief syn6288 service max segment length definition
+ * @note  a segment fills at most one text frame, a shorter segment lets a later request
+ *        of a higher priority start sooner
+ */
+#ifndef SYN6288_SERVICE_MAX_SEGMENT
+    #define SYN6288_SERVICE_MAX_SEGMENT 200        /**< 200 bytes */
+#endif
+
+/**
+ * @brief syn6288 service queue depth definition
+ * @note  the requests wait in the service and only a few segments are handed to the queue,
+ *        so a later request of a higher priority is played at the next segment boundary
+ */
+#ifndef SYN6288_SERVICE_QUEUE_DEPTH
+    #define SYN6288_SERVICE_QUEUE_DEPTH 2        /**< 2 items */
+#endif
+
+/**
+ * @brief syn6288 service max producer definition
+ */
+#ifndef SYN6288_SERVICE_MAX_PRODUCER
+    #define SYN6288_SERVICE_MAX_PRODUCER 8        /**< 8 producers */
+#endif
+
+/**
+ * @brief syn6288 service quantum definition
+ * @note  a producer earns its weight times the quantum of estimated speaking time in each round
+ */
+#ifndef SYN6288_SERVICE_QUANTUM_MS
+    #define SYN6288_SERVICE_QUANTUM_MS 2000        /**< 2000 ms */
+#endif
+
+/**
+ * @brief syn6288 service default weight definition
+ */
+#define SYN6288_SERVICE_DEFAULT_WEIGHT 1        /**< weight 1 */
+
+/**
+ * @brief syn6288 service default setting definition
+ */
+#define SYN6288_SERVICE_SETTING_DEFAULT 0xFF        /**< use the service default */
+
+/**
+ * @brief syn6288 service default settings definition
+ */
+#define SYN6288_SERVICE_DEFAULT_MODE                SYN6288_MODE_COMMON        /**< common mode */
+#define SYN6288_SERVICE_DEFAULT_SYNTHESIS_VOLUME    16                         /**< synthesis volume 16 */
+#define SYN6288_SERVICE_DEFAULT_BACKGROUND_VOLUME   0                          /**< background volume 0 */
+#define SYN6288_SERVICE_DEFAULT_SYNTHESIS_SPEED     5                          /**< synthesis speed 5 */
+
+/**
+ * @brief syn6288 service encoding enumeration definition
+ */
+typedef enum
+{
+    SYN6288_SERVICE_ENCODING_GB2312  = 0x00,        /**< gb2312 */
+    SYN6288_SERVICE_ENCODING_GBK     = 0x01,        /**< gbk */
+    SYN6288_SERVICE_ENCODING_BIG5    = 0x02,        /**< big5 */
+    SYN6288_SERVICE_ENCODING_UNICODE = 0x03,        /**< utf-16be */
+    SYN6288_SERVICE_ENCODING_UTF8    = 0x04,        /**< utf-8 transcoded to unicode */
+} syn6288_service_encoding_t;
+
+/**
+ * @brief syn6288 service event enumeration definition
+ */
+typedef enum
+{
+    SYN6288_SERVICE_EVENT_START   = 0x00,        /**< request starts playing */
+    SYN6288_SERVICE_EVENT_DONE    = 0x01,        /**< request is finished */
+    SYN6288_SERVICE_EVENT_DROP    = 0x02,        /**< request is dropped */
+    SYN6288_SERVICE_EVENT_PREEMPT = 0x03,        /**< request is interrupted and queued again */
+} syn6288_service_event_type_t;
+
+/**
+ * @brief syn6288 service request structure definition
+ */
+typedef struct syn6288_service_request_s
+{
+    uint32_t client;                  /**< client id, echoed in the events */
+    uint32_t tag;                     /**< client tag, echoed in the events */
+    uint32_t producer;                /**< producer id, the speaking time is shared by the producers */
+    uint8_t weight;                   /**< producer weight, 0 keeps the current weight */
+    uint8_t encoding;                 /**< text encoding */
+    uint8_t priority;                 /**< queue priority */
+    uint32_t deadline;                /**< latest start after the submit in ms, 0 means none */
+    uint8_t mode;                     /**< background mode or default */
+    uint8_t volume;                   /**< synthesis volume or default */
+    uint8_t background_volume;        /**< background volume or default */
+    uint8_t speed;                    /**< synthesis speed or default */
+    uint8_t *buf;                     /**< point to the text */
+    uint16_t len;                     /**< text length */
+} syn6288_service_request_t;
+
+/**
+ * @brief syn6288 service event structure definition
+ */
+typedef struct syn6288_service_event_s
+{
+    uint32_t id;              /**< request id */
+    uint32_t client;          /**< client id */
+    uint32_t tag;             /**< client tag */
+    uint8_t type;             /**< event type */
+    uint32_t wait;            /**< time from the submit to the start in ms */
+    uint32_t time;            /**< time from the submit to the event in ms */
+} syn6288_service_event_t;
+
+/**
+ * @brief syn6288 service stats structure definition
+ */
+typedef struct syn6288_service_stats_s
+{
+    uint32_t submitted;       /**< accepted requests */
+    uint32_t rejected;        /**< refused requests */
+    uint32_t done;            /**< played requests */
+    uint32_t dropped;         /**< dropped requests */
+    uint32_t preempted;       /**< interrupted requests */
+    uint32_t segments;        /**< segments handed to the queue */
+    uint32_t zero_copy;       /**< requests played from the caller memory */
+    uint32_t pending;         /**< requests waiting or playing */
+    uint32_t wait_avg;        /**< average time from the submit to the start in ms */
+    uint32_t wait_max;        /**< max time from the submit to the start in ms */
+} syn6288_service_stats_t;
+
+/**
+ * @brief syn6288 service producer stats structure definition
+ */
+typedef struct syn6288_service_producer_stats_s
+{
+    uint32_t producer;        /**< producer id */
+    uint8_t weight;           /**< producer weight */
+    int32_t deficit;          /**< unspent speaking time of the round in ms */
+    uint32_t submitted;       /**< accepted requests */
+    uint32_t done;            /**< played requests */
+    uint32_t dropped;         /**< dropped requests */
+    uint32_t pending;         /**< requests waiting or playing */
+    uint32_t time;            /**< estimated speaking time of the played requests in ms */
+    uint32_t share;           /**< part of the played speaking time in permille */
+    uint32_t wait_avg;        /**< average time from the submit to the start in ms */
+    uint32_t wait_max;        /**< max time from the submit to the start in ms */
+} syn6288_service_producer_stats_t;
+
+/**
+ * @brief     service example init
+ * @param[in] *callback pointer to an event callback
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the service owns the handle and the queue until the deinit
+ */
+uint8_t syn6288_service_init(void (*callback)(syn6288_service_event_t *event));
+
+/**
+ * @brief      service example get the stats of a producer
+ * @param[in]  index producer index
+ * @param[out] *stats pointer to a stats buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 index is unused
+ * @note       index is 0 - SYN6288_SERVICE_MAX_PRODUCER - 1
+ */
+uint8_t syn6288_service_get_producer_stats(uint8_t index, syn6288_service_producer_stats_t *stats);
+
+/**
+ * @brief  service example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t syn6288_service_deinit(void);
+
+/**
+ * @brief      service example submit a request
+ * @param[in]  *request pointer to a request structure
+ * @param[out] *id pointer to a request id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 service is full
+ *             - 2 request is invalid
+ * @note       the text is copied, utf-8 is transcoded to unicode
+ */
+uint8_t syn6288_service_submit(syn6288_service_request_t *request, uint32_t *id);
+
+/**
+ * @brief      service example submit a request without a copy
+ * @param[in]  *request pointer to a request structure
+ * @param[out] *id pointer to a request id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 service is full
+ *             - 2 request is invalid
+ * @note       the segments are read from the caller memory, which must stay valid
+ *             until the done or drop event of the request, utf-8 is transcoded and copied
+ */
+uint8_t syn6288_service_submit_zero_copy(syn6288_service_request_t *request, uint32_t *id);
+
+/**
+ * @brief  service example process
+ * @return status code
+ *         - 0 success
+ *         - 1 process failed
+ * @note   call this function periodically, the events are reported from it
+ */
+uint8_t syn6288_service_process(void);
+
+/**
+ * @brief      service example get the stats
+ * @param[out] *stats pointer to a stats buffer
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+uint8_t syn6288_service_get_stats(syn6288_service_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,878 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_syn6288_stream.c
+ * @brief     driver syn6288 stream source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_syn6288_stream.h"
+#include "driver_syn6288_queue.h"
+
+/**
+ * @brief syn6288 stream in-flight segment number definition
+ */
+#define SYN6288_STREAM_FLIGHT (SYN6288_QUEUE_MAX_ITEM * 2)        /**< twice the queue */
+
+/**
+ * @brief syn6288 stream consecutive process failures before giving up definition
+ */
+#ifndef SYN6288_STREAM_MAX_FAILURE
+    #define SYN6288_STREAM_MAX_FAILURE 10        /**< 10 failures */
+#endif
+
+/**
+ * @brief syn6288 stream char class enumeration definition
+ */
+typedef enum
+{
+    SYN6288_STREAM_CLASS_NORMAL  = 0x00,        /**< normal char */
+    SYN6288_STREAM_CLASS_SPACE   = 0x01,        /**< space */
+    SYN6288_STREAM_CLASS_SOFT    = 0x02,        /**< comma, a cut point of a long sentence */
+    SYN6288_STREAM_CLASS_HARD    = 0x03,        /**< full width sentence end */
+    SYN6288_STREAM_CLASS_MARK    = 0x04,        /**< ascii sentence end, confirmed by a following space */
+    SYN6288_STREAM_CLASS_LINE    = 0x05,        /**< line end */
+    SYN6288_STREAM_CLASS_CONTROL = 0x06,        /**< ignored control char */
+} syn6288_stream_class_t;
+
+static syn6288_handle_t gs_handle;                                   /**< syn6288 handle */
+static syn6288_queue_t gs_queue;                                     /**< syn6288 queue */
+static uint8_t gs_encoding;                                          /**< input encoding */
+static uint8_t gs_partial[4];                                        /**< partial input char */
+static uint8_t gs_partial_len;                                       /**< partial input char length */
+static uint8_t gs_partial_need;                                      /**< full input char length */
+static uint8_t gs_segment[SYN6288_STREAM_MAX_LEN];                   /**< encoded segment */
+static uint16_t gs_segment_len;                                      /**< encoded segment length */
+static uint16_t gs_soft;                                             /**< last soft cut point */
+static uint8_t gs_space;                                             /**< segment ends with a space flag */
+static uint8_t gs_mark;                                              /**< pending ascii sentence end flag */
+static uint8_t gs_failures;                                          /**< consecutive process failures */
+static uint32_t gs_first_id;                                         /**< id of the first segment */
+static uint32_t gs_first_push;                                       /**< push timestamp of the first segment */
+static uint32_t gs_last_done;                                        /**< done timestamp of the last segment */
+static uint8_t gs_last_done_valid;                                   /**< last done flag */
+static uint32_t gs_frames;                                           /**< text frames at init */
+static uint32_t gs_wait_sum;                                         /**< wait sum in ms */
+static uint32_t gs_gap_sum;                                          /**< gap sum in ms */
+static uint32_t gs_gap_num;                                          /**< gap number */
+static syn6288_stream_stats_t gs_stats;                              /**< stream stats */
+static syn6288_stream_segment_t gs_flight[SYN6288_STREAM_FLIGHT];    /**< in-flight segments */
+static uint8_t gs_started[SYN6288_STREAM_FLIGHT];                    /**< in-flight started flags */
+static syn6288_stream_segment_t gs_record[SYN6288_STREAM_MAX_RECORD];  /**< finished segment records */
+
+/**
+ * @brief     stream receive callback
+ * @param[in] type event type
+ * @param[in] id item id
+ * @note      items coalesced into one frame start when the item before them is done
+ */
+static void a_stream_receive_callback(uint8_t type, uint32_t id)
+{
+    uint32_t now;
+    uint32_t wait;
+    uint32_t index;
+    syn6288_stream_segment_t *seg;
+    
+    seg = &gs_flight[id % SYN6288_STREAM_FLIGHT];
+    if (seg->id != id)
+    {
+        return;
+    }
+    now = syn6288_interface_timestamp_ms();
+    switch (type)
+    {
+        case SYN6288_QUEUE_EVENT_START :
+        {
+            seg->start = now;
+            gs_started[id % SYN6288_STREAM_FLIGHT] = 1;
+            if (gs_last_done_valid != 0)
+            {
+                gs_gap_sum += now - gs_last_done;
+                gs_gap_num++;
+                if ((now - gs_last_done) > gs_stats.gap_max)
+                {
+                    gs_stats.gap_max = now - gs_last_done;
+                }
+            }
+            
+            return;
+        }
+        case SYN6288_QUEUE_EVENT_PREEMPT :
+        {
+            gs_started[id % SYN6288_STREAM_FLIGHT] = 0;
+            
+            return;
+        }
+        case SYN6288_QUEUE_EVENT_DONE :
+        {
+            if (gs_started[id % SYN6288_STREAM_FLIGHT] == 0)
+            {
+                seg->start = (gs_last_done_valid != 0) ? gs_last_done : seg->push;
+                gs_gap_num += gs_last_done_valid;
+                if ((int32_t)(seg->start - seg->push) < 0)
+                {
+                    seg->start = seg->push;
+                }
+            }
+            wait = seg->start - seg->push;
+            gs_wait_sum += wait;
+            if (wait > gs_stats.wait_max)
+            {
+                gs_stats.wait_max = wait;
+            }
+            seg->done = now;
+            seg->status = SYN6288_STREAM_SEGMENT_DONE;
+            gs_stats.done++;
+            gs_stats.time = now - gs_first_push;
+            gs_last_done = now;
+            gs_last_done_valid = 1;
+            
+            break;
+        }
+        case SYN6288_QUEUE_EVENT_DROP :
+        {
+            seg->done = now;
+            seg->status = SYN6288_STREAM_SEGMENT_DROPPED;
+            gs_stats.dropped++;
+            
+            break;
+        }
+        default :
+        {
+            return;
+        }
+    }
+    
+    /* save the finished segment */
+    index = id - gs_first_id;
+    if (index < SYN6288_STREAM_MAX_RECORD)
+    {
+        gs_record[index] = *seg;
+    }
+    seg->id = 0;
+}
+
+/**
+ * @brief  process the queue once
+ * @return status code
+ *         - 0 success
+ *         - 1 process failed
+ * @note   a failed transaction is retried by the queue, only a run of failures is an error
+ */
+static uint8_t a_stream_process(void)
+{
+    if (syn6288_queue_process(&gs_queue) != 0)
+    {
+        gs_failures++;
+        if (gs_failures >= SYN6288_STREAM_MAX_FAILURE)
+        {
+            syn6288_interface_debug_print("syn6288: stream process failed.\n");
+            
+            return 1;
+        }
+    }
+    else
+    {
+        gs_failures = 0;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     queue a segment
+ * @param[in] *buf pointer to an encoded segment
+ * @param[in] len segment length
+ * @return    status code
+ *            - 0 success
+ *            - 1 push failed
+ * @note      the queue is processed until it has a free slot
+ */
+static uint8_t a_stream_push(uint8_t *buf, uint16_t len)
+{
+    uint8_t speed;
+    uint8_t count;
+    uint32_t id;
+    syn6288_stream_segment_t *seg;
+    
+    while (1)
+    {
+        if (syn6288_queue_get_count(&gs_queue, &count) != 0)
+        {
+            return 1;
+        }
+        if (count < SYN6288_QUEUE_MAX_ITEM)
+        {
+            break;
+        }
+        if (a_stream_process() != 0)
+        {
+            return 1;
+        }
+        syn6288_interface_delay_ms(10);
+    }
+    if (syn6288_queue_push(&gs_queue, buf, len, &id) != 0)
+    {
+        return 1;
+    }
+    seg = &gs_flight[id % SYN6288_STREAM_FLIGHT];
+    seg->id = id;
+    seg->len = len;
+    seg->push = syn6288_interface_timestamp_ms();
+    seg->start = 0;
+    seg->done = 0;
+    seg->status = SYN6288_STREAM_SEGMENT_QUEUED;
+    gs_started[id % SYN6288_STREAM_FLIGHT] = 0;
+    (void)syn6288_get_synthesis_speed(&gs_handle, &speed);
+    if (syn6288_queue_estimate_duration((syn6288_type_t)gs_handle.type, (speed > 5) ? 5 : speed,
+                                        buf, len, &seg->estimate) != 0)
+    {
+        seg->estimate = 0;
+    }
+    if (gs_stats.segments == 0)
+    {
+        gs_first_id = id;
+        gs_first_push = seg->push;
+    }
+    gs_stats.segments++;
+    gs_stats.bytes += len;
+    
+    return a_stream_process();
+}
+
+/**
+ * @brief     check a space at a position of the segment
+ * @param[in] pos position
+ * @return    1 if the char at pos is a space, else 0
+ * @note      none
+ */
+static uint8_t a_stream_is_space(uint16_t pos)
+{
+    if (gs_handle.type == SYN6288_TYPE_UNICODE)
+    {
+        return ((gs_segment[pos] == 0x00) && (gs_segment[pos + 1] == 0x20)) ? 1 : 0;
+    }
+    else
+    {
+        return (gs_segment[pos] == 0x20) ? 1 : 0;
+    }
+}
+
+/**
+ * @brief     queue the head of the segment
+ * @param[in] len head length
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit failed
+ * @note      the spaces around the head are not sent and the rest is kept
+ */
+static uint8_t a_stream_emit(uint16_t len)
+{
+    uint8_t w;
+    uint16_t end;
+    uint16_t start;
+    
+    w = (gs_handle.type == SYN6288_TYPE_UNICODE) ? 2 : 1;
+    end = len;
+    while ((end >= w) && (a_stream_is_space(end - w) != 0))
+    {
+        end -= w;
+    }
+    if (end != 0)
+    {
+        if (a_stream_push(gs_segment, end) != 0)
+        {
+            return 1;
+        }
+    }
+    start = len;
+    while ((start + w <= gs_segment_len) && (a_stream_is_space(start) != 0))
+    {
+        start += w;
+    }
+    memmove(gs_segment, &gs_segment[start], gs_segment_len - start);
+    gs_segment_len -= start;
+    gs_soft = 0;
+    gs_space = 0;
+    gs_mark = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     append an encoded char to the segment
+ * @param[in] *buf pointer to an encoded char
+ * @param[in] len encoded char length
+ * @return    status code
+ *            - 0 success
+ *            - 1 append failed
+ * @note      a full segment is cut at its last comma or space if it has one
+ */
+static uint8_t a_stream_append(uint8_t *buf, uint8_t len)
+{
+    if ((gs_segment_len + len) > SYN6288_STREAM_MAX_LEN)
+    {
+        if (a_stream_emit((gs_soft != 0) ? gs_soft : gs_segment_len) != 0)
+        {
+            return 1;
+        }
+        if ((gs_segment_len + len) > SYN6288_STREAM_MAX_LEN)
+        {
+            if (a_stream_emit(gs_segment_len) != 0)
+            {
+                return 1;
+            }
+        }
+    }
+    memcpy(&gs_segment[gs_segment_len], buf, len);
+    gs_segment_len += len;
+    
+    return 0;
+}
+
+/**
+ * @brief     classify a decoded char
+ * @param[in] c char code
+ * @return    char class
+ * @note      the full width marks are looked up in the table of the input encoding
+ */
+static syn6288_stream_class_t a_stream_class(uint32_t c)
+{
+    if (c < 0x80)
+    {
+        if (c == '\n')
+        {
+            return SYN6288_STREAM_CLASS_LINE;
+        }
+        if ((c == ' ') || (c == '\t') || (c == '\r'))
+        {
+            return SYN6288_STREAM_CLASS_SPACE;
+        }
+        if (c < 0x20)
+        {
+            return SYN6288_STREAM_CLASS_CONTROL;
+        }
+        if ((c == '.') || (c == '!') || (c == '?') || (c == ';'))
+        {
+            return SYN6288_STREAM_CLASS_MARK;
+        }
+        if ((c == ',') || (c == ':'))
+        {
+            return SYN6288_STREAM_CLASS_SOFT;
+        }
+        
+        return SYN6288_STREAM_CLASS_NORMAL;
+    }
+    switch (gs_encoding)
+    {
+        case SYN6288_STREAM_ENCODING_GB2312 :
+        case SYN6288_STREAM_ENCODING_GBK :
+        {
+            if (c == 0xA1A1)
+            {
+                return SYN6288_STREAM_CLASS_SPACE;
+            }
+            if ((c == 0xA1A3) || (c == 0xA3A1) || (c == 0xA3BF) || (c == 0xA3BB))
+            {
+                return SYN6288_STREAM_CLASS_HARD;
+            }
+            if ((c == 0xA3AC) || (c == 0xA1A2) || (c == 0xA3BA))
+            {
+                return SYN6288_STREAM_CLASS_SOFT;
+            }
+            
+            return SYN6288_STREAM_CLASS_NORMAL;
+        }
+        case SYN6288_STREAM_ENCODING_BIG5 :
+        {
+            if (c == 0xA140)
+            {
+                return SYN6288_STREAM_CLASS_SPACE;
+            }
+            if ((c == 0xA143) || (c == 0xA149) || (c == 0xA148) || (c == 0xA146))
+            {
+                return SYN6288_STREAM_CLASS_HARD;
+            }
+            if ((c == 0xA141) || (c == 0xA142) || (c == 0xA147))
+            {
+                return SYN6288_STREAM_CLASS_SOFT;
+            }
+            
+            return SYN6288_STREAM_CLASS_NORMAL;
+        }
+        default :
+        {
+            if ((c == 0x3000) || (c == 0x00A0))
+            {
+                return SYN6288_STREAM_CLASS_SPACE;
+            }
+            if ((c == 0x3002) || (c == 0xFF01) || (c == 0xFF1F) || (c == 0xFF1B))
+            {
+                return SYN6288_STREAM_CLASS_HARD;
+            }
+            if ((c == 0xFF0C) || (c == 0x3001) || (c == 0xFF1A))
+            {
+                return SYN6288_STREAM_CLASS_SOFT;
+            }
+            if (c == 0x2028)
+            {
+                return SYN6288_STREAM_CLASS_LINE;
+            }
+            
+            return SYN6288_STREAM_CLASS_NORMAL;
+        }
+    }
+}
+
+/**
+ * @brief     add a decoded char to the segment
+ * @param[in] c char code
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      none
+ */
+static uint8_t a_stream_char(uint32_t c)
+{
+    uint8_t len;
+    uint8_t buf[2];
+    syn6288_stream_class_t cls;
+    
+    cls = a_stream_class(c);
+    if (gs_mark != 0)
+    {
+        gs_mark = 0;
+        if ((cls == SYN6288_STREAM_CLASS_SPACE) || (cls == SYN6288_STREAM_CLASS_LINE))
+        {
+            return a_stream_emit(gs_segment_len);
+        }
+    }
+    if (cls == SYN6288_STREAM_CLASS_CONTROL)
+    {
+        return 0;
+    }
+    if (cls == SYN6288_STREAM_CLASS_LINE)
+    {
+        return a_stream_emit(gs_segment_len);
+    }
+    if (cls == SYN6288_STREAM_CLASS_SPACE)
+    {
+        if ((gs_segment_len == 0) || (gs_space != 0))
+        {
+            return 0;
+        }
+        c = ' ';
+    }
+    
+    /* encode the char as the chip text type */
+    if (gs_handle.type == SYN6288_TYPE_UNICODE)
+    {
+        buf[0] = (uint8_t)((c >> 8) & 0xFF);
+        buf[1] = (uint8_t)(c & 0xFF);
+        len = 2;
+    }
+    else if (c < 0x80)
+    {
+        buf[0] = (uint8_t)c;
+        len = 1;
+    }
+    else
+    {
+        buf[0] = (uint8_t)((c >> 8) & 0xFF);
+        buf[1] = (uint8_t)(c & 0xFF);
+        len = 2;
+    }
+    if (a_stream_append(buf, len) != 0)
+    {
+        return 1;
+    }
+    gs_space = (cls == SYN6288_STREAM_CLASS_SPACE) ? 1 : 0;
+    if ((cls == SYN6288_STREAM_CLASS_SPACE) || (cls == SYN6288_STREAM_CLASS_SOFT))
+    {
+        gs_soft = gs_segment_len;
+    }
+    else if (cls == SYN6288_STREAM_CLASS_HARD)
+    {
+        return a_stream_emit(gs_segment_len);
+    }
+    else if (cls == SYN6288_STREAM_CLASS_MARK)
+    {
+        gs_mark = 1;
+    }
+    else
+    {
+        /* keep the segment */
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      decode one input byte
+ * @param[in]  b input byte
+ * @param[out] *c pointer to a char code buffer
+ * @return     1 if a char is finished, else 0
+ * @note       invalid bytes and chars out of the basic plane are skipped
+ */
+static uint8_t a_stream_decode(uint8_t b, uint32_t *c)
+{
+    if (gs_encoding == SYN6288_STREAM_ENCODING_UTF8)
+    {
+        if (gs_partial_len != 0)
+        {
+            if ((b & 0xC0) == 0x80)
+            {
+                gs_partial[gs_partial_len++] = b;
+                if (gs_partial_len < gs_partial_need)
+                {
+                    return 0;
+                }
+                gs_partial_len = 0;
+                if (gs_partial_need == 2)
+                {
+                    *c = ((uint32_t)(gs_partial[0] & 0x1F) << 6) | (gs_partial[1] & 0x3F);
+                }
+                else if (gs_partial_need == 3)
+                {
+                    *c = ((uint32_t)(gs_partial[0] & 0x0F) << 12) |
+                         ((uint32_t)(gs_partial[1] & 0x3F) << 6) | (gs_partial[2] & 0x3F);
+                }
+                else
+                {
+                    gs_stats.skipped += 4;
+                    
+                    return 0;
+                }
+                if ((*c < 0x80) || ((*c >= 0xD800) && (*c <= 0xDFFF)) || (*c == 0xFEFF))
+                {
+                    gs_stats.skipped += gs_partial_need;
+                    
+                    return 0;
+                }
+                
+                return 1;
+            }
+            gs_stats.skipped += gs_partial_len;
+            gs_partial_len = 0;
+        }
+        if (b < 0x80)
+        {
+            *c = b;
+            
+            return 1;
+        }
+        gs_partial_need = (b >= 0xF0) ? 4 : ((b >= 0xE0) ? 3 : 2);
+        if ((b < 0xC2) || (b > 0xF4))
+        {
+            gs_stats.skipped++;
+            
+            return 0;
+        }
+        gs_partial[0] = b;
+        gs_partial_len = 1;
+        
+        return 0;
+    }
+    else if (gs_encoding == SYN6288_STREAM_ENCODING_UNICODE)
+    {
+        if (gs_partial_len == 0)
+        {
+            gs_partial[0] = b;
+            gs_partial_len = 1;
+            
+            return 0;
+        }
+        gs_partial_len = 0;
+        *c = ((uint32_t)gs_partial[0] << 8) | b;
+        if (((*c >= 0xD800) && (*c <= 0xDFFF)) || (*c == 0xFEFF))
+        {
+            gs_stats.skipped += 2;
+            
+            return 0;
+        }
+        
+        return 1;
+    }
+    else
+    {
+        if (gs_partial_len != 0)
+        {
+            gs_partial_len = 0;
+            *c = ((uint32_t)gs_partial[0] << 8) | b;
+            
+            return 1;
+        }
+        if (b < 0x80)
+        {
+            *c = b;
+            
+            return 1;
+        }
+        if (b == 0x80 || b == 0xFF)
+        {
+            gs_stats.skipped++;
+            
+            return 0;
+        }
+        gs_partial[0] = b;
+        gs_partial_len = 1;
+        
+        return 0;
+    }
+}
+
+/**
+ * @brief     stream example init
+ * @param[in] encoding input encoding
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t syn6288_stream_init(syn6288_stream_encoding_t encoding)
+{
+    uint8_t res;
+    syn6288_stats_t stats;
+    
+    /* link interface function */
+    DRIVER_SYN6288_LINK_INIT(&gs_handle, syn6288_handle_t);
+    DRIVER_SYN6288_LINK_UART_INIT(&gs_handle, syn6288_interface_uart_init);
+    DRIVER_SYN6288_LINK_UART_DEINIT(&gs_handle, syn6288_interface_uart_deinit);
+    DRIVER_SYN6288_LINK_UART_READ(&gs_handle, syn6288_interface_uart_read);
+    DRIVER_SYN6288_LINK_UART_WRITE(&gs_handle, syn6288_interface_uart_write);
+    DRIVER_SYN6288_LINK_UART_FLUSH(&gs_handle, syn6288_interface_uart_flush);
+    DRIVER_SYN6288_LINK_DELAY_MS(&gs_handle, syn6288_interface_delay_ms);
+    DRIVER_SYN6288_LINK_DEBUG_PRINT(&gs_handle, syn6288_interface_debug_print);
+    DRIVER_SYN6288_LINK_TIMESTAMP_MS(&gs_handle, syn6288_interface_timestamp_ms);
+    DRIVER_SYN6288_LINK_EVENT(&gs_handle, syn6288_interface_event);
+    
+    /* link queue function */
+    DRIVER_SYN6288_QUEUE_LINK_INIT(&gs_queue, syn6288_queue_t);
+    DRIVER_SYN6288_QUEUE_LINK_TIMESTAMP_MS(&gs_queue, syn6288_interface_timestamp_ms);
+    DRIVER_SYN6288_QUEUE_LINK_RECEIVE_CALLBACK(&gs_queue, a_stream_receive_callback);
+    
+    /* syn6288 init */
+    res = syn6288_init(&gs_handle);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* set the text type of the encoding */
+    res = syn6288_set_text_type(&gs_handle, (encoding == SYN6288_STREAM_ENCODING_UTF8) ?
+                                SYN6288_TYPE_UNICODE : (syn6288_type_t)encoding);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: set text type failed.\n");
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* queue init */
+    res = syn6288_queue_init(&gs_queue, &gs_handle);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue init failed.\n");
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* reset the state */
+    gs_encoding = (uint8_t)encoding;
+    gs_partial_len = 0;
+    gs_segment_len = 0;
+    gs_soft = 0;
+    gs_space = 0;
+    gs_mark = 0;
+    gs_failures = 0;
+    gs_first_id = 0;
+    gs_first_push = 0;
+    gs_last_done_valid = 0;
+    gs_wait_sum = 0;
+    gs_gap_sum = 0;
+    gs_gap_num = 0;
+    memset(&gs_stats, 0, sizeof(syn6288_stream_stats_t));
+    memset(gs_flight, 0, sizeof(gs_flight));
+    (void)syn6288_get_stats(&gs_handle, &stats);
+    gs_frames = stats.opcode[SYN6288_OPCODE_SYNTHESIS].frames;
+    
+    return 0;
+}
+
+/**
+ * @brief     stream example write
+ * @param[in] *buf pointer to an input buffer
+ * @param[in] len input buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the input is cut on sentence boundaries and the finished segments are queued,
+ *            a sentence or a character split across two writes is kept until the next write
+ */
+uint8_t syn6288_stream_write(uint8_t *buf, uint32_t len)
+{
+    uint32_t i;
+    uint32_t c;
+    
+    for (i = 0; i < len; i++)
+    {
+        if (a_stream_decode(buf[i], &c) != 0)
+        {
+            if (a_stream_char(c) != 0)
+            {
+                return 1;
+            }
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  stream example process
+ * @return status code
+ *         - 0 success
+ *         - 1 process failed
+ * @note   call this function while waiting for more input
+ */
+uint8_t syn6288_stream_process(void)
+{
+    return a_stream_process();
+}
+
+/**
+ * @brief  stream example flush
+ * @return status code
+ *         - 0 success
+ *         - 1 flush failed
+ * @note   the last segment is queued and all segments are played
+ */
+uint8_t syn6288_stream_flush(void)
+{
+    uint8_t count;
+    
+    /* queue the last segment */
+    if (gs_partial_len != 0)
+    {
+        gs_stats.skipped += gs_partial_len;
+        gs_partial_len = 0;
+    }
+    if (a_stream_emit(gs_segment_len) != 0)
+    {
+        return 1;
+    }
+    
+    /* play all segments */
+    while (1)
+    {
+        if (syn6288_queue_get_count(&gs_queue, &count) != 0)
+        {
+            return 1;
+        }
+        if (count == 0)
+        {
+            break;
+        }
+        if (a_stream_process() != 0)
+        {
+            return 1;
+        }
+        syn6288_interface_delay_ms(10);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      stream example get a segment record
+ * @param[in]  index segment index
+ * @param[out] *segment pointer to a segment buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 index is invalid
+ * @note       only the first SYN6288_STREAM_MAX_RECORD segments are recorded
+ */
+uint8_t syn6288_stream_get_segment(uint32_t index, syn6288_stream_segment_t *segment)
+{
+    if ((index >= gs_stats.segments) || (index >= SYN6288_STREAM_MAX_RECORD))
+    {
+        return 1;
+    }
+    *segment = gs_record[index];
+    
+    return 0;
+}
+
+/**
+ * @brief      stream example get the stats
+ * @param[out] *stats pointer to a stats buffer
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+uint8_t syn6288_stream_get_stats(syn6288_stream_stats_t *stats)
+{
+    syn6288_stats_t s;
+    
+    *stats = gs_stats;
+    stats->wait_avg = (gs_stats.done != 0) ? (gs_wait_sum / gs_stats.done) : 0;
+    stats->gap_avg = (gs_gap_num != 0) ? (gs_gap_sum / gs_gap_num) : 0;
+    if (syn6288_get_stats(&gs_handle, &s) == 0)
+    {
+        stats->frames = s.opcode[SYN6288_OPCODE_SYNTHESIS].frames - gs_frames;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  stream example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t syn6288_stream_deinit(void)
+{
+    uint8_t res;
+    
+    res = syn6288_queue_deinit(&gs_queue);
+    if (syn6288_deinit(&gs_handle) != 0)
+    {
+        res = 1;
+    }
+    
+    return (res != 0) ? 1 : 0;
+}
@@ -0,0 +1,197 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_syn6288_stream.h
+ * @brief     driver syn6288 stream header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SYN6288_STREAM_H
+#define DRIVER_SYN6288_STREAM_H
+
+#include "driver_syn6288_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup syn6288_example_driver
+ * @{
+ */
+
+/**
+ * @brief syn6288 stream max segment length definition
+ * @note  a segment fills at most one text frame
+ */
+#ifndef SYN6288_STREAM_MAX_LEN
+    #define SYN6288_STREAM_MAX_LEN 200        /**< 200 bytes */
+#endif
+
+/**
+ * @brief syn6288 stream max segment record definition
+ */
+#ifndef SYN6288_STREAM_MAX_RECORD
+    #define SYN6288_STREAM_MAX_RECORD 1024        /**< 1024 segments */
+#endif
+
+/**
+ * @brief syn6288 stream encoding enumeration definition
+ */
+typedef enum
+{
+    SYN6288_STREAM_ENCODING_GB2312  = 0x00,        /**< gb2312 */
+    SYN6288_STREAM_ENCODING_GBK     = 0x01,        /**< gbk */
+    SYN6288_STREAM_ENCODING_BIG5    = 0x02,        /**< big5 */
+    SYN6288_STREAM_ENCODING_UNICODE = 0x03,        /**< utf-16be */
+    SYN6288_STREAM_ENCODING_UTF8    = 0x04,        /**< utf-8 transcoded to unicode */
+} syn6288_stream_encoding_t;
+
+/**
+ * @brief syn6288 stream segment status enumeration definition
+ */
+typedef enum
+{
+    SYN6288_STREAM_SEGMENT_QUEUED  = 0x00,        /**< waiting or playing */
+    SYN6288_STREAM_SEGMENT_DONE    = 0x01,        /**< played */
+    SYN6288_STREAM_SEGMENT_DROPPED = 0x02,        /**< dropped */
+} syn6288_stream_segment_status_t;
+
+/**
+ * @brief syn6288 stream segment structure definition
+ */
+typedef struct syn6288_stream_segment_s
+{
+    uint32_t id;              /**< queue item id */
+    uint16_t len;             /**< encoded length */
+    uint32_t estimate;        /**< estimated duration in ms */
+    uint32_t push;            /**< push timestamp in ms */
+    uint32_t start;           /**< start timestamp in ms */
+    uint32_t done;            /**< done timestamp in ms */
+    uint8_t status;           /**< segment status */
+} syn6288_stream_segment_t;
+
+/**
+ * @brief syn6288 stream stats structure definition
+ */
+typedef struct syn6288_stream_stats_s
+{
+    uint32_t segments;        /**< pushed segments */
+    uint32_t bytes;           /**< encoded bytes */
+    uint32_t skipped;         /**< undecodable input bytes */
+    uint32_t done;            /**< played segments */
+    uint32_t dropped;         /**< dropped segments */
+    uint32_t frames;          /**< text frames sent to the chip */
+    uint32_t time;            /**< time from the first push to the last done in ms */
+    uint32_t wait_avg;        /**< average time from push to start in ms */
+    uint32_t wait_max;        /**< max time from push to start in ms */
+    uint32_t gap_avg;         /**< average silence between two segments in ms */
+    uint32_t gap_max;         /**< max silence between two segments in ms */
+} syn6288_stream_stats_t;
+
+/**
+ * @brief     stream example init
+ * @param[in] encoding input encoding
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t syn6288_stream_init(syn6288_stream_encoding_t encoding);
+
+/**
+ * @brief  stream example deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t syn6288_stream_deinit(void);
+
+/**
+ * @brief     stream example write
+ * @param[in] *buf pointer to an input buffer
+ * @param[in] len input buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the input is cut on sentence boundaries and the finished segments are queued,
+ *            a sentence or a character split across two writes is kept until the next write
+ */
+uint8_t syn6288_stream_write(uint8_t *buf, uint32_t len);
+
+/**
+ * @brief  stream example process
+ * @return status code
+ *         - 0 success
+ *         - 1 process failed
+ * @note   call this function while waiting for more input
+ */
+uint8_t syn6288_stream_process(void);
+
+/**
+ * @brief  stream example flush
+ * @return status code
+ *         - 0 success
+ *         - 1 flush failed
+ * @note   the last segment is queued and all segments are played
+ */
+uint8_t syn6288_stream_flush(void);
+
+/**
+ * @brief      stream example get a segment record
+ * @param[in]  index segment index
+ * @param[out] *segment pointer to a segment buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 index is invalid
+ * @note       only the first SYN6288_STREAM_MAX_RECORD segments are recorded
+ */
+uint8_t syn6288_stream_get_segment(uint32_t index, syn6288_stream_segment_t *segment);
+
+/**
+ * @brief      stream example get the stats
+ * @param[out] *stats pointer to a stats buffer
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+uint8_t syn6288_stream_get_stats(syn6288_stream_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
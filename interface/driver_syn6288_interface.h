@@ -114,6 +114,42 @@ void syn6288_interface_delay_ms(uint32_t ms);
  */
 void syn6288_interface_debug_print(const char *const fmt, ...);
 
+/**
+ * @brief  interface timestamp ms
+ * @return current monotonic time in ms
+ * @note   the value may wrap around
+ */
+uint32_t syn6288_interface_timestamp_ms(void);
+
+/**
+ * @brief     interface event
+ * @param[in] code event code
+ * @param[in] command command opcode
+ * @param[in] value event value
+ * @note      the event is kept in a ring, the oldest event is overwritten when the ring is full
+ */
+void syn6288_interface_event(uint8_t code, uint8_t command, uint32_t value);
+
+/**
+ * @brief      interface event read
+ * @param[out] *code pointer to an event code buffer
+ * @param[out] *command pointer to a command opcode buffer
+ * @param[out] *value pointer to an event value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no event
+ * @note       events are read from the oldest one
+ */
+uint8_t syn6288_interface_event_read(uint8_t *code, uint8_t *command, uint32_t *value);
+
+/**
+ * @brief     interface receive callback
+ * @param[in] type event type
+ * @param[in] id item id
+ * @note      none
+ */
+void syn6288_interface_receive_callback(uint8_t type, uint32_t id);
+
 /**
  * @}
  */
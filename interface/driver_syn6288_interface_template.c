@@ -36,6 +36,26 @@
  */
 
 #include "driver_syn6288_interface.h"
+#include "driver_syn6288_queue.h"
+
+/**
+ * @brief interface event ring definition
+ */
+#define SYN6288_INTERFACE_EVENT_MAX    16        /**< event ring size */
+
+/**
+ * @brief interface event structure definition
+ */
+typedef struct syn6288_interface_event_s
+{
+    uint8_t code;           /**< event code */
+    uint8_t command;        /**< command opcode */
+    uint32_t value;         /**< event value */
+} syn6288_interface_event_t;
+
+static syn6288_interface_event_t gs_event[SYN6288_INTERFACE_EVENT_MAX];        /**< event ring */
+static volatile uint32_t gs_event_write = 0;                                   /**< written event count */
+static volatile uint32_t gs_event_read = 0;                                    /**< read event count */
 
 /**
  * @brief  interface uart init
@@ -120,3 +140,105 @@ void syn6288_interface_debug_print(const char *const fmt, ...)
 {
     
 }
+
+/**
+ * @brief  interface timestamp ms
+ * @return current monotonic time in ms
+ * @note   the value may wrap around
+ */
+uint32_t syn6288_interface_timestamp_ms(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     interface event
+ * @param[in] code event code
+ * @param[in] command command opcode
+ * @param[in] value event value
+ * @note      the event is kept in a ring, the oldest event is overwritten when the ring is full
+ */
+void syn6288_interface_event(uint8_t code, uint8_t command, uint32_t value)
+{
+    uint32_t i;
+    
+    i = gs_event_write % SYN6288_INTERFACE_EVENT_MAX;
+    gs_event[i].code = code;
+    gs_event[i].command = command;
+    gs_event[i].value = value;
+    gs_event_write++;
+    if ((gs_event_write - gs_event_read) > SYN6288_INTERFACE_EVENT_MAX)
+    {
+        gs_event_read = gs_event_write - SYN6288_INTERFACE_EVENT_MAX;
+    }
+}
+
+/**
+ * @brief      interface event read
+ * @param[out] *code pointer to an event code buffer
+ * @param[out] *command pointer to a command opcode buffer
+ * @param[out] *value pointer to an event value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no event
+ * @note       none
+ */
+uint8_t syn6288_interface_event_read(uint8_t *code, uint8_t *command, uint32_t *value)
+{
+    uint32_t i;
+    
+    if (gs_event_read == gs_event_write)
+    {
+        return 1;
+    }
+    i = gs_event_read % SYN6288_INTERFACE_EVENT_MAX;
+    *code = gs_event[i].code;
+    *command = gs_event[i].command;
+    *value = gs_event[i].value;
+    gs_event_read++;
+    
+    return 0;
+}
+
+/**
+ * @brief     interface receive callback
+ * @param[in] type event type
+ * @param[in] id item id
+ * @note      none
+ */
+void syn6288_interface_receive_callback(uint8_t type, uint32_t id)
+{
+    switch (type)
+    {
+        case SYN6288_QUEUE_EVENT_START :
+        {
+            syn6288_interface_debug_print("syn6288: irq item %u start.\n", id);
+            
+            break;
+        }
+        case SYN6288_QUEUE_EVENT_DONE :
+        {
+            syn6288_interface_debug_print("syn6288: irq item %u done.\n", id);
+            
+            break;
+        }
+        case SYN6288_QUEUE_EVENT_DROP :
+        {
+            syn6288_interface_debug_print("syn6288: irq item %u drop.\n", id);
+            
+            break;
+        }
+        case SYN6288_QUEUE_EVENT_PREEMPT :
+        {
+            syn6288_interface_debug_print("syn6288: irq item %u preempt.\n", id);
+            
+            break;
+        }
+        default :
+        {
+            syn6288_interface_debug_print("syn6288: unknown code.\n");
+            
+            break;
+        }
+    }
+}
@@ -0,0 +1,1281 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      main.c
+ * @brief     main source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_syn6288_queue.h"
+#include "bench_driver_syn6288_interface.h"
+#include <getopt.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief bench definition
+ */
+#define BENCH_MAX_TIMES        256        /**< max samples of a case */
+#define BENCH_MAX_BAUD         3          /**< max baud rates */
+#define BENCH_MAX_SIZE         8          /**< max payload sizes */
+#define BENCH_MAX_QUEUE        64         /**< max queued announcements */
+#define BENCH_QUEUE_TICK       10         /**< queue process interval in ms */
+#define BENCH_QUEUE_TIMEOUT    600000     /**< queue run timeout in ms */
+#define BENCH_IDLE_RETRY       600        /**< max status polls of an idle wait */
+#define BENCH_IDLE_INTERVAL    100        /**< status poll interval of an idle wait in ms */
+#define BENCH_LINK_TIMEOUT     1000       /**< raw answer timeout in ms */
+
+/**
+ * @brief bench sample structure definition
+ */
+typedef struct bench_sample_s
+{
+    uint32_t num;                     /**< sample number */
+    uint32_t failed;                  /**< failed runs */
+    uint32_t us[BENCH_MAX_TIMES];     /**< samples in us */
+} bench_sample_t;
+
+/**
+ * @brief bench case structure definition
+ */
+typedef struct bench_case_s
+{
+    const char *name;                 /**< api name */
+    uint8_t (*before)(void);          /**< unmeasured setup, NULL means none */
+    uint8_t (*run)(void);             /**< measured call */
+    uint8_t (*after)(void);           /**< unmeasured cleanup, NULL means none */
+} bench_case_t;
+
+/**
+ * @brief global var definition
+ */
+static syn6288_handle_t gs_handle;                  /**< syn6288 handle */
+static syn6288_queue_t gs_queue;                    /**< syn6288 queue */
+static bench_sample_t gs_sample;                    /**< sample buffer */
+static bench_sample_t gs_sample_2;                  /**< second sample buffer */
+static uint8_t gs_json = 0;                         /**< json output flag */
+static uint32_t gs_baud = 9600;                     /**< current baud rate */
+static uint64_t gs_start[BENCH_MAX_QUEUE + 1];      /**< queue start time of each id in us */
+static uint64_t gs_done[BENCH_MAX_QUEUE + 1];       /**< queue done time of each id in us */
+static uint32_t gs_queue_done;                      /**< queue finished items */
+static char gs_text[256];                           /**< payload text */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in us
+ * @note   none
+ */
+static uint64_t a_bench_now(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+/**
+ * @brief     compare two samples
+ * @param[in] *a pointer to a sample
+ * @param[in] *b pointer to a sample
+ * @return    compare result
+ * @note      none
+ */
+static int a_bench_compare(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief     get a percentile of the sorted samples
+ * @param[in] *s pointer to a sample structure
+ * @param[in] permille percentile in permille
+ * @return    sample in ms
+ * @note      none
+ */
+static double a_bench_percentile(bench_sample_t *s, uint32_t permille)
+{
+    uint32_t i;
+    
+    if (s->num == 0)
+    {
+        return 0.0;
+    }
+    i = (s->num * permille + 999) / 1000;
+    
+    return (double)s->us[(i == 0) ? 0 : (i - 1)] / 1000.0;
+}
+
+/**
+ * @brief     print the result of a sample structure
+ * @param[in] *group pointer to a group name
+ * @param[in] *name pointer to a case name
+ * @param[in] size payload size
+ * @param[in] *s pointer to a sample structure
+ * @note      the samples are sorted
+ */
+static void a_bench_report(const char *group, const char *name, uint16_t size, bench_sample_t *s)
+{
+    qsort(s->us, s->num, sizeof(uint32_t), a_bench_compare);
+    if (gs_json != 0)
+    {
+        printf("{\"group\":\"%s\",\"name\":\"%s\",\"baud\":%u,\"size\":%u,\"num\":%u,\"failed\":%u,"
+               "\"min_ms\":%.3f,\"p50_ms\":%.3f,\"p99_ms\":%.3f,\"max_ms\":%.3f}\n",
+               group, name, (unsigned int)gs_baud, (unsigned int)size, (unsigned int)s->num, (unsigned int)s->failed,
+               a_bench_percentile(s, 0), a_bench_percentile(s, 500), a_bench_percentile(s, 990),
+               a_bench_percentile(s, 1000));
+    }
+    else
+    {
+        printf("%-8s %-42s %6u %4u  n %3u  fail %u  min %9.3f  p50 %9.3f  p99 %9.3f  max %9.3f ms\n",
+               group, name, (unsigned int)gs_baud, (unsigned int)size, (unsigned int)s->num, (unsigned int)s->failed,
+               a_bench_percentile(s, 0), a_bench_percentile(s, 500), a_bench_percentile(s, 990),
+               a_bench_percentile(s, 1000));
+    }
+}
+
+/**
+ * @brief     print a single value
+ * @param[in] *group pointer to a group name
+ * @param[in] *name pointer to a value name
+ * @param[in] value value
+ * @param[in] *unit pointer to a unit name
+ * @note      none
+ */
+static void a_bench_value(const char *group, const char *name, double value, const char *unit)
+{
+    if (gs_json != 0)
+    {
+        printf("{\"group\":\"%s\",\"name\":\"%s\",\"baud\":%u,\"value\":%.3f,\"unit\":\"%s\"}\n",
+               group, name, (unsigned int)gs_baud, value, unit);
+    }
+    else
+    {
+        printf("%-8s %-42s %6u       %.3f %s\n", group, name, (unsigned int)gs_baud, value, unit);
+    }
+}
+
+/**
+ * @brief  init the handle
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   none
+ */
+static uint8_t a_bench_init(void)
+{
+    /* link interface function */
+    DRIVER_SYN6288_LINK_INIT(&gs_handle, syn6288_handle_t);
+    DRIVER_SYN6288_LINK_UART_INIT(&gs_handle, syn6288_interface_uart_init);
+    DRIVER_SYN6288_LINK_UART_DEINIT(&gs_handle, syn6288_interface_uart_deinit);
+    DRIVER_SYN6288_LINK_UART_READ(&gs_handle, syn6288_interface_uart_read);
+    DRIVER_SYN6288_LINK_UART_WRITE(&gs_handle, syn6288_interface_uart_write);
+    DRIVER_SYN6288_LINK_UART_FLUSH(&gs_handle, syn6288_interface_uart_flush);
+    DRIVER_SYN6288_LINK_DELAY_MS(&gs_handle, syn6288_interface_delay_ms);
+    DRIVER_SYN6288_LINK_DEBUG_PRINT(&gs_handle, syn6288_interface_debug_print);
+    DRIVER_SYN6288_LINK_TIMESTAMP_MS(&gs_handle, syn6288_interface_timestamp_ms);
+    DRIVER_SYN6288_LINK_EVENT(&gs_handle, syn6288_interface_event);
+    
+    return syn6288_init(&gs_handle);
+}
+
+/**
+ * @brief     get the rate of a baud rate
+ * @param[in] baud baud rate
+ * @return    syn6288 baud rate
+ * @note      none
+ */
+static syn6288_baud_rate_t a_bench_rate(uint32_t baud)
+{
+    if (baud == 38400)
+    {
+        return SYN6288_BAUD_RATE_38400_BPS;
+    }
+    else if (baud == 19200)
+    {
+        return SYN6288_BAUD_RATE_19200_BPS;
+    }
+    else
+    {
+        return SYN6288_BAUD_RATE_9600_BPS;
+    }
+}
+
+/**
+ * @brief  wait until the chip is idle
+ * @return status code
+ *         - 0 success
+ *         - 1 wait failed
+ * @note   the answers are polled, so the status is read every BENCH_IDLE_INTERVAL ms
+ */
+static uint8_t a_bench_idle(void)
+{
+    uint16_t i;
+    syn6288_status_t status;
+    
+    for (i = 0; i < BENCH_IDLE_RETRY; i++)
+    {
+        if (syn6288_get_status(&gs_handle, &status) != 0)
+        {
+            return 1;
+        }
+        if (status == SYN6288_STATUS_OK)
+        {
+            return 0;
+        }
+        syn6288_interface_delay_ms(BENCH_IDLE_INTERVAL);
+    }
+    
+    return 1;
+}
+
+/**
+ * @brief  get the status
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_status(void)
+{
+    syn6288_status_t status;
+    
+    return syn6288_get_status(&gs_handle, &status);
+}
+
+/**
+ * @brief  synthesis the payload text
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_text(void)
+{
+    return syn6288_synthesis_text(&gs_handle, gs_text);
+}
+
+/**
+ * @brief  synthesis a sound
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_sound(void)
+{
+    return syn6288_synthesis_sound(&gs_handle, SYN6288_SOUND_A);
+}
+
+/**
+ * @brief  synthesis a message
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_message(void)
+{
+    return syn6288_synthesis_message(&gs_handle, SYN6288_MESSAGE_A);
+}
+
+/**
+ * @brief  synthesis a ring
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_ring(void)
+{
+    return syn6288_synthesis_ring(&gs_handle, SYN6288_RING_A);
+}
+
+/**
+ * @brief  synthesis a sound, a text and a ring sequence
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_sequence(void)
+{
+    syn6288_sequence_item_t item[3] =
+    {
+        {SYN6288_SEQUENCE_TYPE_SOUND, SYN6288_SOUND_A, NULL, 0},
+        {SYN6288_SEQUENCE_TYPE_TEXT, 0, "bench", 0},
+        {SYN6288_SEQUENCE_TYPE_RING, SYN6288_RING_A, NULL, 0},
+    };
+    
+    return syn6288_synthesis_sequence(&gs_handle, item, 3);
+}
+
+/**
+ * @brief  synthesis the payload buffer
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_buffer(void)
+{
+    return syn6288_synthesis_buffer(&gs_handle, (uint8_t *)gs_text, (uint16_t)strlen(gs_text));
+}
+
+/**
+ * @brief  barge in the payload text
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_barge_in(void)
+{
+    return syn6288_barge_in(&gs_handle, gs_text);
+}
+
+/**
+ * @brief  barge in the payload buffer
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_barge_in_buffer(void)
+{
+    return syn6288_barge_in_buffer(&gs_handle, (uint8_t *)gs_text, (uint16_t)strlen(gs_text));
+}
+
+/**
+ * @brief  stop the playback
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_stop(void)
+{
+    return syn6288_stop(&gs_handle);
+}
+
+/**
+ * @brief  pause the playback
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_pause(void)
+{
+    return syn6288_pause(&gs_handle);
+}
+
+/**
+ * @brief  synthesis the payload text and pause it
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_text_pause(void)
+{
+    if (a_bench_text() != 0)
+    {
+        return 1;
+    }
+    
+    return a_bench_pause();
+}
+
+/**
+ * @brief  resume the playback
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_resume(void)
+{
+    return syn6288_resume(&gs_handle);
+}
+
+/**
+ * @brief  power down the chip
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_power_down(void)
+{
+    return syn6288_power_down(&gs_handle);
+}
+
+/**
+ * @brief  wake up the chip
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_wake_up(void)
+{
+    return syn6288_wake_up(&gs_handle);
+}
+
+/**
+ * @brief  set the text type
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_set_text_type(void)
+{
+    return syn6288_set_text_type(&gs_handle, SYN6288_TYPE_GB2312);
+}
+
+/**
+ * @brief  get the text type
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_get_text_type(void)
+{
+    syn6288_type_t type;
+    
+    return syn6288_get_text_type(&gs_handle, &type);
+}
+
+/**
+ * @brief  set the baud rate
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_set_baud_rate(void)
+{
+    return syn6288_set_baud_rate(&gs_handle, a_bench_rate(gs_baud));
+}
+
+/**
+ * @brief  get the baud rate
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_get_baud_rate(void)
+{
+    syn6288_baud_rate_t rate;
+    
+    return syn6288_get_baud_rate(&gs_handle, &rate);
+}
+
+/**
+ * @brief  set the mode
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_set_mode(void)
+{
+    return syn6288_set_mode(&gs_handle, SYN6288_MODE_COMMON);
+}
+
+/**
+ * @brief  get the mode
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_get_mode(void)
+{
+    syn6288_mode_t mode;
+    
+    return syn6288_get_mode(&gs_handle, &mode);
+}
+
+/**
+ * @brief  set the synthesis volume
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_set_synthesis_volume(void)
+{
+    return syn6288_set_synthesis_volume(&gs_handle, 10);
+}
+
+/**
+ * @brief  get the synthesis volume
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_get_synthesis_volume(void)
+{
+    uint8_t volume;
+    
+    return syn6288_get_synthesis_volume(&gs_handle, &volume);
+}
+
+/**
+ * @brief  set the background volume
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_set_background_volume(void)
+{
+    return syn6288_set_background_volume(&gs_handle, 0);
+}
+
+/**
+ * @brief  get the background volume
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_get_background_volume(void)
+{
+    uint8_t volume;
+    
+    return syn6288_get_background_volume(&gs_handle, &volume);
+}
+
+/**
+ * @brief  set the synthesis speed
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_set_synthesis_speed(void)
+{
+    return syn6288_set_synthesis_speed(&gs_handle, 5);
+}
+
+/**
+ * @brief  get the synthesis speed
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_get_synthesis_speed(void)
+{
+    uint8_t speed;
+    
+    return syn6288_get_synthesis_speed(&gs_handle, &speed);
+}
+
+/**
+ * @brief  set a command
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_set_command(void)
+{
+    return syn6288_set_command(&gs_handle, "[v10]");
+}
+
+/**
+ * @brief  get the stats
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_get_stats(void)
+{
+    syn6288_stats_t stats;
+    
+    return syn6288_get_stats(&gs_handle, &stats);
+}
+
+/**
+ * @brief  reset the stats
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_reset_stats(void)
+{
+    return syn6288_reset_stats(&gs_handle);
+}
+
+/**
+ * @brief  get the chip information
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_info(void)
+{
+    syn6288_info_t info;
+    
+    return syn6288_info(&info);
+}
+
+/**
+ * @brief  deinit and init the handle
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   none
+ */
+static uint8_t a_bench_reinit(void)
+{
+    if (syn6288_deinit(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    
+    return a_bench_init();
+}
+
+/**
+ * @brief      build a raw frame
+ * @param[out] *frame pointer to a frame buffer
+ * @param[in]  cmd command
+ * @param[in]  *data pointer to the param and the data
+ * @param[in]  len param and data length
+ * @return     frame length
+ * @note       none
+ */
+static uint16_t a_bench_frame(uint8_t *frame, uint8_t cmd, const uint8_t *data, uint16_t len)
+{
+    uint16_t i;
+    uint8_t xor_cal = 0;
+    
+    frame[0] = 0xFD;
+    frame[1] = (uint8_t)((len + 2) / 256);
+    frame[2] = (uint8_t)((len + 2) % 256);
+    frame[3] = cmd;
+    for (i = 0; i < len; i++)
+    {
+        frame[4 + i] = data[i];
+    }
+    for (i = 0; i < len + 4; i++)
+    {
+        xor_cal ^= frame[i];
+    }
+    frame[len + 4] = xor_cal;
+    
+    return (uint16_t)(len + 5);
+}
+
+/**
+ * @brief      write a raw frame and time its answer
+ * @param[in]  *frame pointer to a frame
+ * @param[in]  len frame length
+ * @param[in]  num answer length
+ * @param[out] *ack_us pointer to a first answer byte time buffer
+ * @param[out] *done_us pointer to a last answer byte time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 probe failed
+ * @note       the uart is polled every 1 ms from the write, the driver is bypassed
+ */
+static uint8_t a_bench_probe(uint8_t *frame, uint16_t len, uint8_t num, uint32_t *ack_us, uint32_t *done_us)
+{
+    uint8_t got;
+    uint8_t answer[2];
+    uint64_t start;
+    uint64_t now;
+    
+    if (syn6288_interface_uart_flush() != 0)
+    {
+        return 1;
+    }
+    if (syn6288_interface_uart_write(frame, len) != 0)
+    {
+        return 1;
+    }
+    start = a_bench_now();
+    got = 0;
+    *ack_us = 0xFFFFFFFFU;
+    while (1)
+    {
+        got = (uint8_t)(got + syn6288_interface_uart_read(&answer[got], (uint16_t)(num - got)));
+        now = a_bench_now();
+        if ((got != 0) && (*ack_us == 0xFFFFFFFFU))
+        {
+            *ack_us = (uint32_t)(now - start);
+        }
+        if (got >= num)
+        {
+            *done_us = (uint32_t)(now - start);
+            
+            break;
+        }
+        if ((now - start) > (uint64_t)BENCH_LINK_TIMEOUT * 1000)
+        {
+            return 1;
+        }
+        syn6288_interface_delay_ms(1);
+    }
+    
+    return (answer[0] == 0x41) ? 0 : 1;
+}
+
+/**
+ * @brief     time the raw answers of the status query and the payload text
+ * @param[in] times run times
+ * @note      the ack and the round trip of the status and the ack of the text are reported
+ */
+static void a_bench_link(uint32_t times)
+{
+    uint32_t i;
+    uint32_t ack;
+    uint32_t done;
+    uint16_t len;
+    uint8_t frame[5 + 256];
+    uint8_t data[256];
+    
+    memset(&gs_sample, 0, sizeof(bench_sample_t));
+    memset(&gs_sample_2, 0, sizeof(bench_sample_t));
+    len = a_bench_frame(frame, 0x21, NULL, 0);
+    for (i = 0; i < times; i++)
+    {
+        if (a_bench_probe(frame, len, 2, &ack, &done) != 0)
+        {
+            gs_sample.failed++;
+            gs_sample_2.failed++;
+            
+            continue;
+        }
+        gs_sample.us[gs_sample.num++] = ack;
+        gs_sample_2.us[gs_sample_2.num++] = done;
+    }
+    a_bench_report("link", "status_ack", 0, &gs_sample);
+    a_bench_report("link", "status_round_trip", 0, &gs_sample_2);
+    
+    memset(&gs_sample, 0, sizeof(bench_sample_t));
+    data[0] = 0x00;
+    memcpy(&data[1], gs_text, strlen(gs_text));
+    len = a_bench_frame(frame, 0x01, data, (uint16_t)(strlen(gs_text) + 1));
+    for (i = 0; i < times; i++)
+    {
+        if (a_bench_probe(frame, len, 1, &ack, &done) != 0)
+        {
+            gs_sample.failed++;
+        }
+        else
+        {
+            gs_sample.us[gs_sample.num++] = ack;
+        }
+        (void)a_bench_stop();
+    }
+    a_bench_report("link", "text_ack", (uint16_t)strlen(gs_text), &gs_sample);
+}
+
+/**
+ * @brief bench case list
+ */
+static const bench_case_t gs_case[] =
+{
+    {"syn6288_info", NULL, a_bench_info, NULL},
+    {"syn6288_deinit/syn6288_init", NULL, a_bench_reinit, NULL},
+    {"syn6288_get_status", NULL, a_bench_status, NULL},
+    {"syn6288_synthesis_text", NULL, a_bench_text, a_bench_stop},
+    {"syn6288_synthesis_buffer", NULL, a_bench_buffer, a_bench_stop},
+    {"syn6288_synthesis_sound", NULL, a_bench_sound, a_bench_stop},
+    {"syn6288_synthesis_message", NULL, a_bench_message, a_bench_stop},
+    {"syn6288_synthesis_ring", NULL, a_bench_ring, a_bench_stop},
+    {"syn6288_synthesis_sequence", NULL, a_bench_sequence, a_bench_stop},
+    {"syn6288_barge_in", a_bench_text, a_bench_barge_in, a_bench_stop},
+    {"syn6288_barge_in_buffer", a_bench_text, a_bench_barge_in_buffer, a_bench_stop},
+    {"syn6288_stop", a_bench_text, a_bench_stop, NULL},
+    {"syn6288_pause", a_bench_text, a_bench_pause, a_bench_stop},
+    {"syn6288_resume", a_bench_text_pause, a_bench_resume, a_bench_stop},
+    {"syn6288_power_down", NULL, a_bench_power_down, a_bench_wake_up},
+    {"syn6288_wake_up", a_bench_power_down, a_bench_wake_up, NULL},
+    {"syn6288_set_text_type", NULL, a_bench_set_text_type, NULL},
+    {"syn6288_get_text_type", NULL, a_bench_get_text_type, NULL},
+    {"syn6288_set_baud_rate", NULL, a_bench_set_baud_rate, NULL},
+    {"syn6288_get_baud_rate", NULL, a_bench_get_baud_rate, NULL},
+    {"syn6288_set_mode", NULL, a_bench_set_mode, NULL},
+    {"syn6288_get_mode", NULL, a_bench_get_mode, NULL},
+    {"syn6288_set_synthesis_volume", NULL, a_bench_set_synthesis_volume, NULL},
+    {"syn6288_get_synthesis_volume", NULL, a_bench_get_synthesis_volume, NULL},
+    {"syn6288_set_background_volume", NULL, a_bench_set_background_volume, NULL},
+    {"syn6288_get_background_volume", NULL, a_bench_get_background_volume, NULL},
+    {"syn6288_set_synthesis_speed", NULL, a_bench_set_synthesis_speed, NULL},
+    {"syn6288_get_synthesis_speed", NULL, a_bench_get_synthesis_speed, NULL},
+    {"syn6288_set_command", NULL, a_bench_set_command, a_bench_stop},
+    {"syn6288_get_stats", NULL, a_bench_get_stats, NULL},
+    {"syn6288_reset_stats", NULL, a_bench_reset_stats, NULL},
+};
+
+/**
+ * @brief     fill the payload text
+ * @param[in] size text length
+ * @note      words of ascii letters split by spaces
+ */
+static void a_bench_fill(uint16_t size)
+{
+    uint16_t i;
+    
+    for (i = 0; i < size; i++)
+    {
+        gs_text[i] = ((i % 6) == 5) ? ' ' : (char)('a' + (i % 26));
+    }
+    gs_text[size] = '\0';
+}
+
+/**
+ * @brief     run one case
+ * @param[in] *c pointer to a case structure
+ * @param[in] times run times
+ * @return    status code
+ *            - 0 success
+ *            - 1 handle is lost
+ * @note      none
+ */
+static uint8_t a_bench_case(const bench_case_t *c, uint32_t times)
+{
+    uint32_t i;
+    uint64_t start;
+    
+    memset(&gs_sample, 0, sizeof(bench_sample_t));
+    for (i = 0; i < times; i++)
+    {
+        if ((c->before != NULL) && (c->before() != 0))
+        {
+            gs_sample.failed++;
+            
+            continue;
+        }
+        start = a_bench_now();
+        if (c->run() != 0)
+        {
+            gs_sample.failed++;
+        }
+        else
+        {
+            gs_sample.us[gs_sample.num++] = (uint32_t)(a_bench_now() - start);
+        }
+        if (c->after != NULL)
+        {
+            (void)c->after();
+        }
+        if (gs_handle.inited != 1)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     switch the chip and the host baud rate
+ * @param[in] baud baud rate
+ * @return    status code
+ *            - 0 success
+ *            - 1 switch failed
+ * @note      none
+ */
+static uint8_t a_bench_baud(uint32_t baud)
+{
+    uint64_t start;
+    
+    if (baud == gs_baud)
+    {
+        return 0;
+    }
+    start = a_bench_now();
+    if (syn6288_set_baud_rate(&gs_handle, a_bench_rate(baud)) != 0)
+    {
+        return 1;
+    }
+    (void)syn6288_deinit(&gs_handle);
+    syn6288_interface_set_baud(baud);
+    gs_baud = baud;
+    if (a_bench_init() != 0)
+    {
+        return 1;
+    }
+    if (a_bench_status() != 0)
+    {
+        return 1;
+    }
+    a_bench_value("baud", "switch", (double)(a_bench_now() - start) / 1000.0, "ms");
+    
+    return 0;
+}
+
+/**
+ * @brief     queue receive callback
+ * @param[in] type event type
+ * @param[in] id item id
+ * @note      none
+ */
+static void a_bench_receive(uint8_t type, uint32_t id)
+{
+    if (id > BENCH_MAX_QUEUE)
+    {
+        return;
+    }
+    if (type == SYN6288_QUEUE_EVENT_START)
+    {
+        gs_start[id] = a_bench_now();
+    }
+    else if ((type == SYN6288_QUEUE_EVENT_DONE) || (type == SYN6288_QUEUE_EVENT_DROP))
+    {
+        gs_done[id] = a_bench_now();
+        gs_queue_done++;
+    }
+    else
+    {
+        
+    }
+}
+
+/**
+ * @brief     run the queue bench
+ * @param[in] num announcement number
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the ids start from 1 after the queue init, the texts differ so that none is suppressed
+ */
+static uint8_t a_bench_queue(uint32_t num)
+{
+    uint32_t i;
+    uint32_t id;
+    char text[32];
+    uint64_t start;
+    uint64_t end;
+    uint64_t timeout;
+    
+    DRIVER_SYN6288_QUEUE_LINK_INIT(&gs_queue, syn6288_queue_t);
+    DRIVER_SYN6288_QUEUE_LINK_TIMESTAMP_MS(&gs_queue, syn6288_interface_timestamp_ms);
+    DRIVER_SYN6288_QUEUE_LINK_RECEIVE_CALLBACK(&gs_queue, a_bench_receive);
+    if (syn6288_queue_init(&gs_queue, &gs_handle) != 0)
+    {
+        return 1;
+    }
+    memset(gs_start, 0, sizeof(gs_start));
+    memset(gs_done, 0, sizeof(gs_done));
+    gs_queue_done = 0;
+    start = a_bench_now();
+    for (i = 0; i < num; i++)
+    {
+        (void)snprintf(text, sizeof(text), "announcement %u", (unsigned int)(i + 1));
+        if (syn6288_queue_push(&gs_queue, (uint8_t *)text, (uint16_t)strlen(text), &id) != 0)
+        {
+            break;
+        }
+    }
+    num = i;
+    timeout = start + (uint64_t)BENCH_QUEUE_TIMEOUT * 1000;
+    while ((gs_queue_done < num) && (a_bench_now() < timeout))
+    {
+        (void)syn6288_queue_process(&gs_queue);
+        syn6288_interface_delay_ms(BENCH_QUEUE_TICK);
+    }
+    end = a_bench_now();
+    (void)syn6288_queue_deinit(&gs_queue);
+    a_bench_value("queue", "announcements_per_minute", (double)gs_queue_done * 60000000.0 / (double)(end - start), "1/min");
+    
+    /* time to first audio and the gaps between the utterances */
+    memset(&gs_sample, 0, sizeof(bench_sample_t));
+    if (gs_start[1] != 0)
+    {
+        a_bench_value("queue", "time_to_first_audio", (double)(gs_start[1] - start) / 1000.0, "ms");
+    }
+    for (i = 2; i <= num; i++)
+    {
+        if ((gs_start[i] != 0) && (gs_done[i - 1] != 0) && (gs_start[i] >= gs_done[i - 1]))
+        {
+            gs_sample.us[gs_sample.num++] = (uint32_t)(gs_start[i] - gs_done[i - 1]);
+        }
+    }
+    a_bench_report("queue", "inter_utterance_gap", (uint16_t)strlen(text), &gs_sample);
+    
+    return 0;
+}
+
+/**
+ * @brief     parse a list of numbers
+ * @param[in] *str pointer to a list split by commas
+ * @param[out] *list pointer to a number list
+ * @param[in] max max number
+ * @return    number count
+ * @note      none
+ */
+static uint8_t a_bench_list(char *str, uint32_t *list, uint8_t max)
+{
+    uint8_t n = 0;
+    char *p;
+    
+    p = strtok(str, ",");
+    while ((p != NULL) && (n < max))
+    {
+        list[n++] = (uint32_t)strtoul(p, NULL, 10);
+        p = strtok(NULL, ",");
+    }
+    
+    return n;
+}
+
+/**
+ * @brief     print the help
+ * @note      none
+ */
+static void a_bench_help(void)
+{
+    printf("Usage:\n");
+    printf("  syn6288_bench [-d <path> | --device=<path>] [--baud=<list>] [--size=<list>] [--times=<n>]\n");
+    printf("                [--queue=<n>] [--json] [-v | --verbose]\n");
+    printf("  syn6288_bench (-h | --help)\n");
+    printf("\n");
+    printf("Options:\n");
+    printf("      --baud=<list>         Set the baud rates split by commas, 9600, 19200 or 38400.([default: 9600,19200,38400])\n");
+    printf("  -d <path>, --device=<path>\n");
+    printf("                            Set the uart device.([default: /dev/ttyS0])\n");
+    printf("  -h, --help                Show the help.\n");
+    printf("      --json                Print one json object per result.\n");
+    printf("      --queue=<n>           Set the queued announcements of each baud rate.([default: 10])\n");
+    printf("      --size=<list>         Set the payload sizes split by commas, 1 - 200.([default: 8,32,64,128,200])\n");
+    printf("      --times=<n>           Set the runs of each case, 1 - 256.([default: 10])\n");
+    printf("  -v, --verbose             Print the driver messages.\n");
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note      the chip must be at 9600 bps before the run and is set back to 9600 bps after it
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    uint8_t i;
+    uint8_t j;
+    uint8_t k;
+    uint8_t baud_num = 3;
+    uint8_t size_num = 5;
+    uint32_t times = 10;
+    uint32_t queue = 10;
+    uint32_t baud[BENCH_MAX_BAUD] = {9600, 19200, 38400};
+    uint32_t size[BENCH_MAX_SIZE] = {8, 32, 64, 128, 200};
+    const char short_options[] = "hvd:";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"verbose", no_argument, NULL, 'v'},
+        {"device", required_argument, NULL, 'd'},
+        {"baud", required_argument, NULL, 1},
+        {"size", required_argument, NULL, 2},
+        {"times", required_argument, NULL, 3},
+        {"queue", required_argument, NULL, 4},
+        {"json", no_argument, NULL, 5},
+        {NULL, 0, NULL, 0},
+    };
+    
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, short_options, long_options, &longindex)) != -1)
+    {
+        switch (c)
+        {
+            case 'd' :
+            {
+                syn6288_interface_set_device(optarg);
+                
+                break;
+            }
+            case 'v' :
+            {
+                syn6288_interface_set_print(1);
+                
+                break;
+            }
+            case 1 :
+            {
+                baud_num = a_bench_list(optarg, baud, BENCH_MAX_BAUD);
+                
+                break;
+            }
+            case 2 :
+            {
+                size_num = a_bench_list(optarg, size, BENCH_MAX_SIZE);
+                
+                break;
+            }
+            case 3 :
+            {
+                times = (uint32_t)strtoul(optarg, NULL, 10);
+                
+                break;
+            }
+            case 4 :
+            {
+                queue = (uint32_t)strtoul(optarg, NULL, 10);
+                
+                break;
+            }
+            case 5 :
+            {
+                gs_json = 1;
+                
+                break;
+            }
+            case 'h' :
+            {
+                a_bench_help();
+                
+                return 0;
+            }
+            default :
+            {
+                a_bench_help();
+                
+                return 1;
+            }
+        }
+    }
+    
+    /* check the args */
+    if ((times == 0) || (times > BENCH_MAX_TIMES) || (queue > BENCH_MAX_QUEUE))
+    {
+        printf("bench: times or queue is invalid.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < baud_num; i++)
+    {
+        if ((baud[i] != 9600) && (baud[i] != 19200) && (baud[i] != 38400))
+        {
+            printf("bench: baud %u is invalid.\n", (unsigned int)baud[i]);
+            
+            return 1;
+        }
+    }
+    for (i = 0; i < size_num; i++)
+    {
+        if ((size[i] == 0) || (size[i] > 200))
+        {
+            printf("bench: size %u is invalid.\n", (unsigned int)size[i]);
+            
+            return 1;
+        }
+    }
+    
+    /* init */
+    syn6288_interface_set_baud(9600);
+    if (a_bench_init() != 0)
+    {
+        printf("bench: init failed.\n");
+        
+        return 1;
+    }
+    if (a_bench_idle() != 0)
+    {
+        printf("bench: chip is not answering.\n");
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    for (i = 0; i < baud_num; i++)
+    {
+        if (a_bench_baud(baud[i]) != 0)
+        {
+            printf("bench: switch to %u bps failed.\n", (unsigned int)baud[i]);
+            
+            break;
+        }
+        
+        /* api round trip latency */
+        a_bench_fill(32);
+        for (j = 0; j < sizeof(gs_case) / sizeof(gs_case[0]); j++)
+        {
+            if (a_bench_case(&gs_case[j], times) != 0)
+            {
+                printf("bench: %s lost the handle.\n", gs_case[j].name);
+                
+                return 1;
+            }
+            a_bench_report("api", gs_case[j].name, (uint16_t)strlen(gs_text), &gs_sample);
+        }
+        
+        /* raw link answer time */
+        a_bench_link(times);
+        
+        /* payload sizes */
+        for (k = 0; k < size_num; k++)
+        {
+            bench_case_t text = {"syn6288_synthesis_text", NULL, a_bench_text, a_bench_stop};
+            
+            a_bench_fill((uint16_t)size[k]);
+            (void)a_bench_case(&text, times);
+            a_bench_report("payload", "syn6288_synthesis_text", (uint16_t)size[k], &gs_sample);
+            a_bench_value("payload", "time_to_first_audio_last", (double)gs_handle.stats.first_audio_last, "ms");
+        }
+        
+        /* queue */
+        if ((queue != 0) && (a_bench_idle() == 0))
+        {
+            (void)a_bench_queue(queue);
+        }
+    }
+    
+    /* back to 9600 bps */
+    (void)a_bench_baud(9600);
+    (void)syn6288_deinit(&gs_handle);
+    
+    return 0;
+}
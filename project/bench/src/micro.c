@@ -0,0 +1,511 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      micro.c
+ * @brief     micro source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_syn6288_queue.h"
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/**
+ * @brief micro definition
+ */
+#define MICRO_MAX_SIZE        8          /**< max payload sizes */
+#define MICRO_SEQUENCE_LEN    16         /**< prompt tones of the sequence case */
+
+/**
+ * @brief micro case structure definition
+ */
+typedef struct micro_case_s
+{
+    const char *name;                   /**< case name */
+    uint8_t (*run)(uint16_t size);      /**< measured call, returns 0 on success */
+    uint8_t sized;                      /**< 1 if the case runs for each payload size */
+} micro_case_t;
+
+/**
+ * @brief global var definition
+ */
+static syn6288_handle_t gs_handle;                  /**< syn6288 handle */
+static char gs_text[256];                           /**< payload text */
+static uint64_t gs_bytes;                           /**< written bytes */
+static uint32_t gs_clock;                           /**< fake clock in ms */
+static volatile uint32_t gs_sink;                   /**< result sink */
+
+/**
+ * @brief  null link uart init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_micro_uart_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  null link uart deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_micro_uart_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief      null link uart read
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     read length
+ * @note       every read is an ack
+ */
+static uint16_t a_micro_uart_read(uint8_t *buf, uint16_t len)
+{
+    memset(buf, 0x41, len);
+    
+    return len;
+}
+
+/**
+ * @brief  null link uart flush
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_micro_uart_flush(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     null link uart write
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ * @note      the frame is consumed by the sink
+ */
+static uint8_t a_micro_uart_write(uint8_t *buf, uint16_t len)
+{
+    gs_sink ^= buf[len - 1];
+    gs_bytes += len;
+    
+    return 0;
+}
+
+/**
+ * @brief     null link delay ms
+ * @param[in] ms time
+ * @note      the fake clock advances without waiting
+ */
+static void a_micro_delay_ms(uint32_t ms)
+{
+    gs_clock += ms;
+}
+
+/**
+ * @brief     null link print
+ * @param[in] fmt format data
+ * @note      none
+ */
+static void a_micro_debug_print(const char *const fmt, ...)
+{
+    (void)fmt;
+}
+
+/**
+ * @brief  null link timestamp ms
+ * @return fake clock in ms
+ * @note   none
+ */
+static uint32_t a_micro_timestamp_ms(void)
+{
+    return gs_clock;
+}
+
+/**
+ * @brief  get the monotonic time
+ * @return time in ns
+ * @note   none
+ */
+static uint64_t a_micro_now(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief     fill the payload text
+ * @param[in] size text length
+ * @note      words of ascii letters split by spaces and a comma or a full stop every 24 chars
+ */
+static void a_micro_fill(uint16_t size)
+{
+    uint16_t i;
+    
+    for (i = 0; i < size; i++)
+    {
+        if ((i % 24) == 23)
+        {
+            gs_text[i] = ((i % 48) == 47) ? '.' : ',';
+        }
+        else
+        {
+            gs_text[i] = ((i % 6) == 5) ? ' ' : (char)('a' + (i % 26));
+        }
+    }
+    gs_text[size] = '\0';
+}
+
+/**
+ * @brief     build and write a text frame
+ * @param[in] size text length
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      strlen, copy, xor and the stats of the driver
+ */
+static uint8_t a_micro_text(uint16_t size)
+{
+    (void)size;
+    
+    return syn6288_synthesis_text(&gs_handle, gs_text);
+}
+
+/**
+ * @brief     build and write a buffer frame
+ * @param[in] size text length
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_micro_buffer(uint16_t size)
+{
+    return syn6288_synthesis_buffer(&gs_handle, (uint8_t *)gs_text, size);
+}
+
+/**
+ * @brief     build and write the stop and the text frame
+ * @param[in] size text length
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      none
+ */
+static uint8_t a_micro_barge_in(uint16_t size)
+{
+    (void)size;
+    
+    return syn6288_barge_in(&gs_handle, gs_text);
+}
+
+/**
+ * @brief     compute the frame xor
+ * @param[in] size text length
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the checksum function of the driver over the header and the text
+ */
+static uint8_t a_micro_xor(uint16_t size)
+{
+    uint8_t xor_cal;
+    
+    if (syn6288_frame_xor((uint8_t *)gs_handle.buf, (uint16_t)(size + 5), &xor_cal) != 0)
+    {
+        return 1;
+    }
+    gs_sink ^= xor_cal;
+    
+    return 0;
+}
+
+/**
+ * @brief     walk the text segments and estimate the duration
+ * @param[in] size text length
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the char classifier of the queue segmentation
+ */
+static uint8_t a_micro_segment(uint16_t size)
+{
+    uint32_t ms;
+    
+    if (syn6288_queue_estimate_duration(SYN6288_TYPE_GB2312, 5, (uint8_t *)gs_text, size, &ms) != 0)
+    {
+        return 1;
+    }
+    gs_sink ^= ms;
+    
+    return 0;
+}
+
+/**
+ * @brief     encode prompt tones as unicode tokens and write the frame
+ * @param[in] size unused
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the ascii tokens are converted to big endian ucs-2
+ */
+static uint8_t a_micro_encode(uint16_t size)
+{
+    uint8_t i;
+    syn6288_sequence_item_t item[MICRO_SEQUENCE_LEN];
+    
+    (void)size;
+    for (i = 0; i < MICRO_SEQUENCE_LEN; i++)
+    {
+        item[i].type = ((i % 2) == 0) ? SYN6288_SEQUENCE_TYPE_SOUND : SYN6288_SEQUENCE_TYPE_RING;
+        item[i].index = (uint8_t)('a' + (i % 8));
+        item[i].text = NULL;
+        item[i].len = 0;
+    }
+    
+    return syn6288_synthesis_sequence(&gs_handle, item, MICRO_SEQUENCE_LEN);
+}
+
+/**
+ * @brief micro case list
+ */
+static const micro_case_t gs_case[] =
+{
+    {"frame_text", a_micro_text, 1},
+    {"frame_buffer", a_micro_buffer, 1},
+    {"frame_barge_in", a_micro_barge_in, 1},
+    {"checksum_xor", a_micro_xor, 1},
+    {"segment_walk", a_micro_segment, 1},
+    {"encode_unicode_sequence", a_micro_encode, 0},
+};
+
+/**
+ * @brief     run one case
+ * @param[in] *c pointer to a case structure
+ * @param[in] size payload size
+ * @param[in] ms minimal run time in ms
+ * @param[in] json json output flag
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the bytes are the written frame bytes, or the payload size when nothing is written
+ */
+static uint8_t a_micro_case(const micro_case_t *c, uint16_t size, uint32_t ms, uint8_t json)
+{
+    uint32_t i;
+    uint32_t batch = 64;
+    uint64_t n = 0;
+    uint64_t start;
+    uint64_t elapsed;
+    uint64_t bytes;
+    double ns;
+    
+    a_micro_fill(size);
+    if (c->run(size) != 0)
+    {
+        printf("micro: %s failed.\n", c->name);
+        
+        return 1;
+    }
+    gs_bytes = 0;
+    start = a_micro_now();
+    do
+    {
+        for (i = 0; i < batch; i++)
+        {
+            (void)c->run(size);
+        }
+        n += batch;
+        elapsed = a_micro_now() - start;
+    } while (elapsed < (uint64_t)ms * 1000000);
+    bytes = (gs_bytes != 0) ? gs_bytes : (n * (c->sized ? size : 0));
+    ns = (double)elapsed / (double)n;
+    if (json != 0)
+    {
+        printf("{\"name\":\"%s\",\"size\":%u,\"runs\":%llu,\"ns_per_op\":%.1f,\"bytes_per_ns\":%.4f}\n",
+               c->name, (unsigned int)size, (unsigned long long)n, ns, (double)bytes / (double)elapsed);
+    }
+    else
+    {
+        printf("%-24s %4u  runs %10llu  %10.1f ns/op  %8.4f bytes/ns\n",
+               c->name, (unsigned int)size, (unsigned long long)n, ns, (double)bytes / (double)elapsed);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     print the help
+ * @note      none
+ */
+static void a_micro_help(void)
+{
+    printf("Usage:\n");
+    printf("  syn6288_micro [--size=<list>] [--ms=<ms>] [--json]\n");
+    printf("  syn6288_micro (-h | --help)\n");
+    printf("\n");
+    printf("Options:\n");
+    printf("  -h, --help                Show the help.\n");
+    printf("      --json                Print one json object per result.\n");
+    printf("      --ms=<ms>             Set the minimal run time of each case.([default: 200])\n");
+    printf("      --size=<list>         Set the payload sizes split by commas, 1 - 200.([default: 8,32,64,128,200])\n");
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note      none
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    uint8_t i;
+    uint8_t j;
+    uint8_t json = 0;
+    uint8_t size_num = 5;
+    uint32_t ms = 200;
+    uint32_t size[MICRO_MAX_SIZE] = {8, 32, 64, 128, 200};
+    char *p;
+    const char short_options[] = "h";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"size", required_argument, NULL, 1},
+        {"ms", required_argument, NULL, 2},
+        {"json", no_argument, NULL, 3},
+        {NULL, 0, NULL, 0},
+    };
+    
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, short_options, long_options, &longindex)) != -1)
+    {
+        switch (c)
+        {
+            case 1 :
+            {
+                size_num = 0;
+                p = strtok(optarg, ",");
+                while ((p != NULL) && (size_num < MICRO_MAX_SIZE))
+                {
+                    size[size_num++] = (uint32_t)strtoul(p, NULL, 10);
+                    p = strtok(NULL, ",");
+                }
+                
+                break;
+            }
+            case 2 :
+            {
+                ms = (uint32_t)strtoul(optarg, NULL, 10);
+                
+                break;
+            }
+            case 3 :
+            {
+                json = 1;
+                
+                break;
+            }
+            case 'h' :
+            {
+                a_micro_help();
+                
+                return 0;
+            }
+            default :
+            {
+                a_micro_help();
+                
+                return 1;
+            }
+        }
+    }
+    for (i = 0; i < size_num; i++)
+    {
+        if ((size[i] == 0) || (size[i] > 200))
+        {
+            printf("micro: size %u is invalid.\n", (unsigned int)size[i]);
+            
+            return 1;
+        }
+    }
+    
+    /* link the null interface */
+    DRIVER_SYN6288_LINK_INIT(&gs_handle, syn6288_handle_t);
+    DRIVER_SYN6288_LINK_UART_INIT(&gs_handle, a_micro_uart_init);
+    DRIVER_SYN6288_LINK_UART_DEINIT(&gs_handle, a_micro_uart_deinit);
+    DRIVER_SYN6288_LINK_UART_READ(&gs_handle, a_micro_uart_read);
+    DRIVER_SYN6288_LINK_UART_WRITE(&gs_handle, a_micro_uart_write);
+    DRIVER_SYN6288_LINK_UART_FLUSH(&gs_handle, a_micro_uart_flush);
+    DRIVER_SYN6288_LINK_DELAY_MS(&gs_handle, a_micro_delay_ms);
+    DRIVER_SYN6288_LINK_DEBUG_PRINT(&gs_handle, a_micro_debug_print);
+    DRIVER_SYN6288_LINK_TIMESTAMP_MS(&gs_handle, a_micro_timestamp_ms);
+    if (syn6288_init(&gs_handle) != 0)
+    {
+        printf("micro: init failed.\n");
+        
+        return 1;
+    }
+    
+    /* run the cases */
+    for (i = 0; i < sizeof(gs_case) / sizeof(gs_case[0]); i++)
+    {
+        if (gs_case[i].sized == 0)
+        {
+            (void)a_micro_case(&gs_case[i], 0, ms, json);
+            
+            continue;
+        }
+        for (j = 0; j < size_num; j++)
+        {
+            (void)a_micro_case(&gs_case[i], (uint16_t)size[j], ms, json);
+        }
+    }
+    (void)syn6288_deinit(&gs_handle);
+    
+    return 0;
+}
@@ -0,0 +1,257 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      emulator_driver_syn6288_interface.c
+ * @brief     emulator driver syn6288 interface source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_syn6288_interface.h"
+#include "driver_syn6288_queue.h"
+#include "link.h"
+#include <stdarg.h>
+
+/**
+ * @brief interface event ring definition
+ */
+#define SYN6288_INTERFACE_EVENT_MAX    16        /**< event ring size */
+
+/**
+ * @brief interface event structure definition
+ */
+typedef struct syn6288_interface_event_s
+{
+    uint8_t code;           /**< event code */
+    uint8_t command;        /**< command opcode */
+    uint32_t value;         /**< event value */
+} syn6288_interface_event_t;
+
+static syn6288_interface_event_t gs_event[SYN6288_INTERFACE_EVENT_MAX];        /**< event ring */
+static volatile uint32_t gs_event_write = 0;                                   /**< written event count */
+static volatile uint32_t gs_event_read = 0;                                    /**< read event count */
+
+/**
+ * @brief  interface uart init
+ * @return status code
+ *         - 0 success
+ *         - 1 uart init failed
+ * @note   none
+ */
+uint8_t syn6288_interface_uart_init(void)
+{
+    return link_open(9600);
+}
+
+/**
+ * @brief  interface uart deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 uart deinit failed
+ * @note   none
+ */
+uint8_t syn6288_interface_uart_deinit(void)
+{
+    return link_close();
+}
+
+/**
+ * @brief      interface uart read
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint16_t syn6288_interface_uart_read(uint8_t *buf, uint16_t len)
+{
+    return link_read(buf, len);
+}
+
+/**
+ * @brief  interface uart flush
+ * @return status code
+ *         - 0 success
+ *         - 1 uart flush failed
+ * @note   none
+ */
+uint8_t syn6288_interface_uart_flush(void)
+{
+    return link_flush();
+}
+
+/**
+ * @brief     interface uart write
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t syn6288_interface_uart_write(uint8_t *buf, uint16_t len)
+{
+    return link_write(buf, len);
+}
+
+/**
+ * @brief     interface delay ms
+ * @param[in] ms time
+ * @note      none
+ */
+void syn6288_interface_delay_ms(uint32_t ms)
+{
+    link_delay_ms(ms);
+}
+
+/**
+ * @brief     interface print format data
+ * @param[in] fmt format data
+ * @note      none
+ */
+void syn6288_interface_debug_print(const char *const fmt, ...)
+{
+    char str[256];
+    va_list args;
+    
+    if (link_get_print() == 0)
+    {
+        return;
+    }
+    memset((char *)str, 0, sizeof(char) * 256); 
+    va_start(args, fmt);
+    vsnprintf((char *)str, 255, (char const *)fmt, args);
+    va_end(args);
+    
+    (void)printf("%s", str);
+}
+
+/**
+ * @brief  interface timestamp ms
+ * @return current virtual time in ms
+ * @note   the value may wrap around
+ */
+uint32_t syn6288_interface_timestamp_ms(void)
+{
+    return link_now();
+}
+
+/**
+ * @brief     interface event
+ * @param[in] code event code
+ * @param[in] command command opcode
+ * @param[in] value event value
+ * @note      the event is kept in a ring, the oldest event is overwritten when the ring is full
+ */
+void syn6288_interface_event(uint8_t code, uint8_t command, uint32_t value)
+{
+    uint32_t i;
+    
+    i = gs_event_write % SYN6288_INTERFACE_EVENT_MAX;
+    gs_event[i].code = code;
+    gs_event[i].command = command;
+    gs_event[i].value = value;
+    gs_event_write++;
+    if ((gs_event_write - gs_event_read) > SYN6288_INTERFACE_EVENT_MAX)
+    {
+        gs_event_read = gs_event_write - SYN6288_INTERFACE_EVENT_MAX;
+    }
+}
+
+/**
+ * @brief      interface event read
+ * @param[out] *code pointer to an event code buffer
+ * @param[out] *command pointer to a command opcode buffer
+ * @param[out] *value pointer to an event value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no event
+ * @note       none
+ */
+uint8_t syn6288_interface_event_read(uint8_t *code, uint8_t *command, uint32_t *value)
+{
+    uint32_t i;
+    
+    if (gs_event_read == gs_event_write)
+    {
+        return 1;
+    }
+    i = gs_event_read % SYN6288_INTERFACE_EVENT_MAX;
+    *code = gs_event[i].code;
+    *command = gs_event[i].command;
+    *value = gs_event[i].value;
+    gs_event_read++;
+    
+    return 0;
+}
+
+/**
+ * @brief     interface receive callback
+ * @param[in] type event type
+ * @param[in] id item id
+ * @note      none
+ */
+void syn6288_interface_receive_callback(uint8_t type, uint32_t id)
+{
+    switch (type)
+    {
+        case SYN6288_QUEUE_EVENT_START :
+        {
+            syn6288_interface_debug_print("syn6288: irq item %u start.\n", id);
+            
+            break;
+        }
+        case SYN6288_QUEUE_EVENT_DONE :
+        {
+            syn6288_interface_debug_print("syn6288: irq item %u done.\n", id);
+            
+            break;
+        }
+        case SYN6288_QUEUE_EVENT_DROP :
+        {
+            syn6288_interface_debug_print("syn6288: irq item %u drop.\n", id);
+            
+            break;
+        }
+        case SYN6288_QUEUE_EVENT_PREEMPT :
+        {
+            syn6288_interface_debug_print("syn6288: irq item %u preempt.\n", id);
+            
+            break;
+        }
+        default :
+        {
+            syn6288_interface_debug_print("syn6288: unknown code.\n");
+            
+            break;
+        }
+    }
+}
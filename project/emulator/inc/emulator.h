@@ -0,0 +1,269 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      emulator.h
+ * @brief     emulator header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef EMULATOR_H
+#define EMULATOR_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup emulator emulator function
+ * @brief    syn6288 protocol emulator modules
+ * @{
+ */
+
+/**
+ * @brief emulator buffer size definition
+ */
+#define EMULATOR_RX_MAX 512        /**< max buffered input bytes */
+#define EMULATOR_TX_MAX 64         /**< max pending output bytes */
+
+/**
+ * @brief emulator answer definition
+ */
+#define EMULATOR_ACK         0x41        /**< frame received */
+#define EMULATOR_ERROR       0x45        /**< frame is invalid */
+#define EMULATOR_BUSY        0x4E        /**< chip is playing */
+#define EMULATOR_IDLE        0x4F        /**< chip is idle */
+
+/**
+ * @brief emulator state enumeration definition
+ */
+typedef enum
+{
+    EMULATOR_STATE_IDLE     = 0x00,        /**< idle */
+    EMULATOR_STATE_PLAYING  = 0x01,        /**< playing */
+    EMULATOR_STATE_PAUSED   = 0x02,        /**< paused */
+    EMULATOR_STATE_SLEEPING = 0x03,        /**< powered down */
+    EMULATOR_STATE_WAKING   = 0x04,        /**< waking up */
+} emulator_state_t;
+
+/**
+ * @brief emulator fault enumeration definition
+ */
+typedef enum
+{
+    EMULATOR_FAULT_NONE    = 0x00,        /**< no fault */
+    EMULATOR_FAULT_DROP    = 0x01,        /**< the answers of the frame are lost */
+    EMULATOR_FAULT_CORRUPT = 0x02,        /**< the answers of the frame are corrupted */
+    EMULATOR_FAULT_DELAY   = 0x03,        /**< the answers of the frame are delayed by arg ms */
+    EMULATOR_FAULT_RESET   = 0x04,        /**< the chip resets instead of running the frame and boots in arg ms */
+    EMULATOR_FAULT_BAUD    = 0x05,        /**< the chip switches to arg bps after the frame */
+} emulator_fault_type_t;
+
+/**
+ * @brief emulator scripted fault structure definition
+ */
+typedef struct emulator_fault_s
+{
+    uint32_t frame;        /**< valid frame number counted from 1 */
+    uint8_t type;          /**< emulator_fault_type_t */
+    uint32_t arg;          /**< fault argument */
+} emulator_fault_t;
+
+/**
+ * @brief emulator config structure definition
+ */
+typedef struct emulator_config_s
+{
+    uint32_t ack_ms;               /**< ack latency after the frame is received in ms */
+    uint32_t status_ms;            /**< status answer latency after the ack in ms */
+    uint32_t wake_ms;              /**< wake up time after the first byte in sleep in ms */
+    uint32_t char_ms[6];           /**< spoken char duration of each speed in ms */
+    uint32_t short_pause_ms;       /**< comma pause in ms */
+    uint32_t long_pause_ms;        /**< full stop pause in ms */
+    uint32_t sound_ms;             /**< sound prompt duration in ms */
+    uint32_t message_ms;           /**< message prompt duration in ms */
+    uint32_t ring_ms;              /**< ring prompt duration in ms */
+    uint8_t idle_notify;           /**< 1 sends 0x4F when a playback ends */
+    uint16_t drop_rate;            /**< permille of frames with lost answers */
+    uint16_t corrupt_rate;         /**< permille of frames with corrupted answers */
+    uint16_t delay_rate;           /**< permille of frames with delayed answers */
+    uint32_t delay_ms;             /**< delay of the delayed answers in ms */
+    uint16_t reset_rate;           /**< permille of frames replaced by a spontaneous reset */
+    uint32_t reset_ms;             /**< boot time after a reset in ms */
+    uint32_t seed;                 /**< random seed of the faults */
+} emulator_config_t;
+
+/**
+ * @brief emulator stats structure definition
+ */
+typedef struct emulator_stats_s
+{
+    uint32_t frames;             /**< valid frames */
+    uint32_t bad_length;         /**< frames with a wrong length */
+    uint32_t bad_xor;            /**< frames with a wrong xor */
+    uint32_t bad_command;        /**< frames with an unknown command */
+    uint32_t junk;               /**< bytes dropped before a frame header */
+    uint32_t texts;              /**< text frames */
+    uint32_t status;             /**< status frames */
+    uint32_t wakes;              /**< wake ups */
+    uint32_t lost;               /**< bytes lost while sleeping */
+    uint32_t play_ms;            /**< simulated playback time in ms */
+    uint32_t dropped;            /**< frames with lost answers */
+    uint32_t corrupted;          /**< frames with corrupted answers */
+    uint32_t delayed;            /**< frames with delayed answers */
+    uint32_t resets;             /**< spontaneous resets */
+    uint32_t baud_faults;        /**< unannounced baud rate changes */
+} emulator_stats_t;
+
+/**
+ * @brief emulator structure definition
+ */
+typedef struct emulator_s
+{
+    emulator_config_t config;                /**< config */
+    emulator_stats_t stats;                  /**< stats */
+    uint8_t rx[EMULATOR_RX_MAX];             /**< input buffer */
+    uint16_t rx_len;                         /**< input length */
+    uint8_t tx[EMULATOR_TX_MAX];             /**< pending output bytes */
+    uint32_t tx_time[EMULATOR_TX_MAX];       /**< pending output due time */
+    uint8_t tx_head;                         /**< first pending output */
+    uint8_t tx_num;                          /**< pending output number */
+    uint8_t state;                           /**< chip state */
+    uint8_t speed;                           /**< current speed mark */
+    uint32_t baud;                           /**< current baud rate */
+    uint32_t play_end;                       /**< playback end time */
+    uint32_t pause_left;                     /**< playback left when paused */
+    uint32_t wake_end;                       /**< wake up end time */
+    uint32_t busy;                           /**< answers are not sent before this time */
+    uint32_t host_baud;                      /**< host baud rate, 0 means unknown */
+    uint32_t rand;                           /**< fault random state */
+    uint8_t fault;                           /**< fault of the running frame */
+    uint32_t fault_arg;                      /**< fault argument of the running frame */
+    const emulator_fault_t *script;          /**< scripted faults sorted by frame */
+    uint16_t script_num;                     /**< scripted fault number */
+    uint16_t script_pos;                     /**< next scripted fault */
+} emulator_t;
+
+/**
+ * @brief     get the default config
+ * @param[in] *config pointer to a config structure
+ * @note      the defaults follow the timing of a real module at 9600 bps
+ */
+void emulator_default_config(emulator_config_t *config);
+
+/**
+ * @brief     initialize the emulator
+ * @param[in] *emu pointer to an emulator structure
+ * @param[in] *config pointer to a config structure
+ * @note      none
+ */
+void emulator_init(emulator_t *emu, const emulator_config_t *config);
+
+/**
+ * @brief     set the scripted faults
+ * @param[in] *emu pointer to an emulator structure
+ * @param[in] *script pointer to a fault array sorted by frame
+ * @param[in] num fault number
+ * @note      a scripted fault replaces the random faults for its frame
+ */
+void emulator_set_script(emulator_t *emu, const emulator_fault_t *script, uint16_t num);
+
+/**
+ * @brief     set the host baud rate
+ * @param[in] *emu pointer to an emulator structure
+ * @param[in] baud host baud rate, 0 means unknown
+ * @note      bytes are garbled in both directions when the host and the chip rates differ
+ */
+void emulator_set_host_baud(emulator_t *emu, uint32_t baud);
+
+/**
+ * @brief     feed received bytes
+ * @param[in] *emu pointer to an emulator structure
+ * @param[in] now current time in ms
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    number of parsed frames
+ * @note      a frame split across calls is kept until the rest arrives
+ */
+uint16_t emulator_input(emulator_t *emu, uint32_t now, const uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      get the bytes to send
+ * @param[in]  *emu pointer to an emulator structure
+ * @param[in]  now current time in ms
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len buffer length
+ * @return     number of bytes due by now
+ * @note       none
+ */
+uint16_t emulator_output(emulator_t *emu, uint32_t now, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     get the time to the next event
+ * @param[in] *emu pointer to an emulator structure
+ * @param[in] now current time in ms
+ * @return    time in ms, 0xFFFFFFFF means no pending event
+ * @note      none
+ */
+uint32_t emulator_next(emulator_t *emu, uint32_t now);
+
+/**
+ * @brief     get the chip state
+ * @param[in] *emu pointer to an emulator structure
+ * @param[in] now current time in ms
+ * @return    emulator_state_t
+ * @note      none
+ */
+uint8_t emulator_get_state(emulator_t *emu, uint32_t now);
+
+/**
+ * @brief         estimate the playback time of a text
+ * @param[in]     *config pointer to a config structure
+ * @param[in]     type text type from the frame param
+ * @param[in,out] *speed pointer to the current speed, updated by speed marks
+ * @param[in]     *buf pointer to a text buffer
+ * @param[in]     len text length
+ * @return        playback time in ms
+ * @note          [tN] marks change the speed, soundX, msgX and ringX play prompt tones
+ */
+uint32_t emulator_duration(const emulator_config_t *config, uint8_t type, uint8_t *speed,
+                           const uint8_t *buf, uint16_t len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
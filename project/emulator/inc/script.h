@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      script.h
+ * @brief     script header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef SCRIPT_H
+#define SCRIPT_H
+
+#include "emulator.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup script script function
+ * @brief    emulator fault script modules
+ * @{
+ */
+
+/**
+ * @brief script max fault number definition
+ */
+#define SCRIPT_MAX 256        /**< 256 faults */
+
+/**
+ * @brief      load a fault script
+ * @param[in]  *path pointer to a script file path
+ * @param[out] *script pointer to a fault array
+ * @param[in]  max max fault number
+ * @return     fault number, -1 means the script is invalid
+ * @note       each line is "<frame> <drop|corrupt|delay|reset|baud> [arg]",
+ *             '#' starts a comment and the faults are sorted by frame
+ */
+int script_load(const char *path, emulator_fault_t *script, int max);
+
+/**
+ * @brief      apply a fault option
+ * @param[in]  *name pointer to an option name
+ * @param[in]  *arg pointer to an option argument
+ * @param[out] *config pointer to a config structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 unknown option
+ * @note       the options are drop, corrupt, delay, delay-ms, reset, reset-ms and seed
+ */
+int script_option(const char *name, const char *arg, emulator_config_t *config);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,193 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      link.c
+ * @brief     link source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "link.h"
+
+/**
+ * @brief global var definition
+ */
+static emulator_t gs_emu;               /**< emulator */
+static uint32_t gs_now = 0;             /**< virtual clock */
+static uint8_t gs_open = 0;             /**< open flag */
+static uint8_t gs_print = 1;            /**< print flag */
+
+/**
+ * @brief     initialize the link
+ * @param[in] *config pointer to an emulator config structure
+ * @param[in] *script pointer to a fault array sorted by frame
+ * @param[in] num fault number
+ * @note      the virtual clock restarts from 0
+ */
+void link_init(const emulator_config_t *config, const emulator_fault_t *script, uint16_t num)
+{
+    gs_now = 0;
+    gs_open = 0;
+    emulator_init(&gs_emu, config);
+    emulator_set_script(&gs_emu, script, num);
+}
+
+/**
+ * @brief  get the emulator behind the link
+ * @return pointer to an emulator structure
+ * @note   none
+ */
+emulator_t *link_get(void)
+{
+    return &gs_emu;
+}
+
+/**
+ * @brief     open the link
+ * @param[in] baud host baud rate
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+uint8_t link_open(uint32_t baud)
+{
+    emulator_set_host_baud(&gs_emu, baud);
+    gs_open = 1;
+    
+    return 0;
+}
+
+/**
+ * @brief  close the link
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t link_close(void)
+{
+    gs_open = 0;
+    
+    return 0;
+}
+
+/**
+ * @brief     write data to the emulator
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 link is closed
+ * @note      none
+ */
+uint8_t link_write(uint8_t *buf, uint16_t len)
+{
+    if (gs_open == 0)
+    {
+        return 1;
+    }
+    (void)emulator_input(&gs_emu, gs_now, buf, len);
+    
+    return 0;
+}
+
+/**
+ * @brief      read the answers due by the virtual time
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len buffer length
+ * @return     read length
+ * @note       none
+ */
+uint16_t link_read(uint8_t *buf, uint16_t len)
+{
+    if (gs_open == 0)
+    {
+        return 0;
+    }
+    
+    return emulator_output(&gs_emu, gs_now, buf, len);
+}
+
+/**
+ * @brief  drop the answers due by the virtual time
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+uint8_t link_flush(void)
+{
+    uint8_t buf[16];
+    
+    while (emulator_output(&gs_emu, gs_now, buf, sizeof(buf)) != 0)
+    {
+        
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     advance the virtual clock
+ * @param[in] ms time in ms
+ * @note      none
+ */
+void link_delay_ms(uint32_t ms)
+{
+    gs_now += ms;
+}
+
+/**
+ * @brief  get the virtual clock
+ * @return virtual time in ms
+ * @note   none
+ */
+uint32_t link_now(void)
+{
+    return gs_now;
+}
+
+/**
+ * @brief     enable or disable the debug print
+ * @param[in] enable 0 quiet, 1 print
+ * @note      none
+ */
+void link_set_print(uint8_t enable)
+{
+    gs_print = enable;
+}
+
+/**
+ * @brief  get the debug print status
+ * @return 0 quiet, 1 print
+ * @note   none
+ */
+uint8_t link_get_print(void)
+{
+    return gs_print;
+}
@@ -0,0 +1,883 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      emulator.c
+ * @brief     emulator source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "emulator.h"
+#include <string.h>
+
+/**
+ * @brief emulator frame definition
+ */
+#define EMULATOR_HEADER          0xFD        /**< frame header */
+#define EMULATOR_MIN_LEN         2           /**< command and xor */
+#define EMULATOR_MAX_LEN         203         /**< command, param, 200 bytes text and xor */
+
+/**
+ * @brief emulator char class definition
+ */
+#define EMULATOR_CLASS_SILENT         0x00        /**< silent char */
+#define EMULATOR_CLASS_CHAR           0x01        /**< spoken char */
+#define EMULATOR_CLASS_SHORT_PAUSE    0x02        /**< comma like punctuation */
+#define EMULATOR_CLASS_LONG_PAUSE     0x03        /**< full stop like punctuation */
+
+/**
+ * @brief emulator text type definition
+ */
+#define EMULATOR_TYPE_BIG5       0x02        /**< big5 */
+#define EMULATOR_TYPE_UNICODE    0x03        /**< unicode */
+
+/**
+ * @brief     check if a time is reached
+ * @param[in] now current time in ms
+ * @param[in] t checked time in ms
+ * @return    1 if reached, else 0
+ * @note      the time may wrap around
+ */
+static uint8_t a_emulator_reached(uint32_t now, uint32_t t)
+{
+    return ((int32_t)(now - t) >= 0) ? 1 : 0;
+}
+
+/**
+ * @brief     get the wire time of some bytes
+ * @param[in] *emu pointer to an emulator structure
+ * @param[in] len byte number
+ * @return    time in ms
+ * @note      one byte is 10 bits on the wire
+ */
+static uint32_t a_emulator_wire(emulator_t *emu, uint16_t len)
+{
+    return (uint32_t)len * 10000 / emu->baud;
+}
+
+/**
+ * @brief     get a random number
+ * @param[in] *emu pointer to an emulator structure
+ * @return    random number
+ * @note      xorshift32
+ */
+static uint32_t a_emulator_random(emulator_t *emu)
+{
+    emu->rand ^= emu->rand << 13;                                              /* shift */
+    emu->rand ^= emu->rand >> 17;                                              /* shift */
+    emu->rand ^= emu->rand << 5;                                               /* shift */
+    
+    return emu->rand;                                                          /* return the number */
+}
+
+/**
+ * @brief     check the baud rate mismatch
+ * @param[in] *emu pointer to an emulator structure
+ * @return    1 if the host and the chip rates differ, else 0
+ * @note      none
+ */
+static uint8_t a_emulator_mismatch(emulator_t *emu)
+{
+    return ((emu->host_baud != 0) && (emu->host_baud != emu->baud)) ? 1 : 0;
+}
+
+/**
+ * @brief     queue an answer byte
+ * @param[in] *emu pointer to an emulator structure
+ * @param[in] t due time in ms
+ * @param[in] byte answer byte
+ * @note      answers never overtake each other
+ */
+static void a_emulator_send(emulator_t *emu, uint32_t t, uint8_t byte)
+{
+    uint8_t i;
+    
+    if ((emu->tx_num >= EMULATOR_TX_MAX) || (emu->fault == EMULATOR_FAULT_DROP))    /* check the space */
+    {
+        return;                                                                /* drop the answer */
+    }
+    if (emu->fault == EMULATOR_FAULT_CORRUPT)                                  /* corrupted answer */
+    {
+        byte ^= 0x10;                                                          /* flip one bit */
+    }
+    else if (emu->fault == EMULATOR_FAULT_DELAY)                               /* delayed answer */
+    {
+        t += emu->fault_arg;                                                   /* add the delay */
+    }
+    else
+    {
+        
+    }
+    if (a_emulator_mismatch(emu) != 0)                                         /* wrong baud rate */
+    {
+        byte = (uint8_t)(~byte);                                               /* garbled on the wire */
+    }
+    if ((emu->tx_num != 0) && (a_emulator_reached(emu->busy, t) != 0))         /* keep the order */
+    {
+        t = emu->busy;                                                         /* after the last one */
+    }
+    i = (uint8_t)((emu->tx_head + emu->tx_num) % EMULATOR_TX_MAX);             /* get the tail */
+    emu->tx[i] = byte;                                                         /* save the byte */
+    emu->tx_time[i] = t;                                                       /* save the time */
+    emu->tx_num++;                                                             /* num++ */
+    emu->busy = t;                                                             /* save the last time */
+}
+
+/**
+ * @brief     update the chip state
+ * @param[in] *emu pointer to an emulator structure
+ * @param[in] now current time in ms
+ * @note      none
+ */
+static void a_emulator_update(emulator_t *emu, uint32_t now)
+{
+    if ((emu->state == EMULATOR_STATE_PLAYING) && (a_emulator_reached(now, emu->play_end) != 0))
+    {
+        emu->state = EMULATOR_STATE_IDLE;                                      /* playback ends */
+        if (emu->config.idle_notify != 0)                                      /* check the notify */
+        {
+            a_emulator_send(emu, emu->play_end, EMULATOR_IDLE);                /* send idle */
+        }
+    }
+    if ((emu->state == EMULATOR_STATE_WAKING) && (a_emulator_reached(now, emu->wake_end) != 0))
+    {
+        emu->state = EMULATOR_STATE_IDLE;                                      /* chip is awake */
+    }
+}
+
+/**
+ * @brief     get one char of a text
+ * @param[in] type text type
+ * @param[in] *buf pointer to a text buffer
+ * @param[in] len text length
+ * @param[in] pos char position
+ * @param[out] *c pointer to a char buffer
+ * @return    char length, 0 means the end of the text
+ * @note      none
+ */
+static uint16_t a_emulator_get_char(uint8_t type, const uint8_t *buf, uint16_t len, uint16_t pos, uint16_t *c)
+{
+    if (type == EMULATOR_TYPE_UNICODE)                                         /* unicode */
+    {
+        if (pos + 1 >= len)                                                    /* check the end */
+        {
+            return 0;                                                          /* end */
+        }
+        *c = (uint16_t)((buf[pos] << 8) | buf[pos + 1]);                       /* big endian */
+        
+        return 2;                                                              /* two bytes */
+    }
+    if (pos >= len)                                                            /* check the end */
+    {
+        return 0;                                                              /* end */
+    }
+    if ((buf[pos] >= 0x80) && (pos + 1 < len))                                 /* double byte char */
+    {
+        *c = (uint16_t)((buf[pos] << 8) | buf[pos + 1]);                       /* set the char */
+        
+        return 2;                                                              /* two bytes */
+    }
+    *c = buf[pos];                                                             /* ascii char */
+    
+    return 1;                                                                  /* one byte */
+}
+
+/**
+ * @brief     match an ascii name in a text
+ * @param[in] type text type
+ * @param[in] *buf pointer to a text buffer
+ * @param[in] len text length
+ * @param[in] pos match position
+ * @param[in] *name pointer to a name
+ * @return    matched length in bytes, 0 means no match
+ * @note      none
+ */
+static uint16_t a_emulator_match(uint8_t type, const uint8_t *buf, uint16_t len, uint16_t pos, const char *name)
+{
+    uint16_t l;
+    uint16_t c;
+    uint16_t p;
+    
+    p = pos;                                                                   /* init position */
+    while (*name != '\0')                                                      /* check each char */
+    {
+        l = a_emulator_get_char(type, buf, len, p, &c);                        /* get the char */
+        if ((l == 0) || (c != (uint8_t)(*name)))                               /* check the char */
+        {
+            return 0;                                                          /* no match */
+        }
+        p = (uint16_t)(p + l);                                                 /* next char */
+        name++;                                                                /* next name char */
+    }
+    
+    return (uint16_t)(p - pos);                                                /* return the length */
+}
+
+/**
+ * @brief     classify a char
+ * @param[in] type text type
+ * @param[in] c char
+ * @return    char class
+ * @note      none
+ */
+static uint8_t a_emulator_classify(uint8_t type, uint16_t c)
+{
+    if (c < 0x80)                                                              /* ascii */
+    {
+        if (((c >= '0') && (c <= '9')) || ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')))
+        {
+            return EMULATOR_CLASS_CHAR;                                        /* spoken */
+        }
+        if ((c == ',') || (c == ';') || (c == ':'))                            /* comma */
+        {
+            return EMULATOR_CLASS_SHORT_PAUSE;                                 /* short pause */
+        }
+        if ((c == '.') || (c == '!') || (c == '?'))                            /* full stop */
+        {
+            return EMULATOR_CLASS_LONG_PAUSE;                                  /* long pause */
+        }
+        
+        return EMULATOR_CLASS_SILENT;                                          /* silent */
+    }
+    if (type == EMULATOR_TYPE_UNICODE)                                         /* unicode */
+    {
+        if ((c == 0xFF0C) || (c == 0x3001) || (c == 0xFF1B) || (c == 0xFF1A))
+        {
+            return EMULATOR_CLASS_SHORT_PAUSE;                                 /* short pause */
+        }
+        if ((c == 0x3002) || (c == 0xFF01) || (c == 0xFF1F))
+        {
+            return EMULATOR_CLASS_LONG_PAUSE;                                  /* long pause */
+        }
+    }
+    else if (type == EMULATOR_TYPE_BIG5)                                       /* big5 */
+    {
+        if ((c == 0xA141) || (c == 0xA142) || (c == 0xA146) || (c == 0xA147))
+        {
+            return EMULATOR_CLASS_SHORT_PAUSE;                                 /* short pause */
+        }
+        if ((c == 0xA143) || (c == 0xA148) || (c == 0xA149))
+        {
+            return EMULATOR_CLASS_LONG_PAUSE;                                  /* long pause */
+        }
+    }
+    else                                                                       /* gb2312 and gbk */
+    {
+        if ((c == 0xA3AC) || (c == 0xA1A2) || (c == 0xA3BB) || (c == 0xA3BA))
+        {
+            return EMULATOR_CLASS_SHORT_PAUSE;                                 /* short pause */
+        }
+        if ((c == 0xA1A3) || (c == 0xA3A1) || (c == 0xA3BF))
+        {
+            return EMULATOR_CLASS_LONG_PAUSE;                                  /* long pause */
+        }
+    }
+    
+    return EMULATOR_CLASS_CHAR;                                                /* spoken */
+}
+
+/**
+ * @brief     run one valid frame
+ * @param[in] *emu pointer to an emulator structure
+ * @param[in] now current time in ms
+ * @param[in] *p pointer to the command and its params
+ * @param[in] n command and params length
+ * @note      none
+ */
+static void a_emulator_command(emulator_t *emu, uint32_t now, const uint8_t *p, uint16_t n)
+{
+    uint32_t t;
+    uint32_t d;
+    
+    t = now + a_emulator_wire(emu, (uint16_t)(n + 4)) + emu->config.ack_ms;   /* ack time */
+    a_emulator_update(emu, t);                                                 /* update the state */
+    switch (p[0])
+    {
+        case 0x01 :                                                            /* synthesis */
+        {
+            if ((n < 2) || ((p[1] & 0x07) > EMULATOR_TYPE_UNICODE))            /* check the param */
+            {
+                emu->stats.bad_command++;                                      /* bad command */
+                a_emulator_send(emu, t, EMULATOR_ERROR);                       /* send error */
+                
+                return;                                                        /* return */
+            }
+            a_emulator_send(emu, t, EMULATOR_ACK);                             /* send ack */
+            emu->stats.texts++;                                                /* texts++ */
+            d = emulator_duration(&emu->config, (uint8_t)(p[1] & 0x07), &emu->speed,
+                                  &p[2], (uint16_t)(n - 2));                   /* get the duration */
+            emu->stats.play_ms += d;                                           /* add the playback */
+            emu->play_end = t + d;                                             /* set the end */
+            emu->state = (d != 0) ? EMULATOR_STATE_PLAYING : EMULATOR_STATE_IDLE;
+            
+            break;
+        }
+        case 0x02 :                                                            /* stop */
+        {
+            a_emulator_send(emu, t, EMULATOR_ACK);                             /* send ack */
+            emu->state = EMULATOR_STATE_IDLE;                                  /* stop playback */
+            
+            break;
+        }
+        case 0x03 :                                                            /* pause */
+        {
+            a_emulator_send(emu, t, EMULATOR_ACK);                             /* send ack */
+            if (emu->state == EMULATOR_STATE_PLAYING)                          /* check playing */
+            {
+                emu->pause_left = emu->play_end - t;                           /* save the rest */
+                emu->state = EMULATOR_STATE_PAUSED;                            /* paused */
+            }
+            
+            break;
+        }
+        case 0x04 :                                                            /* resume */
+        {
+            a_emulator_send(emu, t, EMULATOR_ACK);                             /* send ack */
+            if (emu->state == EMULATOR_STATE_PAUSED)                           /* check paused */
+            {
+                emu->play_end = t + emu->pause_left;                           /* set the end */
+                emu->state = EMULATOR_STATE_PLAYING;                           /* playing */
+            }
+            
+            break;
+        }
+        case 0x21 :                                                            /* status */
+        {
+            emu->stats.status++;                                               /* status++ */
+            a_emulator_send(emu, t, EMULATOR_ACK);                             /* send ack */
+            if ((emu->state == EMULATOR_STATE_PLAYING) || (emu->state == EMULATOR_STATE_PAUSED))
+            {
+                a_emulator_send(emu, t + emu->config.status_ms, EMULATOR_BUSY);    /* send busy */
+            }
+            else
+            {
+                a_emulator_send(emu, t + emu->config.status_ms, EMULATOR_IDLE);    /* send idle */
+            }
+            
+            break;
+        }
+        case 0x31 :                                                            /* baud rate */
+        {
+            if ((n < 2) || (p[1] > 2))                                         /* check the param */
+            {
+                emu->stats.bad_command++;                                      /* bad command */
+                a_emulator_send(emu, t, EMULATOR_ERROR);                       /* send error */
+                
+                return;                                                        /* return */
+            }
+            a_emulator_send(emu, t, EMULATOR_ACK);                             /* ack at the old rate */
+            emu->baud = 9600UL << p[1];                                        /* set the new rate */
+            
+            break;
+        }
+        case 0x88 :                                                            /* power down */
+        {
+            a_emulator_send(emu, t, EMULATOR_ACK);                             /* send ack */
+            emu->state = EMULATOR_STATE_SLEEPING;                              /* sleep */
+            
+            break;
+        }
+        default :
+        {
+            emu->stats.bad_command++;                                          /* bad command */
+            a_emulator_send(emu, t, EMULATOR_ERROR);                           /* send error */
+            
+            break;
+        }
+    }
+}
+
+/**
+ * @brief     pick the fault of a valid frame
+ * @param[in] *emu pointer to an emulator structure
+ * @note      none
+ */
+static void a_emulator_pick(emulator_t *emu)
+{
+    uint32_t r;
+    
+    emu->fault = EMULATOR_FAULT_NONE;                                          /* no fault */
+    emu->fault_arg = 0;                                                        /* no argument */
+    r = a_emulator_random(emu) % 1000;                                         /* get the permille */
+    while ((emu->script_pos < emu->script_num) &&
+           (emu->script[emu->script_pos].frame < emu->stats.frames))           /* skip the old faults */
+    {
+        emu->script_pos++;                                                     /* next fault */
+    }
+    if ((emu->script_pos < emu->script_num) &&
+        (emu->script[emu->script_pos].frame == emu->stats.frames))             /* scripted fault */
+    {
+        emu->fault = emu->script[emu->script_pos].type;                        /* set the fault */
+        emu->fault_arg = emu->script[emu->script_pos].arg;                     /* set the argument */
+        emu->script_pos++;                                                     /* next fault */
+    }
+    else if (r < emu->config.drop_rate)                                        /* random drop */
+    {
+        emu->fault = EMULATOR_FAULT_DROP;                                      /* drop */
+    }
+    else if ((r -= emu->config.drop_rate) < emu->config.corrupt_rate)          /* random corrupt */
+    {
+        emu->fault = EMULATOR_FAULT_CORRUPT;                                   /* corrupt */
+    }
+    else if ((r -= emu->config.corrupt_rate) < emu->config.delay_rate)         /* random delay */
+    {
+        emu->fault = EMULATOR_FAULT_DELAY;                                     /* delay */
+        emu->fault_arg = emu->config.delay_ms;                                 /* set the delay */
+    }
+    else if ((r -= emu->config.delay_rate) < emu->config.reset_rate)           /* random reset */
+    {
+        emu->fault = EMULATOR_FAULT_RESET;                                     /* reset */
+        emu->fault_arg = emu->config.reset_ms;                                 /* set the boot time */
+    }
+    else
+    {
+        
+    }
+    switch (emu->fault)
+    {
+        case EMULATOR_FAULT_DROP :
+        {
+            emu->stats.dropped++;                                              /* dropped++ */
+            
+            break;
+        }
+        case EMULATOR_FAULT_CORRUPT :
+        {
+            emu->stats.corrupted++;                                            /* corrupted++ */
+            
+            break;
+        }
+        case EMULATOR_FAULT_DELAY :
+        {
+            emu->stats.delayed++;                                              /* delayed++ */
+            
+            break;
+        }
+        case EMULATOR_FAULT_RESET :
+        {
+            emu->stats.resets++;                                               /* resets++ */
+            
+            break;
+        }
+        case EMULATOR_FAULT_BAUD :
+        {
+            emu->stats.baud_faults++;                                          /* baud_faults++ */
+            
+            break;
+        }
+        default :
+        {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief     reset the chip
+ * @param[in] *emu pointer to an emulator structure
+ * @param[in] now current time in ms
+ * @param[in] ms boot time in ms
+ * @note      pending input and answers are lost and the power on settings are restored
+ */
+static void a_emulator_reset(emulator_t *emu, uint32_t now, uint32_t ms)
+{
+    emu->rx_len = 0;                                                           /* lose the input */
+    emu->tx_num = 0;                                                           /* lose the answers */
+    emu->speed = 5;                                                            /* default speed */
+    emu->baud = 9600;                                                          /* default baud rate */
+    emu->wake_end = now + ms;                                                  /* set the boot time */
+    emu->state = EMULATOR_STATE_WAKING;                                        /* booting */
+}
+
+/**
+ * @brief     drop bytes from the input buffer
+ * @param[in] *emu pointer to an emulator structure
+ * @param[in] n byte number
+ * @note      none
+ */
+static void a_emulator_drop(emulator_t *emu, uint16_t n)
+{
+    if (n > emu->rx_len)                                                       /* check the length */
+    {
+        n = emu->rx_len;                                                       /* drop all */
+    }
+    memmove(emu->rx, &emu->rx[n], emu->rx_len - n);                            /* move the rest */
+    emu->rx_len = (uint16_t)(emu->rx_len - n);                                 /* update the length */
+}
+
+/**
+ * @brief     get the default config
+ * @param[in] *config pointer to a config structure
+ * @note      the defaults follow the timing of a real module at 9600 bps
+ */
+void emulator_default_config(emulator_config_t *config)
+{
+    const uint32_t char_ms[6] = {360, 320, 290, 260, 235, 210};
+    
+    memset(config, 0, sizeof(emulator_config_t));                              /* clear the config */
+    config->ack_ms = 5;                                                        /* 5 ms */
+    config->status_ms = 5;                                                     /* 5 ms */
+    config->wake_ms = 20;                                                      /* 20 ms */
+    memcpy(config->char_ms, char_ms, sizeof(char_ms));                         /* copy the char time */
+    config->short_pause_ms = 150;                                              /* 150 ms */
+    config->long_pause_ms = 300;                                               /* 300 ms */
+    config->sound_ms = 600;                                                    /* 600 ms */
+    config->message_ms = 1500;                                                 /* 1500 ms */
+    config->ring_ms = 3500;                                                    /* 3500 ms */
+    config->idle_notify = 0;                                                   /* no idle notify */
+    config->delay_ms = 500;                                                    /* 500 ms */
+    config->reset_ms = 300;                                                    /* 300 ms */
+    config->seed = 1;                                                          /* fixed seed */
+}
+
+/**
+ * @brief     initialize the emulator
+ * @param[in] *emu pointer to an emulator structure
+ * @param[in] *config pointer to a config structure
+ * @note      none
+ */
+void emulator_init(emulator_t *emu, const emulator_config_t *config)
+{
+    memset(emu, 0, sizeof(emulator_t));                                        /* clear the emulator */
+    emu->config = *config;                                                     /* copy the config */
+    emu->state = EMULATOR_STATE_IDLE;                                          /* idle */
+    emu->speed = 5;                                                            /* default speed */
+    emu->baud = 9600;                                                          /* default baud rate */
+    emu->rand = (config->seed != 0) ? config->seed : 1;                        /* seed the faults */
+}
+
+/**
+ * @brief     set the scripted faults
+ * @param[in] *emu pointer to an emulator structure
+ * @param[in] *script pointer to a fault array sorted by frame
+ * @param[in] num fault number
+ * @note      a scripted fault replaces the random faults for its frame
+ */
+void emulator_set_script(emulator_t *emu, const emulator_fault_t *script, uint16_t num)
+{
+    emu->script = script;                                                      /* set the script */
+    emu->script_num = num;                                                     /* set the number */
+    emu->script_pos = 0;                                                       /* from the start */
+}
+
+/**
+ * @brief     set the host baud rate
+ * @param[in] *emu pointer to an emulator structure
+ * @param[in] baud host baud rate, 0 means unknown
+ * @note      bytes are garbled in both directions when the host and the chip rates differ
+ */
+void emulator_set_host_baud(emulator_t *emu, uint32_t baud)
+{
+    emu->host_baud = baud;                                                     /* set the rate */
+}
+
+/**
+ * @brief     feed received bytes
+ * @param[in] *emu pointer to an emulator structure
+ * @param[in] now current time in ms
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    number of parsed frames
+ * @note      a frame split across calls is kept until the rest arrives
+ */
+uint16_t emulator_input(emulator_t *emu, uint32_t now, const uint8_t *buf, uint16_t len)
+{
+    uint16_t n;
+    uint16_t i;
+    uint16_t flen;
+    uint8_t xor_cal;
+    
+    a_emulator_update(emu, now);                                               /* update the state */
+    if (emu->state == EMULATOR_STATE_SLEEPING)                                 /* sleeping */
+    {
+        emu->stats.wakes++;                                                    /* wakes++ */
+        emu->stats.lost += len;                                                /* the bytes only wake */
+        emu->wake_end = now + emu->config.wake_ms;                             /* set the wake time */
+        emu->state = EMULATOR_STATE_WAKING;                                    /* waking */
+        
+        return 0;                                                              /* no frame */
+    }
+    if (emu->state == EMULATOR_STATE_WAKING)                                   /* waking */
+    {
+        emu->stats.lost += len;                                                /* the bytes are lost */
+        
+        return 0;                                                              /* no frame */
+    }
+    if (a_emulator_mismatch(emu) != 0)                                         /* wrong baud rate */
+    {
+        emu->stats.junk += len;                                                /* the bytes are garbled */
+        
+        return 0;                                                              /* no frame */
+    }
+    if (len > EMULATOR_RX_MAX - emu->rx_len)                                   /* check the space */
+    {
+        emu->stats.junk += (uint32_t)(len - (EMULATOR_RX_MAX - emu->rx_len)); /* count the overflow */
+        len = (uint16_t)(EMULATOR_RX_MAX - emu->rx_len);                       /* keep what fits */
+    }
+    memcpy(&emu->rx[emu->rx_len], buf, len);                                   /* append the bytes */
+    emu->rx_len = (uint16_t)(emu->rx_len + len);                               /* update the length */
+    
+    n = 0;                                                                     /* init 0 */
+    while (emu->rx_len != 0)
+    {
+        if (emu->rx[0] != EMULATOR_HEADER)                                     /* find the header */
+        {
+            emu->stats.junk++;                                                 /* junk++ */
+            a_emulator_drop(emu, 1);                                           /* drop the byte */
+            
+            continue;                                                          /* continue */
+        }
+        if (emu->rx_len < 3)                                                   /* wait the length */
+        {
+            break;                                                             /* break */
+        }
+        flen = (uint16_t)((emu->rx[1] << 8) | emu->rx[2]);                     /* get the length */
+        if ((flen < EMULATOR_MIN_LEN) || (flen > EMULATOR_MAX_LEN))            /* check the length */
+        {
+            emu->stats.bad_length++;                                           /* bad length */
+            a_emulator_send(emu, now + emu->config.ack_ms, EMULATOR_ERROR);    /* send error */
+            a_emulator_drop(emu, 1);                                           /* resync */
+            
+            continue;                                                          /* continue */
+        }
+        if (emu->rx_len < flen + 3)                                            /* wait the frame */
+        {
+            break;                                                             /* break */
+        }
+        xor_cal = 0;                                                           /* init 0 */
+        for (i = 0; i < flen + 2; i++)
+        {
+            xor_cal ^= emu->rx[i];                                             /* calculate xor */
+        }
+        if (xor_cal != emu->rx[flen + 2])                                      /* check xor */
+        {
+            emu->stats.bad_xor++;                                              /* bad xor */
+            a_emulator_send(emu, now + emu->config.ack_ms, EMULATOR_ERROR);    /* send error */
+        }
+        else
+        {
+            emu->stats.frames++;                                               /* frames++ */
+            n++;                                                               /* n++ */
+            a_emulator_pick(emu);                                              /* pick the fault */
+            if (emu->fault == EMULATOR_FAULT_RESET)                            /* spontaneous reset */
+            {
+                emu->fault = EMULATOR_FAULT_NONE;                              /* clear the fault */
+                a_emulator_reset(emu, now, emu->fault_arg);                    /* reset the chip */
+                
+                break;                                                         /* the rest is lost */
+            }
+            a_emulator_command(emu, now, &emu->rx[3], (uint16_t)(flen - 1));   /* run the command */
+            if (emu->fault == EMULATOR_FAULT_BAUD)                             /* unannounced rate */
+            {
+                emu->baud = emu->fault_arg;                                    /* switch the rate */
+            }
+            emu->fault = EMULATOR_FAULT_NONE;                                  /* clear the fault */
+        }
+        a_emulator_drop(emu, (uint16_t)(flen + 3));                            /* drop the frame */
+    }
+    
+    return n;                                                                  /* return the frames */
+}
+
+/**
+ * @brief      get the bytes to send
+ * @param[in]  *emu pointer to an emulator structure
+ * @param[in]  now current time in ms
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len buffer length
+ * @return     number of bytes due by now
+ * @note       none
+ */
+uint16_t emulator_output(emulator_t *emu, uint32_t now, uint8_t *buf, uint16_t len)
+{
+    uint16_t n;
+    
+    a_emulator_update(emu, now);                                               /* update the state */
+    n = 0;                                                                     /* init 0 */
+    while ((n < len) && (emu->tx_num != 0) &&
+           (a_emulator_reached(now, emu->tx_time[emu->tx_head]) != 0))         /* due bytes */
+    {
+        buf[n++] = emu->tx[emu->tx_head];                                      /* copy the byte */
+        emu->tx_head = (uint8_t)((emu->tx_head + 1) % EMULATOR_TX_MAX);        /* next byte */
+        emu->tx_num--;                                                         /* num-- */
+    }
+    
+    return n;                                                                  /* return the length */
+}
+
+/**
+ * @brief     get the time to the next event
+ * @param[in] *emu pointer to an emulator structure
+ * @param[in] now current time in ms
+ * @return    time in ms, 0xFFFFFFFF means no pending event
+ * @note      none
+ */
+uint32_t emulator_next(emulator_t *emu, uint32_t now)
+{
+    uint32_t next;
+    uint32_t t;
+    
+    a_emulator_update(emu, now);                                               /* update the state */
+    next = 0xFFFFFFFFUL;                                                       /* no event */
+    if (emu->tx_num != 0)                                                      /* pending output */
+    {
+        t = emu->tx_time[emu->tx_head];                                        /* get the due time */
+        next = (a_emulator_reached(now, t) != 0) ? 0 : (t - now);              /* time to the output */
+    }
+    if ((emu->state == EMULATOR_STATE_PLAYING) && (emu->config.idle_notify != 0))
+    {
+        t = emu->play_end - now;                                               /* time to the end */
+        next = (t < next) ? t : next;                                          /* get the min */
+    }
+    if (emu->state == EMULATOR_STATE_WAKING)                                   /* waking */
+    {
+        t = emu->wake_end - now;                                               /* time to the wake */
+        next = (t < next) ? t : next;                                          /* get the min */
+    }
+    
+    return next;                                                               /* return the time */
+}
+
+/**
+ * @brief     get the chip state
+ * @param[in] *emu pointer to an emulator structure
+ * @param[in] now current time in ms
+ * @return    emulator_state_t
+ * @note      none
+ */
+uint8_t emulator_get_state(emulator_t *emu, uint32_t now)
+{
+    a_emulator_update(emu, now);                                               /* update the state */
+    
+    return emu->state;                                                         /* return the state */
+}
+
+/**
+ * @brief         estimate the playback time of a text
+ * @param[in]     *config pointer to a config structure
+ * @param[in]     type text type from the frame param
+ * @param[in,out] *speed pointer to the current speed, updated by speed marks
+ * @param[in]     *buf pointer to a text buffer
+ * @param[in]     len text length
+ * @return        playback time in ms
+ * @note          [tN] marks change the speed, soundX, msgX and ringX play prompt tones
+ */
+uint32_t emulator_duration(const emulator_config_t *config, uint8_t type, uint8_t *speed,
+                           const uint8_t *buf, uint16_t len)
+{
+    uint16_t pos;
+    uint16_t l;
+    uint16_t m;
+    uint16_t c;
+    uint8_t cls;
+    uint32_t total;
+    
+    total = 0;                                                                 /* init 0 */
+    pos = 0;                                                                   /* init position */
+    while ((l = a_emulator_get_char(type, buf, len, pos, &c)) != 0)
+    {
+        if (c == '[')                                                          /* inline mark */
+        {
+            uint16_t mark = 0;
+            uint16_t value = 0xFFFF;
+            
+            pos = (uint16_t)(pos + l);                                         /* skip '[' */
+            while ((l = a_emulator_get_char(type, buf, len, pos, &c)) != 0)    /* find ']' */
+            {
+                pos = (uint16_t)(pos + l);                                     /* next char */
+                if (c == ']')                                                  /* end of mark */
+                {
+                    break;                                                     /* break */
+                }
+                if (mark == 0)                                                 /* mark char */
+                {
+                    mark = c;                                                  /* save the mark */
+                }
+                else if ((c >= '0') && (c <= '9'))                             /* mark value */
+                {
+                    value = (value == 0xFFFF) ? (uint16_t)(c - '0') : (uint16_t)(value * 10 + (c - '0'));
+                }
+                else
+                {
+                    
+                }
+            }
+            if ((mark == 't') && (value <= 5))                                 /* speed mark */
+            {
+                *speed = (uint8_t)value;                                       /* update the speed */
+            }
+            
+            continue;                                                          /* continue */
+        }
+        if ((m = a_emulator_match(type, buf, len, pos, "sound")) != 0)         /* sound prompt */
+        {
+            total += config->sound_ms;                                         /* add the prompt */
+        }
+        else if ((m = a_emulator_match(type, buf, len, pos, "msg")) != 0)      /* message prompt */
+        {
+            total += config->message_ms;                                       /* add the prompt */
+        }
+        else if ((m = a_emulator_match(type, buf, len, pos, "ring")) != 0)     /* ring prompt */
+        {
+            total += config->ring_ms;                                          /* add the prompt */
+        }
+        else
+        {
+            m = 0;                                                             /* no prompt */
+        }
+        if (m != 0)                                                            /* prompt tone */
+        {
+            pos = (uint16_t)(pos + m);                                         /* skip the name */
+            pos = (uint16_t)(pos + a_emulator_get_char(type, buf, len, pos, &c));    /* skip the index */
+            
+            continue;                                                          /* continue */
+        }
+        cls = a_emulator_classify(type, c);                                    /* classify the char */
+        if (cls == EMULATOR_CLASS_CHAR)                                        /* spoken char */
+        {
+            total += config->char_ms[(*speed <= 5) ? *speed : 5];              /* add the char */
+        }
+        else if (cls == EMULATOR_CLASS_SHORT_PAUSE)                            /* short pause */
+        {
+            total += config->short_pause_ms;                                   /* add the pause */
+        }
+        else if (cls == EMULATOR_CLASS_LONG_PAUSE)                             /* long pause */
+        {
+            total += config->long_pause_ms;                                    /* add the pause */
+        }
+        else
+        {
+            
+        }
+        pos = (uint16_t)(pos + l);                                             /* next char */
+    }
+    
+    return total;                                                              /* return the time */
+}
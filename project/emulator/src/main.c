@@ -0,0 +1,437 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      main.c
+ * @brief     main source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _GNU_SOURCE
+#include "emulator.h"
+#include "script.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief global var definition
+ */
+static volatile sig_atomic_t gs_stop = 0;        /**< stop flag */
+
+/**
+ * @brief     get the baud rate of a terminal
+ * @param[in] fd terminal handle
+ * @return    baud rate, 0 means unknown
+ * @note      none
+ */
+static uint32_t a_emulator_baud(int fd)
+{
+    struct termios cfg;
+    
+    if (tcgetattr(fd, &cfg) != 0)
+    {
+        return 0;
+    }
+    switch (cfgetispeed(&cfg))
+    {
+        case B9600 :
+        {
+            return 9600;
+        }
+        case B19200 :
+        {
+            return 19200;
+        }
+        case B38400 :
+        {
+            return 38400;
+        }
+        default :
+        {
+            return 0;
+        }
+    }
+}
+
+/**
+ * @brief     signal handler
+ * @param[in] sig signal number
+ * @note      none
+ */
+static void a_emulator_signal(int sig)
+{
+    (void)sig;
+    gs_stop = 1;
+}
+
+/**
+ * @brief  get the current time
+ * @return current monotonic time in ms
+ * @note   none
+ */
+static uint32_t a_emulator_now(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000);
+}
+
+/**
+ * @brief     print bytes
+ * @param[in] *dir pointer to a direction name
+ * @param[in] now current time in ms
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @note      none
+ */
+static void a_emulator_dump(const char *dir, uint32_t now, const uint8_t *buf, int len)
+{
+    int i;
+    
+    printf("emulator: %u %s", (unsigned int)now, dir);
+    for (i = 0; i < len; i++)
+    {
+        printf(" %02X", buf[i]);
+    }
+    printf("\n");
+}
+
+/**
+ * @brief     print the help
+ * @note      none
+ */
+static void a_emulator_help(void)
+{
+    printf("Usage:\n");
+    printf("  syn6288_emulator [-l <path> | --link=<path>] [-v | --verbose] [--ack=<ms>] [--status=<ms>]\n");
+    printf("                   [--wake=<ms>] [--char=<ms>] [--sound=<ms>] [--msg=<ms>] [--ring=<ms>] [--idle-notify]\n");
+    printf("                   [--drop=<permille>] [--corrupt=<permille>] [--delay=<permille>] [--delay-ms=<ms>]\n");
+    printf("                   [--reset=<permille>] [--reset-ms=<ms>] [--seed=<n>] [--script=<path>]\n");
+    printf("  syn6288_emulator (-h | --help)\n");
+    printf("\n");
+    printf("Options:\n");
+    printf("      --ack=<ms>            Set the ack latency after a frame.([default: 5])\n");
+    printf("      --char=<ms>           Set the char time at speed 5, the other speeds are scaled.([default: 210])\n");
+    printf("      --corrupt=<permille>  Set the permille of frames with a corrupted answer.([default: 0])\n");
+    printf("      --delay=<permille>    Set the permille of frames with a delayed answer.([default: 0])\n");
+    printf("      --delay-ms=<ms>       Set the delay of the delayed answers.([default: 500])\n");
+    printf("      --drop=<permille>     Set the permille of frames with a lost answer.([default: 0])\n");
+    printf("  -h, --help                Show the help.\n");
+    printf("      --idle-notify         Send 0x4F when a playback ends.\n");
+    printf("  -l <path>, --link=<path>  Create a symbolic link to the pseudo terminal.\n");
+    printf("      --msg=<ms>            Set the message prompt time.([default: 1500])\n");
+    printf("      --reset=<permille>    Set the permille of frames replaced by a chip reset.([default: 0])\n");
+    printf("      --reset-ms=<ms>       Set the boot time after a reset.([default: 300])\n");
+    printf("      --ring=<ms>           Set the ring prompt time.([default: 3500])\n");
+    printf("      --sound=<ms>          Set the sound prompt time.([default: 600])\n");
+    printf("      --script=<path>       Run the faults of a script, each line is <frame> <drop|corrupt|delay|reset|baud> [arg].\n");
+    printf("      --seed=<n>            Set the random seed of the faults.([default: 1])\n");
+    printf("      --status=<ms>         Set the status latency after the ack.([default: 5])\n");
+    printf("  -v, --verbose             Print every received and sent byte.\n");
+    printf("      --wake=<ms>           Set the wake up time after a byte in power down.([default: 20])\n");
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note      none
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    int i;
+    int n;
+    int master;
+    int slave;
+    int verbose = 0;
+    int longindex = 0;
+    char *name;
+    char *link_name = NULL;
+    int script_num = 0;
+    uint8_t buf[256];
+    uint32_t next;
+    uint32_t now;
+    struct termios cfg;
+    struct pollfd pfd;
+    emulator_config_t config;
+    emulator_t emu;
+    static emulator_fault_t script[SCRIPT_MAX];
+    const uint32_t char_ms[6] = {360, 320, 290, 260, 235, 210};
+    const char short_options[] = "hl:v";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"link", required_argument, NULL, 'l'},
+        {"verbose", no_argument, NULL, 'v'},
+        {"ack", required_argument, NULL, 1},
+        {"status", required_argument, NULL, 2},
+        {"wake", required_argument, NULL, 3},
+        {"char", required_argument, NULL, 4},
+        {"sound", required_argument, NULL, 5},
+        {"msg", required_argument, NULL, 6},
+        {"ring", required_argument, NULL, 7},
+        {"idle-notify", no_argument, NULL, 8},
+        {"script", required_argument, NULL, 9},
+        {"drop", required_argument, NULL, 10},
+        {"corrupt", required_argument, NULL, 10},
+        {"delay", required_argument, NULL, 10},
+        {"delay-ms", required_argument, NULL, 10},
+        {"reset", required_argument, NULL, 10},
+        {"reset-ms", required_argument, NULL, 10},
+        {"seed", required_argument, NULL, 10},
+        {NULL, 0, NULL, 0},
+    };
+    
+    /* default config */
+    emulator_default_config(&config);
+    
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, short_options, long_options, &longindex)) != -1)
+    {
+        switch (c)
+        {
+            case 'l' :
+            {
+                link_name = optarg;
+                
+                break;
+            }
+            case 'v' :
+            {
+                verbose = 1;
+                
+                break;
+            }
+            case 1 :
+            {
+                config.ack_ms = (uint32_t)atol(optarg);
+                
+                break;
+            }
+            case 2 :
+            {
+                config.status_ms = (uint32_t)atol(optarg);
+                
+                break;
+            }
+            case 3 :
+            {
+                config.wake_ms = (uint32_t)atol(optarg);
+                
+                break;
+            }
+            case 4 :
+            {
+                for (i = 0; i < 6; i++)
+                {
+                    config.char_ms[i] = char_ms[i] * (uint32_t)atol(optarg) / char_ms[5];
+                }
+                
+                break;
+            }
+            case 5 :
+            {
+                config.sound_ms = (uint32_t)atol(optarg);
+                
+                break;
+            }
+            case 6 :
+            {
+                config.message_ms = (uint32_t)atol(optarg);
+                
+                break;
+            }
+            case 7 :
+            {
+                config.ring_ms = (uint32_t)atol(optarg);
+                
+                break;
+            }
+            case 8 :
+            {
+                config.idle_notify = 1;
+                
+                break;
+            }
+            case 9 :
+            {
+                script_num = script_load(optarg, script, SCRIPT_MAX);
+                if (script_num < 0)
+                {
+                    return 1;
+                }
+                
+                break;
+            }
+            case 10 :
+            {
+                (void)script_option(long_options[longindex].name, optarg, &config);
+                
+                break;
+            }
+            case 'h' :
+            {
+                a_emulator_help();
+                
+                return 0;
+            }
+            default :
+            {
+                a_emulator_help();
+                
+                return 1;
+            }
+        }
+    }
+    
+    /* open the pseudo terminal */
+    master = posix_openpt(O_RDWR | O_NOCTTY);
+    if ((master < 0) || (grantpt(master) != 0) || (unlockpt(master) != 0))
+    {
+        perror("emulator: open pty failed.\n");
+        
+        return 1;
+    }
+    name = ptsname(master);
+    
+    /* keep the slave open so the master never sees a hang up */
+    slave = open(name, O_RDWR | O_NOCTTY);
+    if (slave < 0)
+    {
+        perror("emulator: open slave failed.\n");
+        (void)close(master);
+        
+        return 1;
+    }
+    (void)tcgetattr(slave, &cfg);
+    cfmakeraw(&cfg);
+    (void)tcsetattr(slave, TCSANOW, &cfg);
+    
+    /* link the pseudo terminal */
+    if (link_name != NULL)
+    {
+        (void)unlink(link_name);
+        if (symlink(name, link_name) != 0)
+        {
+            perror("emulator: link failed.\n");
+            (void)close(slave);
+            (void)close(master);
+            
+            return 1;
+        }
+    }
+    printf("emulator: listen on %s.\n", (link_name != NULL) ? link_name : name);
+    fflush(stdout);
+    
+    /* run the emulator */
+    (void)signal(SIGINT, a_emulator_signal);
+    (void)signal(SIGTERM, a_emulator_signal);
+    emulator_init(&emu, &config);
+    emulator_set_script(&emu, script, (uint16_t)script_num);
+    pfd.fd = master;
+    pfd.events = POLLIN;
+    while (gs_stop == 0)
+    {
+        next = emulator_next(&emu, a_emulator_now());
+        if (poll(&pfd, 1, (next > 100) ? 100 : (int)next) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            perror("emulator: poll failed.\n");
+            
+            break;
+        }
+        if ((pfd.revents & POLLIN) != 0)
+        {
+            n = (int)read(master, buf, sizeof(buf));
+            if (n > 0)
+            {
+                now = a_emulator_now();
+                emulator_set_host_baud(&emu, a_emulator_baud(slave));
+                if (verbose != 0)
+                {
+                    a_emulator_dump("rx", now, buf, n);
+                }
+                (void)emulator_input(&emu, now, buf, (uint16_t)n);
+            }
+        }
+        now = a_emulator_now();
+        n = (int)emulator_output(&emu, now, buf, sizeof(buf));
+        if (n > 0)
+        {
+            if (verbose != 0)
+            {
+                a_emulator_dump("tx", now, buf, n);
+            }
+            if (write(master, buf, (size_t)n) != n)
+            {
+                perror("emulator: write failed.\n");
+            }
+        }
+    }
+    
+    /* print the stats */
+    printf("emulator: frames %u, texts %u, status %u, wakes %u.\n", (unsigned int)emu.stats.frames,
+           (unsigned int)emu.stats.texts, (unsigned int)emu.stats.status, (unsigned int)emu.stats.wakes);
+    printf("emulator: bad length %u, bad xor %u, bad command %u, junk %u, lost %u.\n",
+           (unsigned int)emu.stats.bad_length, (unsigned int)emu.stats.bad_xor,
+           (unsigned int)emu.stats.bad_command, (unsigned int)emu.stats.junk, (unsigned int)emu.stats.lost);
+    printf("emulator: playback %u ms.\n", (unsigned int)emu.stats.play_ms);
+    printf("emulator: dropped %u, corrupted %u, delayed %u, resets %u, baud faults %u.\n",
+           (unsigned int)emu.stats.dropped, (unsigned int)emu.stats.corrupted, (unsigned int)emu.stats.delayed,
+           (unsigned int)emu.stats.resets, (unsigned int)emu.stats.baud_faults);
+    
+    /* close the pseudo terminal */
+    if (link_name != NULL)
+    {
+        (void)unlink(link_name);
+    }
+    (void)close(slave);
+    (void)close(master);
+    
+    return 0;
+}
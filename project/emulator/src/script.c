@@ -0,0 +1,192 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      script.c
+ * @brief     script source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "script.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief script fault name structure definition
+ */
+typedef struct script_name_s
+{
+    const char *name;        /**< fault name */
+    uint8_t type;            /**< emulator_fault_type_t */
+} script_name_t;
+
+/**
+ * @brief script fault name table
+ */
+static const script_name_t gs_names[] =
+{
+    {"drop", EMULATOR_FAULT_DROP},
+    {"corrupt", EMULATOR_FAULT_CORRUPT},
+    {"delay", EMULATOR_FAULT_DELAY},
+    {"reset", EMULATOR_FAULT_RESET},
+    {"baud", EMULATOR_FAULT_BAUD},
+};
+
+/**
+ * @brief      load a fault script
+ * @param[in]  *path pointer to a script file path
+ * @param[out] *script pointer to a fault array
+ * @param[in]  max max fault number
+ * @return     fault number, -1 means the script is invalid
+ * @note       each line is "<frame> <drop|corrupt|delay|reset|baud> [arg]",
+ *             '#' starts a comment and the faults are sorted by frame
+ */
+int script_load(const char *path, emulator_fault_t *script, int max)
+{
+    FILE *f;
+    char line[128];
+    char name[16];
+    unsigned long frame;
+    unsigned long arg;
+    int num;
+    int line_num;
+    int i;
+    int j;
+    int n;
+    
+    f = fopen(path, "r");
+    if (f == NULL)
+    {
+        fprintf(stderr, "script: open %s failed.\n", path);
+        
+        return -1;
+    }
+    num = 0;
+    line_num = 0;
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        line_num++;
+        
+        /* skip the comment */
+        if (strchr(line, '#') != NULL)
+        {
+            *strchr(line, '#') = '\0';
+        }
+        arg = 0;
+        n = sscanf(line, "%lu %15s %lu", &frame, name, &arg);
+        if (n <= 0)
+        {
+            continue;
+        }
+        if ((n < 2) || (frame == 0) || (num >= max))
+        {
+            fprintf(stderr, "script: line %d is invalid.\n", line_num);
+            (void)fclose(f);
+            
+            return -1;
+        }
+        for (i = 0; i < (int)(sizeof(gs_names) / sizeof(gs_names[0])); i++)
+        {
+            if (strcmp(name, gs_names[i].name) == 0)
+            {
+                break;
+            }
+        }
+        if (i == (int)(sizeof(gs_names) / sizeof(gs_names[0])))
+        {
+            fprintf(stderr, "script: fault %s is invalid.\n", name);
+            (void)fclose(f);
+            
+            return -1;
+        }
+        
+        /* insert sorted by frame */
+        for (j = num; (j > 0) && (script[j - 1].frame > frame); j--)
+        {
+            script[j] = script[j - 1];
+        }
+        script[j].frame = (uint32_t)frame;
+        script[j].type = gs_names[i].type;
+        script[j].arg = (uint32_t)arg;
+        num++;
+    }
+    (void)fclose(f);
+    
+    return num;
+}
+
+/**
+ * @brief      apply a fault option
+ * @param[in]  *name pointer to an option name
+ * @param[in]  *arg pointer to an option argument
+ * @param[out] *config pointer to a config structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 unknown option
+ * @note       the options are drop, corrupt, delay, delay-ms, reset, reset-ms and seed
+ */
+int script_option(const char *name, const char *arg, emulator_config_t *config)
+{
+    if (strcmp(name, "drop") == 0)
+    {
+        config->drop_rate = (uint16_t)atoi(arg);
+    }
+    else if (strcmp(name, "corrupt") == 0)
+    {
+        config->corrupt_rate = (uint16_t)atoi(arg);
+    }
+    else if (strcmp(name, "delay") == 0)
+    {
+        config->delay_rate = (uint16_t)atoi(arg);
+    }
+    else if (strcmp(name, "delay-ms") == 0)
+    {
+        config->delay_ms = (uint32_t)atol(arg);
+    }
+    else if (strcmp(name, "reset") == 0)
+    {
+        config->reset_rate = (uint16_t)atoi(arg);
+    }
+    else if (strcmp(name, "reset-ms") == 0)
+    {
+        config->reset_ms = (uint32_t)atol(arg);
+    }
+    else if (strcmp(name, "seed") == 0)
+    {
+        config->seed = (uint32_t)strtoul(arg, NULL, 0);
+    }
+    else
+    {
+        return 1;
+    }
+    
+    return 0;
+}
@@ -0,0 +1,516 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      soak.c
+ * @brief     soak source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_syn6288_advance.h"
+#include "driver_syn6288_queue.h"
+#include "link.h"
+#include "script.h"
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief soak definition
+ */
+#define SOAK_MAX_SAMPLE     (1 << 20)        /**< max latency samples */
+#define SOAK_QUEUE_DEPTH    4                /**< pushed items kept in the queue */
+#define SOAK_QUEUE_TICK     20               /**< queue process interval in ms */
+#define SOAK_ID_MASK        63               /**< push time table mask */
+
+/**
+ * @brief soak result structure definition
+ */
+typedef struct soak_result_s
+{
+    uint32_t submitted;            /**< submitted texts */
+    uint32_t done;                 /**< played texts */
+    uint32_t dropped;              /**< texts dropped by the queue */
+    uint32_t failures;             /**< failed driver calls */
+    uint32_t recoveries;           /**< successful recoveries */
+    uint32_t recovery_failures;    /**< failed recoveries */
+    uint64_t bytes;                /**< played text bytes */
+    uint32_t *sample;              /**< latency samples in ms */
+    uint32_t sample_num;           /**< latency sample number */
+} soak_result_t;
+
+/**
+ * @brief global var definition
+ */
+static syn6288_handle_t gs_handle;                      /**< syn6288 handle */
+static syn6288_queue_t gs_queue;                        /**< syn6288 queue */
+static soak_result_t gs_result;                         /**< soak result */
+static uint32_t gs_push_time[SOAK_ID_MASK + 1];         /**< push time of each id */
+static uint16_t gs_push_len[SOAK_ID_MASK + 1];          /**< text length of each id */
+static uint32_t gs_rand = 1;                            /**< text random state */
+static char *const gs_text[] =
+{
+    "door open",
+    "the weather today is sunny, the wind is light.",
+    "train number 1024 is arriving at platform 3.",
+    "sounda",
+    "msgb",
+    "[t3]please mind the gap.",
+    "ringa",
+    "warning, pump 2 pressure is high!",
+};
+
+/**
+ * @brief  get a random text
+ * @return pointer to a text
+ * @note   xorshift32
+ */
+static char *a_soak_text(void)
+{
+    gs_rand ^= gs_rand << 13;
+    gs_rand ^= gs_rand >> 17;
+    gs_rand ^= gs_rand << 5;
+    
+    return gs_text[gs_rand % (sizeof(gs_text) / sizeof(gs_text[0]))];
+}
+
+/**
+ * @brief     save a latency sample
+ * @param[in] ms latency in ms
+ * @note      none
+ */
+static void a_soak_sample(uint32_t ms)
+{
+    if (gs_result.sample_num < SOAK_MAX_SAMPLE)
+    {
+        gs_result.sample[gs_result.sample_num++] = ms;
+    }
+}
+
+/**
+ * @brief     compare two samples
+ * @param[in] *a pointer to a sample
+ * @param[in] *b pointer to a sample
+ * @return    compare result
+ * @note      none
+ */
+static int a_soak_compare(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief     get a percentile of the sorted samples
+ * @param[in] permille percentile in permille
+ * @return    latency in ms
+ * @note      none
+ */
+static uint32_t a_soak_percentile(uint32_t permille)
+{
+    uint32_t i;
+    
+    if (gs_result.sample_num == 0)
+    {
+        return 0;
+    }
+    i = (uint32_t)(((uint64_t)gs_result.sample_num * permille + 999) / 1000);
+    
+    return gs_result.sample[(i == 0) ? 0 : (i - 1)];
+}
+
+/**
+ * @brief  recover the example after a failure
+ * @note   none
+ */
+static void a_soak_recover(void)
+{
+    (void)syn6288_advance_deinit();
+    if (syn6288_advance_init() != 0)
+    {
+        gs_result.recovery_failures++;
+        syn6288_interface_delay_ms(1000);
+    }
+    else
+    {
+        gs_result.recoveries++;
+        
+        /* let the chip finish the text it may still be playing */
+        (void)syn6288_advance_sync();
+    }
+}
+
+/**
+ * @brief     run the advance example
+ * @param[in] end end time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the latency is from the synthesis call to the acked text
+ */
+static uint8_t a_soak_example(uint32_t end)
+{
+    uint32_t start;
+    char *text;
+    
+    if (syn6288_advance_init() != 0)
+    {
+        return 1;
+    }
+    while ((int32_t)(link_now() - end) < 0)
+    {
+        text = a_soak_text();
+        gs_result.submitted++;
+        start = link_now();
+        if (syn6288_advance_synthesis(text) != 0)
+        {
+            gs_result.failures++;
+            a_soak_recover();
+            
+            continue;
+        }
+        a_soak_sample(link_now() - start);
+        if (syn6288_advance_sync() != 0)
+        {
+            gs_result.failures++;
+            a_soak_recover();
+            
+            continue;
+        }
+        gs_result.done++;
+        gs_result.bytes += strlen(text);
+        syn6288_interface_delay_ms(100 + gs_rand % 400);
+    }
+    (void)syn6288_advance_deinit();
+    
+    return 0;
+}
+
+/**
+ * @brief     queue receive callback
+ * @param[in] type event type
+ * @param[in] id item id
+ * @note      the latency is from the push to the start of the playback
+ */
+static void a_soak_receive(uint8_t type, uint32_t id)
+{
+    switch (type)
+    {
+        case SYN6288_QUEUE_EVENT_START :
+        {
+            a_soak_sample(link_now() - gs_push_time[id & SOAK_ID_MASK]);
+            
+            break;
+        }
+        case SYN6288_QUEUE_EVENT_DONE :
+        {
+            gs_result.done++;
+            gs_result.bytes += gs_push_len[id & SOAK_ID_MASK];
+            
+            break;
+        }
+        case SYN6288_QUEUE_EVENT_DROP :
+        {
+            gs_result.dropped++;
+            
+            break;
+        }
+        default :
+        {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief     run the queue
+ * @param[in] end end time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the queue recovers the link by itself
+ */
+static uint8_t a_soak_queue(uint32_t end)
+{
+    uint8_t count;
+    uint32_t id;
+    char *text;
+    syn6288_queue_stats_t stats;
+    
+    /* link interface function */
+    DRIVER_SYN6288_LINK_INIT(&gs_handle, syn6288_handle_t);
+    DRIVER_SYN6288_LINK_UART_INIT(&gs_handle, syn6288_interface_uart_init);
+    DRIVER_SYN6288_LINK_UART_DEINIT(&gs_handle, syn6288_interface_uart_deinit);
+    DRIVER_SYN6288_LINK_UART_READ(&gs_handle, syn6288_interface_uart_read);
+    DRIVER_SYN6288_LINK_UART_WRITE(&gs_handle, syn6288_interface_uart_write);
+    DRIVER_SYN6288_LINK_UART_FLUSH(&gs_handle, syn6288_interface_uart_flush);
+    DRIVER_SYN6288_LINK_DELAY_MS(&gs_handle, syn6288_interface_delay_ms);
+    DRIVER_SYN6288_LINK_DEBUG_PRINT(&gs_handle, syn6288_interface_debug_print);
+    DRIVER_SYN6288_LINK_TIMESTAMP_MS(&gs_handle, syn6288_interface_timestamp_ms);
+    DRIVER_SYN6288_LINK_EVENT(&gs_handle, syn6288_interface_event);
+    
+    /* link queue function */
+    DRIVER_SYN6288_QUEUE_LINK_INIT(&gs_queue, syn6288_queue_t);
+    DRIVER_SYN6288_QUEUE_LINK_TIMESTAMP_MS(&gs_queue, syn6288_interface_timestamp_ms);
+    DRIVER_SYN6288_QUEUE_LINK_RECEIVE_CALLBACK(&gs_queue, a_soak_receive);
+    
+    if (syn6288_init(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    if (syn6288_queue_init(&gs_queue, &gs_handle) != 0)
+    {
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    while ((int32_t)(link_now() - end) < 0)
+    {
+        if ((syn6288_queue_get_count(&gs_queue, &count) == 0) && (count < SOAK_QUEUE_DEPTH))
+        {
+            text = a_soak_text();
+            if (syn6288_queue_push(&gs_queue, (uint8_t *)text, (uint16_t)strlen(text), &id) == 0)
+            {
+                gs_result.submitted++;
+                gs_push_time[id & SOAK_ID_MASK] = link_now();
+                gs_push_len[id & SOAK_ID_MASK] = (uint16_t)strlen(text);
+            }
+        }
+        if (syn6288_queue_process(&gs_queue) != 0)
+        {
+            gs_result.failures++;
+        }
+        syn6288_interface_delay_ms(SOAK_QUEUE_TICK);
+    }
+    (void)syn6288_queue_get_stats(&gs_queue, &stats);
+    gs_result.failures += stats.link_failures;
+    gs_result.recoveries = stats.recoveries;
+    gs_result.recovery_failures = stats.recovery_failures;
+    printf("soak: queue resubmitted %u, resumed %u, max recovery time %u ms.\n",
+           (unsigned int)stats.resubmitted, (unsigned int)stats.resumed, (unsigned int)stats.recovery_time_max);
+    (void)syn6288_queue_deinit(&gs_queue);
+    (void)syn6288_deinit(&gs_handle);
+    
+    return 0;
+}
+
+/**
+ * @brief     print the help
+ * @note      none
+ */
+static void a_soak_help(void)
+{
+    printf("Usage:\n");
+    printf("  syn6288_soak [--mode=<example | queue>] [--hours=<h>] [-v | --verbose] [--drop=<permille>]\n");
+    printf("               [--corrupt=<permille>] [--delay=<permille>] [--delay-ms=<ms>] [--reset=<permille>]\n");
+    printf("               [--reset-ms=<ms>] [--seed=<n>] [--script=<path>]\n");
+    printf("  syn6288_soak (-h | --help)\n");
+    printf("\n");
+    printf("Options:\n");
+    printf("      --corrupt=<permille>  Set the permille of frames with a corrupted answer.([default: 0])\n");
+    printf("      --delay=<permille>    Set the permille of frames with a delayed answer.([default: 0])\n");
+    printf("      --delay-ms=<ms>       Set the delay of the delayed answers.([default: 500])\n");
+    printf("      --drop=<permille>     Set the permille of frames with a lost answer.([default: 0])\n");
+    printf("  -h, --help                Show the help.\n");
+    printf("      --hours=<h>           Set the simulated hours.([default: 1])\n");
+    printf("      --mode=<example | queue>\n");
+    printf("                            Drive the advance example or the queue.([default: example])\n");
+    printf("      --reset=<permille>    Set the permille of frames replaced by a chip reset.([default: 0])\n");
+    printf("      --reset-ms=<ms>       Set the boot time after a reset.([default: 300])\n");
+    printf("      --script=<path>       Run the faults of a script, each line is <frame> <drop|corrupt|delay|reset|baud> [arg].\n");
+    printf("      --seed=<n>            Set the random seed of the faults and the texts.([default: 1])\n");
+    printf("  -v, --verbose             Print the driver messages.\n");
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note      none
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    int script_num = 0;
+    uint8_t res;
+    uint8_t queue_mode = 0;
+    double hours = 1.0;
+    uint32_t end;
+    emulator_config_t config;
+    emulator_t *emu;
+    static emulator_fault_t script[SCRIPT_MAX];
+    const char short_options[] = "hv";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"verbose", no_argument, NULL, 'v'},
+        {"mode", required_argument, NULL, 1},
+        {"hours", required_argument, NULL, 2},
+        {"script", required_argument, NULL, 3},
+        {"drop", required_argument, NULL, 4},
+        {"corrupt", required_argument, NULL, 4},
+        {"delay", required_argument, NULL, 4},
+        {"delay-ms", required_argument, NULL, 4},
+        {"reset", required_argument, NULL, 4},
+        {"reset-ms", required_argument, NULL, 4},
+        {"seed", required_argument, NULL, 4},
+        {NULL, 0, NULL, 0},
+    };
+    
+    /* default config */
+    emulator_default_config(&config);
+    link_set_print(0);
+    
+    /* parse the args */
+    while ((c = getopt_long(argc, argv, short_options, long_options, &longindex)) != -1)
+    {
+        switch (c)
+        {
+            case 'v' :
+            {
+                link_set_print(1);
+                
+                break;
+            }
+            case 1 :
+            {
+                if (strcmp(optarg, "queue") == 0)
+                {
+                    queue_mode = 1;
+                }
+                else if (strcmp(optarg, "example") == 0)
+                {
+                    queue_mode = 0;
+                }
+                else
+                {
+                    a_soak_help();
+                    
+                    return 1;
+                }
+                
+                break;
+            }
+            case 2 :
+            {
+                hours = atof(optarg);
+                
+                break;
+            }
+            case 3 :
+            {
+                script_num = script_load(optarg, script, SCRIPT_MAX);
+                if (script_num < 0)
+                {
+                    return 1;
+                }
+                
+                break;
+            }
+            case 4 :
+            {
+                (void)script_option(long_options[longindex].name, optarg, &config);
+                
+                break;
+            }
+            case 'h' :
+            {
+                a_soak_help();
+                
+                return 0;
+            }
+            default :
+            {
+                a_soak_help();
+                
+                return 1;
+            }
+        }
+    }
+    if ((hours <= 0.0) || (hours > 1000.0))
+    {
+        printf("soak: hours is invalid.\n");
+        
+        return 1;
+    }
+    
+    /* run the soak */
+    gs_result.sample = (uint32_t *)malloc(sizeof(uint32_t) * SOAK_MAX_SAMPLE);
+    if (gs_result.sample == NULL)
+    {
+        printf("soak: malloc failed.\n");
+        
+        return 1;
+    }
+    gs_rand = (config.seed != 0) ? config.seed : 1;
+    link_init(&config, script, (uint16_t)script_num);
+    end = (uint32_t)(hours * 3600.0 * 1000.0);
+    if (queue_mode != 0)
+    {
+        res = a_soak_queue(end);
+    }
+    else
+    {
+        res = a_soak_example(end);
+    }
+    if (res != 0)
+    {
+        printf("soak: init failed.\n");
+        free(gs_result.sample);
+        
+        return 1;
+    }
+    
+    /* print the report */
+    emu = link_get();
+    qsort(gs_result.sample, gs_result.sample_num, sizeof(uint32_t), a_soak_compare);
+    printf("soak: mode %s, simulated %.2f h.\n", (queue_mode != 0) ? "queue" : "example", (double)link_now() / 3600000.0);
+    printf("soak: submitted %u, done %u, dropped %u.\n", (unsigned int)gs_result.submitted,
+           (unsigned int)gs_result.done, (unsigned int)gs_result.dropped);
+    printf("soak: throughput %.1f texts/h, %.2f bytes/s.\n", (double)gs_result.done * 3600000.0 / (double)link_now(),
+           (double)gs_result.bytes * 1000.0 / (double)link_now());
+    printf("soak: latency p50 %u ms, p99 %u ms, p99.9 %u ms, max %u ms.\n", (unsigned int)a_soak_percentile(500),
+           (unsigned int)a_soak_percentile(990), (unsigned int)a_soak_percentile(999), (unsigned int)a_soak_percentile(1000));
+    printf("soak: failures %u, recoveries %u, recovery failures %u.\n", (unsigned int)gs_result.failures,
+           (unsigned int)gs_result.recoveries, (unsigned int)gs_result.recovery_failures);
+    printf("soak: chip frames %u, dropped %u, corrupted %u, delayed %u, resets %u, baud faults %u.\n",
+           (unsigned int)emu->stats.frames, (unsigned int)emu->stats.dropped, (unsigned int)emu->stats.corrupted,
+           (unsigned int)emu->stats.delayed, (unsigned int)emu->stats.resets, (unsigned int)emu->stats.baud_faults);
+    free(gs_result.sample);
+    
+    return 0;
+}
@@ -0,0 +1,617 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      soak.c
+ * @file      test.c
+ * @brief     test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_syn6288_interface.h"
+#include "driver_syn6288_register_test.h"
+#include "driver_syn6288_synthesis_test.h"
+#include "driver_syn6288_queue_test.h"
+#include "driver_syn6288_perf_test.h"
+#include "driver_syn6288_service.h"
+#include "driver_syn6288_queue.h"
+#include "link.h"
+#include <getopt.h>
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @brief global var definition
+ */
+static syn6288_handle_t gs_handle;        /**< syn6288 handle */
+static syn6288_queue_t gs_queue;          /**< syn6288 queue */
+static emulator_config_t gs_config;       /**< emulator config */
+static uint32_t gs_starts;                /**< queue start events */
+static uint32_t gs_order[8];              /**< service events as tag * 16 + type */
+static uint8_t gs_order_num;              /**< service event number */
+
+/**
+ * @brief     start a case with a fresh link and handle
+ * @param[in] *script pointer to a fault array sorted by frame
+ * @param[in] num fault number
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the frames of the script are counted from the first frame of the case
+ */
+static uint8_t a_test_start(const emulator_fault_t *script, uint16_t num)
+{
+    uint8_t code;
+    uint8_t command;
+    uint32_t value;
+    
+    link_init(&gs_config, script, num);
+    while (syn6288_interface_event_read(&code, &command, &value) == 0)        /* drop the events of the last case */
+    {
+        continue;
+    }
+    
+    /* link interface function */
+    DRIVER_SYN6288_LINK_INIT(&gs_handle, syn6288_handle_t);
+    DRIVER_SYN6288_LINK_UART_INIT(&gs_handle, syn6288_interface_uart_init);
+    DRIVER_SYN6288_LINK_UART_DEINIT(&gs_handle, syn6288_interface_uart_deinit);
+    DRIVER_SYN6288_LINK_UART_READ(&gs_handle, syn6288_interface_uart_read);
+    DRIVER_SYN6288_LINK_UART_WRITE(&gs_handle, syn6288_interface_uart_write);
+    DRIVER_SYN6288_LINK_UART_FLUSH(&gs_handle, syn6288_interface_uart_flush);
+    DRIVER_SYN6288_LINK_DELAY_MS(&gs_handle, syn6288_interface_delay_ms);
+    DRIVER_SYN6288_LINK_DEBUG_PRINT(&gs_handle, syn6288_interface_debug_print);
+    DRIVER_SYN6288_LINK_TIMESTAMP_MS(&gs_handle, syn6288_interface_timestamp_ms);
+    DRIVER_SYN6288_LINK_EVENT(&gs_handle, syn6288_interface_event);
+    
+    return syn6288_init(&gs_handle);
+}
+
+/**
+ * @brief     count the queue start events
+ * @param[in] type irq type
+ * @param[in] id item id
+ * @note      none
+ */
+static void a_test_receive_callback(uint8_t type, uint32_t id)
+{
+    if (type == SYN6288_QUEUE_EVENT_START)
+    {
+        gs_starts++;
+    }
+    syn6288_interface_receive_callback(type, id);
+}
+
+/**
+ * @brief     record the order of the service events
+ * @param[in] *event pointer to a service event
+ * @note      none
+ */
+static void a_test_service_callback(syn6288_service_event_t *event)
+{
+    if (gs_order_num < 8)
+    {
+        gs_order[gs_order_num++] = event->tag * 16 + event->type;
+    }
+}
+
+/**
+ * @brief     check a value of a case
+ * @param[in] *name pointer to a value name
+ * @param[in] value got value
+ * @param[in] expect expected value
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_test_check(const char *name, uint32_t value, uint32_t expect)
+{
+    if (value != expect)
+    {
+        printf("test: %s is %u, expect %u.\n", name, (unsigned int)value, (unsigned int)expect);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  a lost status answer times out after the wire time and the ack timeout
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   5 bytes take 6 ms on the wire at 9600 bps, the timeout is kept in the event ring
+ */
+static uint8_t a_test_status_drop(void)
+{
+    uint8_t err = 0;
+    uint8_t code = 0;
+    uint8_t command = 0;
+    uint32_t value;
+    uint32_t start;
+    syn6288_status_t status;
+    const emulator_fault_t script[] = {{1, EMULATOR_FAULT_DROP, 0}};
+    
+    if (a_test_start(script, 1) != 0)
+    {
+        return 1;
+    }
+    start = link_now();
+    err |= a_test_check("result", syn6288_get_status(&gs_handle, &status), 1);
+    err |= a_test_check("time", link_now() - start, 100 + 6);
+    err |= a_test_check("timeouts", gs_handle.stats.opcode[SYN6288_OPCODE_STATUS].timeouts, 1);
+    err |= a_test_check("event", syn6288_interface_event_read(&code, &command, &value), 0);
+    err |= a_test_check("event code", code, SYN6288_EVENT_UART_READ_FAILED);
+    err |= a_test_check("event command", command, SYN6288_OPCODE_STATUS);
+    (void)syn6288_deinit(&gs_handle);
+    
+    return err;
+}
+
+/**
+ * @brief  a corrupted status answer is retried once
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   answer time, retry delay and answer time again
+ */
+static uint8_t a_test_status_corrupt(void)
+{
+    uint8_t err = 0;
+    uint32_t start;
+    uint32_t answer;
+    syn6288_status_t status;
+    const emulator_fault_t script[] = {{2, EMULATOR_FAULT_CORRUPT, 0}};
+    
+    if (a_test_start(script, 1) != 0)
+    {
+        return 1;
+    }
+    start = link_now();
+    err |= a_test_check("clean result", syn6288_get_status(&gs_handle, &status), 0);
+    answer = link_now() - start;
+    start = link_now();
+    err |= a_test_check("result", syn6288_get_status(&gs_handle, &status), 0);
+    err |= a_test_check("status", status, SYN6288_STATUS_OK);
+    err |= a_test_check("time", link_now() - start, answer * 2 + 100);
+    err |= a_test_check("retries", gs_handle.stats.opcode[SYN6288_OPCODE_STATUS].retries, 1);
+    (void)syn6288_deinit(&gs_handle);
+    
+    return err;
+}
+
+/**
+ * @brief  a late text ack fails the text and is flushed by the next command
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   the frame of 11 bytes takes 12 ms on the wire at 9600 bps
+ */
+static uint8_t a_test_text_delay(void)
+{
+    uint8_t err = 0;
+    uint32_t start;
+    syn6288_status_t status;
+    const emulator_fault_t script[] = {{1, EMULATOR_FAULT_DELAY, 500}};
+    
+    if (a_test_start(script, 1) != 0)
+    {
+        return 1;
+    }
+    start = link_now();
+    err |= a_test_check("result", syn6288_synthesis_text(&gs_handle, "delay"), 1);
+    err |= a_test_check("time", link_now() - start, 100 + 12);
+    err |= a_test_check("timeouts", gs_handle.stats.opcode[SYN6288_OPCODE_SYNTHESIS].timeouts, 1);
+    link_delay_ms(500);
+    err |= a_test_check("status result", syn6288_get_status(&gs_handle, &status), 0);
+    err |= a_test_check("status", status, SYN6288_STATUS_BUSY);
+    (void)syn6288_deinit(&gs_handle);
+    
+    return err;
+}
+
+/**
+ * @brief  the playback ends at the modelled duration
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   the answers are polled, so the end is found well within 200 ms
+ */
+static uint8_t a_test_playback(void)
+{
+    uint8_t err = 0;
+    uint8_t speed = 5;
+    uint32_t start;
+    uint32_t duration;
+    syn6288_status_t status;
+    char text[] = "the weather today is sunny.";
+    
+    if (a_test_start(NULL, 0) != 0)
+    {
+        return 1;
+    }
+    duration = emulator_duration(&gs_config, SYN6288_TYPE_GB2312, &speed, (uint8_t *)text, (uint16_t)strlen(text));
+    start = link_now();
+    err |= a_test_check("result", syn6288_synthesis_text(&gs_handle, text), 0);
+    status = SYN6288_STATUS_BUSY;
+    while ((status == SYN6288_STATUS_BUSY) && (link_now() - start < duration + 1000))
+    {
+        if (syn6288_get_status(&gs_handle, &status) != 0)
+        {
+            err |= 1;
+            
+            break;
+        }
+    }
+    err |= a_test_check("status", status, SYN6288_STATUS_OK);
+    err |= a_test_check("end", (link_now() - start >= duration) && (link_now() - start <= duration + 200), 1);
+    (void)syn6288_deinit(&gs_handle);
+    
+    return err;
+}
+
+/**
+ * @brief  a full text frame is acked after its wire time at 9600 bps
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   200 bytes take 209 ms on the wire, more than the 100 ms ack timeout
+ */
+static uint8_t a_test_long_frame(void)
+{
+    uint8_t err = 0;
+    char text[201];
+    
+    if (a_test_start(NULL, 0) != 0)
+    {
+        return 1;
+    }
+    memset(text, 'a', 200);
+    text[200] = 0;
+    err |= a_test_check("result", syn6288_synthesis_text(&gs_handle, text), 0);
+    err |= a_test_check("timeouts", gs_handle.stats.opcode[SYN6288_OPCODE_SYNTHESIS].timeouts, 0);
+    (void)syn6288_deinit(&gs_handle);
+    
+    return err;
+}
+
+/**
+ * @brief  marks that don't fit in front of a full text are sent first and the text after an idle poll
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   a volume set on the handle after the queue init is sent as a mark
+ */
+static uint8_t a_test_queue_marks(void)
+{
+    uint8_t err = 0;
+    uint8_t count;
+    uint32_t start;
+    uint32_t id;
+    uint8_t text[200];
+    syn6288_queue_stats_t stats;
+    
+    if (a_test_start(NULL, 0) != 0)
+    {
+        return 1;
+    }
+    DRIVER_SYN6288_QUEUE_LINK_INIT(&gs_queue, syn6288_queue_t);
+    DRIVER_SYN6288_QUEUE_LINK_TIMESTAMP_MS(&gs_queue, syn6288_interface_timestamp_ms);
+    DRIVER_SYN6288_QUEUE_LINK_RECEIVE_CALLBACK(&gs_queue, syn6288_interface_receive_callback);
+    if (syn6288_queue_init(&gs_queue, &gs_handle) != 0)
+    {
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    err |= a_test_check("volume", syn6288_set_synthesis_volume(&gs_handle, 10), 0);
+    memset(text, 'a', 200);
+    err |= a_test_check("push", syn6288_queue_push(&gs_queue, text, 200, &id), 0);
+    (void)syn6288_reset_stats(&gs_handle);
+    err |= a_test_check("process", syn6288_queue_process(&gs_queue), 0);
+    err |= a_test_check("frames", gs_handle.stats.opcode[SYN6288_OPCODE_SYNTHESIS].frames, 2);
+    err |= a_test_check("status polls", gs_handle.stats.opcode[SYN6288_OPCODE_STATUS].frames, 1);
+    start = link_now();
+    count = 1;
+    while ((count != 0) && (link_now() - start < 120000))
+    {
+        (void)syn6288_queue_process(&gs_queue);
+        (void)syn6288_queue_get_count(&gs_queue, &count);
+        link_delay_ms(10);
+    }
+    (void)syn6288_queue_get_stats(&gs_queue, &stats);
+    err |= a_test_check("count", count, 0);
+    err |= a_test_check("link failures", stats.link_failures, 0);
+    (void)syn6288_queue_deinit(&gs_queue);
+    (void)syn6288_deinit(&gs_handle);
+    
+    return err;
+}
+
+/**
+ * @brief  lost status answers trip the health check, the recovery probes the chip and plays the item again
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   the text frame is acked and the next 3 status polls get no answer,
+ *         the recovery is one answered probe, so it ends within the ack timeout and the wire time
+ */
+static uint8_t a_test_queue_recover(void)
+{
+    uint8_t err = 0;
+    uint8_t count;
+    uint32_t start;
+    uint32_t id;
+    char text[] = "door open";
+    syn6288_queue_stats_t stats;
+    const emulator_fault_t script[] = {{2, EMULATOR_FAULT_DROP, 0}, {3, EMULATOR_FAULT_DROP, 0}, {4, EMULATOR_FAULT_DROP, 0}};
+    
+    if (a_test_start(script, 3) != 0)
+    {
+        return 1;
+    }
+    DRIVER_SYN6288_QUEUE_LINK_INIT(&gs_queue, syn6288_queue_t);
+    DRIVER_SYN6288_QUEUE_LINK_TIMESTAMP_MS(&gs_queue, syn6288_interface_timestamp_ms);
+    DRIVER_SYN6288_QUEUE_LINK_RECEIVE_CALLBACK(&gs_queue, a_test_receive_callback);
+    if (syn6288_queue_init(&gs_queue, &gs_handle) != 0)
+    {
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    gs_starts = 0;
+    err |= a_test_check("push", syn6288_queue_push(&gs_queue, (uint8_t *)text, (uint16_t)strlen(text), &id), 0);
+    start = link_now();
+    count = 1;
+    while ((count != 0) && (link_now() - start < 30000))
+    {
+        (void)syn6288_queue_process(&gs_queue);
+        (void)syn6288_queue_get_count(&gs_queue, &count);
+        link_delay_ms(10);
+    }
+    (void)syn6288_queue_get_stats(&gs_queue, &stats);
+    err |= a_test_check("count", count, 0);
+    err |= a_test_check("link failures", stats.link_failures, 3);
+    err |= a_test_check("recoveries", stats.recoveries, 1);
+    err |= a_test_check("recovery failures", stats.recovery_failures, 0);
+    err |= a_test_check("resubmitted", stats.resubmitted, 1);
+    err |= a_test_check("starts", gs_starts, 2);
+    err |= a_test_check("recovery time", stats.recovery_time_max <= 100 + 6, 1);
+    (void)syn6288_queue_deinit(&gs_queue);
+    (void)syn6288_deinit(&gs_handle);
+    
+    return err;
+}
+
+/**
+ * @brief  the driver runs without timestamp_ms and keeps the histograms empty
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   none
+ */
+static uint8_t a_test_no_timestamp(void)
+{
+    uint8_t err = 0;
+    uint8_t i;
+    uint32_t count;
+    syn6288_status_t status;
+    
+    if (a_test_start(NULL, 0) != 0)
+    {
+        return 1;
+    }
+    (void)syn6288_deinit(&gs_handle);
+    gs_handle.timestamp_ms = NULL;
+    err |= a_test_check("init", syn6288_init(&gs_handle), 0);
+    err |= a_test_check("reset", syn6288_reset_stats(&gs_handle), 0);
+    err |= a_test_check("result", syn6288_synthesis_text(&gs_handle, "no clock"), 0);
+    err |= a_test_check("status result", syn6288_get_status(&gs_handle, &status), 0);
+    count = 0;
+    for (i = 0; i < SYN6288_STATS_BUCKET_NUM; i++)
+    {
+        count += gs_handle.stats.ack_latency[i] + gs_handle.stats.first_audio[i];
+    }
+    err |= a_test_check("histogram", count, 0);
+    err |= a_test_check("frames", gs_handle.stats.opcode[SYN6288_OPCODE_SYNTHESIS].frames, 1);
+    (void)syn6288_deinit(&gs_handle);
+    
+    return err;
+}
+
+/**
+ * @brief  a deadline request waits until the playing request has played all its segments
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   the first request is cut into 3 segments and the queue takes 2 of them at once
+ */
+static uint8_t a_test_service_order(void)
+{
+    uint8_t err = 0;
+    uint16_t i;
+    uint32_t id;
+    uint32_t start;
+    uint8_t text[500];
+    syn6288_service_stats_t stats;
+    syn6288_service_request_t request;
+    
+    link_init(&gs_config, NULL, 0);
+    gs_order_num = 0;
+    if (syn6288_service_init(a_test_service_callback) != 0)
+    {
+        return 1;
+    }
+    for (i = 0; i < 500; i++)
+    {
+        text[i] = ((i % 6) == 5) ? ' ' : (uint8_t)('a' + (i % 26));
+    }
+    memset(&request, 0, sizeof(syn6288_service_request_t));
+    request.encoding = SYN6288_SERVICE_ENCODING_GB2312;
+    request.priority = SYN6288_QUEUE_PRIORITY_NORMAL;
+    request.mode = SYN6288_SERVICE_SETTING_DEFAULT;
+    request.volume = SYN6288_SERVICE_SETTING_DEFAULT;
+    request.background_volume = SYN6288_SERVICE_SETTING_DEFAULT;
+    request.speed = SYN6288_SERVICE_SETTING_DEFAULT;
+    request.tag = 1;
+    request.producer = 1;
+    request.buf = text;
+    request.len = 500;
+    err |= a_test_check("submit long", syn6288_service_submit(&request, &id), 0);
+    err |= a_test_check("process", syn6288_service_process(), 0);
+    request.tag = 2;
+    request.producer = 2;
+    request.deadline = 600000;
+    request.len = 20;
+    err |= a_test_check("submit deadline", syn6288_service_submit(&request, &id), 0);
+    start = link_now();
+    while ((gs_order_num < 4) && (link_now() - start < 600000))
+    {
+        (void)syn6288_service_process();
+        link_delay_ms(10);
+    }
+    (void)syn6288_service_get_stats(&stats);
+    err |= a_test_check("events", gs_order_num, 4);
+    err |= a_test_check("long start", gs_order[0], 1 * 16 + SYN6288_SERVICE_EVENT_START);
+    err |= a_test_check("long done", gs_order[1], 1 * 16 + SYN6288_SERVICE_EVENT_DONE);
+    err |= a_test_check("deadline start", gs_order[2], 2 * 16 + SYN6288_SERVICE_EVENT_START);
+    err |= a_test_check("deadline done", gs_order[3], 2 * 16 + SYN6288_SERVICE_EVENT_DONE);
+    err |= a_test_check("segments", stats.segments, 4);
+    (void)syn6288_service_deinit();
+    
+    return err;
+}
+
+/**
+ * @brief     run a test
+ * @param[in] *name pointer to a test name
+ * @param[in] res test result
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      none
+ */
+static uint8_t a_test_result(const char *name, uint8_t res)
+{
+    printf("test: %s %s, virtual time %u ms.\n", name, (res == 0) ? "ok" : "failed", (unsigned int)link_now());
+    
+    return (res == 0) ? 0 : 1;
+}
+
+/**
+ * @brief     print the help
+ * @note      none
+ */
+static void a_test_help(void)
+{
+    printf("Usage:\n");
+    printf("  syn6288_test [-v | --verbose]\n");
+    printf("  syn6288_test (-h | --help)\n");
+    printf("\n");
+    printf("Options:\n");
+    printf("  -h, --help                Show the help.\n");
+    printf("  -v, --verbose             Print the test messages.\n");
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note      none
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    uint32_t failed = 0;
+    const char short_options[] = "hv";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"verbose", no_argument, NULL, 'v'},
+        {NULL, 0, NULL, 0},
+    };
+    
+    /* parse the args */
+    link_set_print(0);
+    while ((c = getopt_long(argc, argv, short_options, long_options, &longindex)) != -1)
+    {
+        switch (c)
+        {
+            case 'v' :
+            {
+                link_set_print(1);
+                
+                break;
+            }
+            case 'h' :
+            {
+                a_test_help();
+                
+                return 0;
+            }
+            default :
+            {
+                a_test_help();
+                
+                return 1;
+            }
+        }
+    }
+    emulator_default_config(&gs_config);
+    
+    /* run the driver tests */
+    link_init(&gs_config, NULL, 0);
+    failed += a_test_result("register", syn6288_register_test());
+    link_init(&gs_config, NULL, 0);
+    failed += a_test_result("synthesis", syn6288_synthesis_test());
+    link_init(&gs_config, NULL, 0);
+    failed += a_test_result("queue", syn6288_queue_test());
+    link_init(&gs_config, NULL, 0);
+    failed += a_test_result("perf", syn6288_perf_test(20));
+    
+    /* run the timing tests */
+    failed += a_test_result("status drop", a_test_status_drop());
+    failed += a_test_result("status corrupt", a_test_status_corrupt());
+    failed += a_test_result("text delay", a_test_text_delay());
+    failed += a_test_result("playback", a_test_playback());
+    failed += a_test_result("long frame", a_test_long_frame());
+    failed += a_test_result("queue marks", a_test_queue_marks());
+    failed += a_test_result("queue recover", a_test_queue_recover());
+    failed += a_test_result("no timestamp", a_test_no_timestamp());
+    failed += a_test_result("service order", a_test_service_order());
+    printf("test: %u failed.\n", (unsigned int)failed);
+    
+    return (failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,219 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      linux_driver_syn6288_daemon.h
+ * @brief     linux driver syn6288 daemon header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef LINUX_DRIVER_SYN6288_DAEMON_H
+#define LINUX_DRIVER_SYN6288_DAEMON_H
+
+#include "driver_syn6288_service.h"
+#include "linux_driver_syn6288_shm.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup syn6288_daemon_driver syn6288 daemon driver function
+ * @brief    syn6288 daemon driver modules
+ * @ingroup  syn6288_driver
+ * @{
+ */
+
+/**
+ * @brief syn6288 daemon default socket definition
+ */
+#ifndef SYN6288_DAEMON_DEFAULT_SOCKET
+    #define SYN6288_DAEMON_DEFAULT_SOCKET "/tmp/syn6288.sock"        /**< socket path */
+#endif
+
+/**
+ * @brief syn6288 daemon max client definition
+ */
+#ifndef SYN6288_DAEMON_MAX_CLIENT
+    #define SYN6288_DAEMON_MAX_CLIENT 16        /**< 16 clients */
+#endif
+
+/**
+ * @brief syn6288 daemon protocol definition
+ */
+#define SYN6288_DAEMON_MAGIC      0x53594E44U        /**< "SYND" */
+#define SYN6288_DAEMON_VERSION    2                  /**< protocol version 2 */
+
+/**
+ * @brief syn6288 daemon command enumeration definition
+ */
+typedef enum
+{
+    SYN6288_DAEMON_COMMAND_SAY  = 0x00,        /**< say the text of the packet */
+    SYN6288_DAEMON_COMMAND_RING = 0x01,        /**< open a shared memory ring, the packet has no text */
+} syn6288_daemon_command_t;
+
+/**
+ * @brief syn6288 daemon event enumeration definition
+ */
+typedef enum
+{
+    SYN6288_DAEMON_EVENT_START   = 0x00,        /**< request starts playing */
+    SYN6288_DAEMON_EVENT_DONE    = 0x01,        /**< request is finished */
+    SYN6288_DAEMON_EVENT_DROP    = 0x02,        /**< request is dropped */
+    SYN6288_DAEMON_EVENT_PREEMPT = 0x03,        /**< request is interrupted and queued again */
+    SYN6288_DAEMON_EVENT_ACCEPT  = 0x10,        /**< request is queued */
+    SYN6288_DAEMON_EVENT_REJECT  = 0x11,        /**< request is refused */
+} syn6288_daemon_event_type_t;
+
+/**
+ * @brief syn6288 daemon reject reason enumeration definition
+ */
+typedef enum
+{
+    SYN6288_DAEMON_REJECT_NONE     = 0x00,        /**< no reason */
+    SYN6288_DAEMON_REJECT_FULL     = 0x01,        /**< service is full */
+    SYN6288_DAEMON_REJECT_INVALID  = 0x02,        /**< request is invalid */
+    SYN6288_DAEMON_REJECT_PROTOCOL = 0x03,        /**< wrong magic, version or size */
+} syn6288_daemon_reject_t;
+
+/**
+ * @brief syn6288 daemon request message structure definition
+ * @note  one request is one packet of a seqpacket socket, the text fills the rest of the packet
+ */
+typedef struct syn6288_daemon_request_s
+{
+    uint32_t magic;                             /**< SYN6288_DAEMON_MAGIC */
+    uint8_t version;                            /**< SYN6288_DAEMON_VERSION */
+    uint8_t encoding;                           /**< text encoding */
+    uint8_t priority;                           /**< queue priority */
+    uint8_t mode;                               /**< background mode or default */
+    uint8_t volume;                             /**< synthesis volume or default */
+    uint8_t background_volume;                  /**< background volume or default */
+    uint8_t speed;                              /**< synthesis speed or default */
+    uint8_t command;                            /**< daemon command */
+    uint32_t tag;                               /**< client tag, echoed in the events */
+    uint32_t deadline;                          /**< latest start after the submit in ms, 0 means none */
+    uint32_t producer;                          /**< producer id, the speaking time is shared by the producers */
+    uint8_t weight;                             /**< producer weight, 0 keeps the current weight */
+    uint8_t reserved[3];                        /**< reserved */
+    uint8_t text[SYN6288_SERVICE_MAX_TEXT];     /**< text */
+} syn6288_daemon_request_t;
+
+/**
+ * @brief syn6288 daemon request header size definition
+ */
+#define SYN6288_DAEMON_REQUEST_HEADER (sizeof(syn6288_daemon_request_t) - SYN6288_SERVICE_MAX_TEXT)        /**< header size */
+
+/**
+ * @brief syn6288 daemon event message structure definition
+ */
+typedef struct syn6288_daemon_event_s
+{
+    uint32_t magic;           /**< SYN6288_DAEMON_MAGIC */
+    uint32_t tag;             /**< client tag */
+    uint32_t id;              /**< request id */
+    uint8_t type;             /**< event type */
+    uint8_t reason;           /**< reject reason */
+    uint8_t reserved[2];      /**< reserved */
+    uint32_t wait;            /**< time from the submit to the start in ms */
+    uint32_t time;            /**< time from the submit to the event in ms */
+} syn6288_daemon_event_t;
+
+/**
+ * @brief     daemon run
+ * @param[in] *path pointer to a socket path
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the daemon owns the chip, serves the clients until syn6288_daemon_stop is called
+ *            and prints the service stats at the end
+ */
+uint8_t syn6288_daemon_run(const char *path);
+
+/**
+ * @brief daemon stop
+ * @note  async signal safe
+ */
+void syn6288_daemon_stop(void);
+
+/**
+ * @brief     daemon client say
+ * @param[in] *path pointer to a socket path
+ * @param[in] *request pointer to a request message
+ * @param[in] len text length
+ * @param[in] *callback pointer to an event callback
+ * @return    status code
+ *            - 0 success
+ *            - 1 say failed
+ * @note      the magic and the version are filled in, the events are passed to the callback
+ *            until the request is done, dropped or rejected, only a done request is a success
+ */
+uint8_t syn6288_daemon_say(const char *path, syn6288_daemon_request_t *request, uint16_t len,
+                           void (*callback)(syn6288_daemon_event_t *event));
+
+/**
+ * @brief      daemon client open a shared memory ring
+ * @param[in]  *path pointer to a socket path
+ * @param[out] *fd pointer to a socket buffer
+ * @param[out] *producer pointer to a producer structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 open failed
+ * @note       the events of the ring requests are read from the socket, the ring is closed
+ *             by syn6288_shm_producer_deinit and closing the socket
+ */
+uint8_t syn6288_daemon_ring_open(const char *path, int *fd, syn6288_shm_producer_t *producer);
+
+/**
+ * @brief     daemon client say through a shared memory ring
+ * @param[in] *path pointer to a socket path
+ * @param[in] *request pointer to a request message
+ * @param[in] len text length
+ * @param[in] times request number
+ * @param[in] *callback pointer to an event callback
+ * @return    status code
+ *            - 0 success
+ *            - 1 say failed
+ * @note      the request is written in place times times, the events are passed to the callback
+ *            until every request is done, dropped or rejected, only all done is a success
+ */
+uint8_t syn6288_daemon_ring_say(const char *path, syn6288_daemon_request_t *request, uint16_t len, uint32_t times,
+                                void (*callback)(syn6288_daemon_event_t *event));
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      linux_driver_syn6288_interface.h
+ * @brief     linux driver syn6288 interface header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef LINUX_DRIVER_SYN6288_INTERFACE_H
+#define LINUX_DRIVER_SYN6288_INTERFACE_H
+
+#include "driver_syn6288_interface.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup syn6288_interface_driver
+ * @{
+ */
+
+/**
+ * @brief     interface set the uart device
+ * @param[in] *name pointer to a device name
+ * @note      used by the next uart init, the default is SYN6288_DEVICE or /dev/ttyS0
+ */
+void syn6288_interface_set_device(const char *name);
+
+/**
+ * @brief     interface set the uart baud rate
+ * @param[in] baud baud rate
+ * @note      used by the next uart init, the default is SYN6288_BAUD or 9600
+ */
+void syn6288_interface_set_baud(uint32_t baud);
+
+/**
+ * @brief     interface set the enable gpio line
+ * @param[in] *chip pointer to a chip name, NULL disables the line
+ * @param[in] line line offset of the chip
+ * @param[in] active_low 1 if the line is active low
+ * @note      used by the next uart init, the default is SYN6288_GPIO or none
+ */
+void syn6288_interface_set_gpio(const char *chip, uint32_t line, uint8_t active_low);
+
+/**
+ * @brief      interface get the current settings
+ * @param[out] **name pointer to a device name pointer
+ * @param[out] *baud pointer to a baud rate buffer
+ * @param[out] **chip pointer to a chip name pointer, NULL if no line is used
+ * @param[out] *line pointer to a line offset buffer
+ * @param[out] *active_low pointer to an active low flag buffer
+ * @note       none
+ */
+void syn6288_interface_get_settings(const char **name, uint32_t *baud, const char **chip,
+                                    uint32_t *line, uint8_t *active_low);
+
+/**
+ * @brief      interface parse a gpio option
+ * @param[in]  *str pointer to a "chip:line[:low]" string
+ * @param[out] *chip pointer to a chip name buffer
+ * @param[in]  size chip name buffer size
+ * @param[out] *line pointer to a line offset buffer
+ * @param[out] *active_low pointer to an active low flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 parse failed
+ * @note       none
+ */
+uint8_t syn6288_interface_parse_gpio(const char *str, char *chip, uint32_t size,
+                                     uint32_t *line, uint8_t *active_low);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,247 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      linux_driver_syn6288_shm.h
+ * @brief     linux driver syn6288 shm header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef LINUX_DRIVER_SYN6288_SHM_H
+#define LINUX_DRIVER_SYN6288_SHM_H
+
+#include "driver_syn6288_service.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup syn6288_shm_driver syn6288 shm driver function
+ * @brief    syn6288 shm driver modules
+ * @ingroup  syn6288_driver
+ * @{
+ */
+
+/**
+ * @brief syn6288 shm slot number definition
+ * @note  must be a power of 2
+ */
+#ifndef SYN6288_SHM_SLOTS
+    #define SYN6288_SHM_SLOTS 64        /**< 64 slots */
+#endif
+
+/**
+ * @brief syn6288 shm layout definition
+ */
+#define SYN6288_SHM_MAGIC      0x53594E52U        /**< "SYNR" */
+#define SYN6288_SHM_VERSION    2                  /**< layout version 2 */
+
+/**
+ * @brief syn6288 shm slot structure definition
+ * @note  the producer writes the request in place, the consumer plays the text from the slot
+ */
+typedef struct syn6288_shm_slot_s
+{
+    uint32_t tag;                                  /**< client tag, echoed in the events */
+    uint32_t deadline;                             /**< latest start after the submit in ms, 0 means none */
+    uint32_t producer;                             /**< producer id, the speaking time is shared by the producers */
+    uint8_t encoding;                              /**< text encoding */
+    uint8_t priority;                              /**< queue priority */
+    uint8_t mode;                                  /**< background mode or default */
+    uint8_t volume;                                /**< synthesis volume or default */
+    uint8_t background_volume;                     /**< background volume or default */
+    uint8_t speed;                                 /**< synthesis speed or default */
+    uint8_t weight;                                /**< producer weight, 0 keeps the current weight */
+    uint8_t reserved;                              /**< reserved */
+    uint16_t len;                                  /**< text length */
+    uint8_t text[SYN6288_SERVICE_MAX_TEXT];        /**< text */
+} syn6288_shm_slot_t;
+
+/**
+ * @brief syn6288 shm ring structure definition
+ * @note  the indexes are free running, each one is written by one side only and sits in its own cache line
+ */
+typedef struct syn6288_shm_ring_s
+{
+    uint32_t magic;                                    /**< SYN6288_SHM_MAGIC */
+    uint32_t version;                                  /**< SYN6288_SHM_VERSION */
+    uint32_t slots;                                    /**< slot number */
+    uint32_t size;                                     /**< structure size */
+    uint8_t pad0[48];                                  /**< cache line padding */
+    uint32_t head;                                     /**< next slot to publish, written by the producer */
+    uint8_t pad1[60];                                  /**< cache line padding */
+    uint32_t tail;                                     /**< first slot not released, written by the consumer */
+    uint8_t pad2[60];                                  /**< cache line padding */
+    uint32_t waiting;                                  /**< consumer sleeps flag, written by the consumer */
+    uint8_t pad3[60];                                  /**< cache line padding */
+    syn6288_shm_slot_t slot[SYN6288_SHM_SLOTS];        /**< slots */
+} syn6288_shm_ring_t;
+
+/**
+ * @brief syn6288 shm producer structure definition
+ */
+typedef struct syn6288_shm_producer_s
+{
+    syn6288_shm_ring_t *ring;        /**< point to the mapped ring */
+    int memfd;                       /**< shared memory handle */
+    int efd;                         /**< wake up handle */
+    uint32_t head;                   /**< local copy of the head */
+    uint32_t commits;                /**< published slots */
+    uint32_t wakes;                  /**< wake ups written */
+    uint32_t full;                   /**< reserves refused by a full ring */
+} syn6288_shm_producer_t;
+
+/**
+ * @brief syn6288 shm consumer structure definition
+ */
+typedef struct syn6288_shm_consumer_s
+{
+    syn6288_shm_ring_t *ring;               /**< point to the mapped ring */
+    int memfd;                              /**< shared memory handle */
+    int efd;                                /**< wake up handle */
+    uint32_t next;                          /**< next slot to take */
+    uint32_t tail;                          /**< local copy of the tail */
+    uint32_t id[SYN6288_SHM_SLOTS];         /**< request id of the taken slots */
+    uint8_t done[SYN6288_SHM_SLOTS];        /**< released flags of the taken slots */
+} syn6288_shm_consumer_t;
+
+/**
+ * @brief      shm consumer init
+ * @param[out] *consumer pointer to a consumer structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       the ring is created in an anonymous shared memory file with an eventfd for the wake ups
+ */
+uint8_t syn6288_shm_consumer_init(syn6288_shm_consumer_t *consumer);
+
+/**
+ * @brief     shm consumer deinit
+ * @param[in] *consumer pointer to a consumer structure
+ * @note      none
+ */
+void syn6288_shm_consumer_deinit(syn6288_shm_consumer_t *consumer);
+
+/**
+ * @brief      shm consumer peek the next published slot
+ * @param[in]  *consumer pointer to a consumer structure
+ * @param[out] **slot pointer to a slot pointer
+ * @return     1 if a slot is published, else 0
+ * @note       the slot stays published until it is taken
+ */
+uint8_t syn6288_shm_consumer_peek(syn6288_shm_consumer_t *consumer, syn6288_shm_slot_t **slot);
+
+/**
+ * @brief     shm consumer take the peeked slot
+ * @param[in] *consumer pointer to a consumer structure
+ * @param[in] id request id of the slot
+ * @note      the slot is owned by the consumer until it is released
+ */
+void syn6288_shm_consumer_take(syn6288_shm_consumer_t *consumer, uint32_t id);
+
+/**
+ * @brief     shm consumer release a taken slot
+ * @param[in] *consumer pointer to a consumer structure
+ * @param[in] id request id of the slot
+ * @return    1 if the id is found, else 0
+ * @note      slots are returned to the producer in order, a slot released early waits for the ones before it
+ */
+uint8_t syn6288_shm_consumer_release(syn6288_shm_consumer_t *consumer, uint32_t id);
+
+/**
+ * @brief     shm consumer check the taken slots
+ * @param[in] *consumer pointer to a consumer structure
+ * @return    1 if a taken slot is not released, else 0
+ * @note      none
+ */
+uint8_t syn6288_shm_consumer_busy(syn6288_shm_consumer_t *consumer);
+
+/**
+ * @brief     shm consumer prepare to sleep
+ * @param[in] *consumer pointer to a consumer structure
+ * @return    1 if a slot is already published and the consumer must not sleep, else 0
+ * @note      the producer writes the eventfd only after this call, call syn6288_shm_consumer_wake after the sleep
+ */
+uint8_t syn6288_shm_consumer_sleep(syn6288_shm_consumer_t *consumer);
+
+/**
+ * @brief     shm consumer wake up
+ * @param[in] *consumer pointer to a consumer structure
+ * @note      the eventfd is drained
+ */
+void syn6288_shm_consumer_wake(syn6288_shm_consumer_t *consumer);
+
+/**
+ * @brief     shm producer init
+ * @param[in] *producer pointer to a producer structure
+ * @param[in] memfd shared memory handle
+ * @param[in] efd wake up handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the producer owns the handles after a success
+ */
+uint8_t syn6288_shm_producer_init(syn6288_shm_producer_t *producer, int memfd, int efd);
+
+/**
+ * @brief     shm producer deinit
+ * @param[in] *producer pointer to a producer structure
+ * @note      none
+ */
+void syn6288_shm_producer_deinit(syn6288_shm_producer_t *producer);
+
+/**
+ * @brief      shm producer reserve a slot
+ * @param[in]  *producer pointer to a producer structure
+ * @param[out] **slot pointer to a slot pointer
+ * @return     status code
+ *             - 0 success
+ *             - 1 ring is full
+ * @note       write the request in the slot and commit it, no system call is made
+ */
+uint8_t syn6288_shm_producer_reserve(syn6288_shm_producer_t *producer, syn6288_shm_slot_t **slot);
+
+/**
+ * @brief     shm producer commit the reserved slot
+ * @param[in] *producer pointer to a producer structure
+ * @note      the eventfd is only written when the consumer sleeps
+ */
+void syn6288_shm_producer_commit(syn6288_shm_producer_t *producer);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,940 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      linux_driver_syn6288_daemon.c
+ * @brief     linux driver syn6288 daemon source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _GNU_SOURCE
+#include "linux_driver_syn6288_daemon.h"
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief syn6288 daemon poll interval definition
+ */
+#define SYN6288_DAEMON_POLL_MS 20        /**< 20 ms */
+
+/**
+ * @brief syn6288 daemon client structure definition
+ */
+typedef struct syn6288_daemon_client_s
+{
+    int fd;                                /**< socket, -1 if the client is closed */
+    uint32_t gen;                          /**< slot generation */
+    uint8_t ring_used;                     /**< 1 if the client has a ring */
+    uint8_t ring_slept;                    /**< 1 if the ring eventfd is polled */
+    uint8_t ring_blocked;                  /**< 1 if the service is full */
+    syn6288_shm_consumer_t ring;           /**< shared memory ring */
+} syn6288_daemon_client_t;
+
+static volatile sig_atomic_t gs_stop;                                /**< stop flag */
+static syn6288_daemon_client_t gs_client[SYN6288_DAEMON_MAX_CLIENT];  /**< client slots */
+static syn6288_daemon_request_t gs_request;                          /**< request buffer */
+
+/**
+ * @brief      fill a unix socket address
+ * @param[in]  *path pointer to a socket path
+ * @param[out] *addr pointer to an address buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 path is too long
+ * @note       none
+ */
+static uint8_t a_daemon_addr(const char *path, struct sockaddr_un *addr)
+{
+    memset(addr, 0, sizeof(struct sockaddr_un));
+    addr->sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr->sun_path))
+    {
+        syn6288_interface_debug_print("syn6288: socket path is too long.\n");
+        
+        return 1;
+    }
+    strcpy(addr->sun_path, path);
+    
+    return 0;
+}
+
+/**
+ * @brief     send an event to a client
+ * @param[in] fd client socket
+ * @param[in] *event pointer to an event message
+ * @note      a client that doesn't read its events loses them instead of blocking the daemon
+ */
+static void a_daemon_send(int fd, syn6288_daemon_event_t *event)
+{
+    event->magic = SYN6288_DAEMON_MAGIC;
+    (void)send(fd, event, sizeof(syn6288_daemon_event_t), MSG_DONTWAIT | MSG_NOSIGNAL);
+}
+
+/**
+ * @brief     service event callback
+ * @param[in] *event pointer to a service event
+ * @note      events of a closed client are discarded, the request itself is still played
+ */
+static void a_daemon_event(syn6288_service_event_t *event)
+{
+    uint32_t i;
+    syn6288_daemon_event_t msg;
+    
+    i = event->client & 0xFF;
+    if (i >= SYN6288_DAEMON_MAX_CLIENT)
+    {
+        return;
+    }
+    
+    /* a ring slot is played in place until the final event, even for a closed client */
+    if ((gs_client[i].ring_used != 0) &&
+        ((event->type == SYN6288_SERVICE_EVENT_DONE) || (event->type == SYN6288_SERVICE_EVENT_DROP)))
+    {
+        (void)syn6288_shm_consumer_release(&gs_client[i].ring, event->id);
+    }
+    if ((gs_client[i].fd < 0) || (gs_client[i].gen != (event->client >> 8)))
+    {
+        return;
+    }
+    memset(&msg, 0, sizeof(syn6288_daemon_event_t));
+    msg.tag = event->tag;
+    msg.id = event->id;
+    msg.type = event->type;
+    msg.wait = event->wait;
+    msg.time = event->time;
+    a_daemon_send(gs_client[i].fd, &msg);
+}
+
+/**
+ * @brief     open the ring of a client
+ * @param[in] i client slot
+ * @param[in] valid 1 if the packet is a valid ring command
+ * @note      the ring handles are passed with the accept event, a client has one ring at most
+ */
+static void a_daemon_ring(uint32_t i, uint8_t valid)
+{
+    int fds[2];
+    char control[CMSG_SPACE(sizeof(fds))];
+    struct msghdr mh;
+    struct iovec iov;
+    struct cmsghdr *cmsg;
+    syn6288_daemon_event_t msg;
+    
+    memset(&msg, 0, sizeof(syn6288_daemon_event_t));
+    msg.tag = gs_request.tag;
+    if ((valid == 0) || (gs_client[i].ring_used != 0))
+    {
+        msg.type = SYN6288_DAEMON_EVENT_REJECT;
+        msg.reason = SYN6288_DAEMON_REJECT_PROTOCOL;
+        a_daemon_send(gs_client[i].fd, &msg);
+        
+        return;
+    }
+    if (syn6288_shm_consumer_init(&gs_client[i].ring) != 0)
+    {
+        msg.type = SYN6288_DAEMON_EVENT_REJECT;
+        msg.reason = SYN6288_DAEMON_REJECT_FULL;
+        a_daemon_send(gs_client[i].fd, &msg);
+        
+        return;
+    }
+    gs_client[i].ring_used = 1;
+    gs_client[i].ring_slept = 0;
+    gs_client[i].ring_blocked = 0;
+    
+    /* pass the memfd and the eventfd with the accept event */
+    msg.magic = SYN6288_DAEMON_MAGIC;
+    msg.type = SYN6288_DAEMON_EVENT_ACCEPT;
+    fds[0] = gs_client[i].ring.memfd;
+    fds[1] = gs_client[i].ring.efd;
+    memset(&mh, 0, sizeof(struct msghdr));
+    memset(control, 0, sizeof(control));
+    iov.iov_base = &msg;
+    iov.iov_len = sizeof(syn6288_daemon_event_t);
+    mh.msg_iov = &iov;
+    mh.msg_iovlen = 1;
+    mh.msg_control = control;
+    mh.msg_controllen = sizeof(control);
+    cmsg = CMSG_FIRSTHDR(&mh);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+    memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+    (void)sendmsg(gs_client[i].fd, &mh, MSG_DONTWAIT | MSG_NOSIGNAL);
+    syn6288_interface_debug_print("syn6288: client %d ring opened with %d slots.\n", i, SYN6288_SHM_SLOTS);
+}
+
+/**
+ * @brief     submit the published slots of a ring
+ * @param[in] i client slot
+ * @note      the text is played from the slot, a slot stays published while the service is full
+ */
+static void a_daemon_consume(uint32_t i)
+{
+    uint8_t res;
+    uint32_t id;
+    syn6288_shm_slot_t *slot;
+    syn6288_service_request_t req;
+    syn6288_service_stats_t stats;
+    syn6288_daemon_event_t msg;
+    
+    gs_client[i].ring_blocked = 0;
+    while (syn6288_shm_consumer_peek(&gs_client[i].ring, &slot) != 0)
+    {
+        /* wait for a free request instead of a rejected submit */
+        (void)syn6288_service_get_stats(&stats);
+        if (stats.pending >= SYN6288_SERVICE_MAX_REQUEST)
+        {
+            gs_client[i].ring_blocked = 1;
+            
+            return;
+        }
+        
+        /* the client may still write the slot, read every field once */
+        req.client = i | (gs_client[i].gen << 8);
+        req.tag = slot->tag;
+        req.encoding = slot->encoding;
+        req.priority = slot->priority;
+        req.deadline = slot->deadline;
+        req.mode = slot->mode;
+        req.volume = slot->volume;
+        req.background_volume = slot->background_volume;
+        req.speed = slot->speed;
+        req.producer = slot->producer;
+        req.weight = slot->weight;
+        req.buf = slot->text;
+        req.len = slot->len;
+        if (req.len > SYN6288_SERVICE_MAX_TEXT)
+        {
+            req.len = 0;
+        }
+        if (req.encoding == SYN6288_SERVICE_ENCODING_UTF8)
+        {
+            res = syn6288_service_submit(&req, &id);
+        }
+        else
+        {
+            res = syn6288_service_submit_zero_copy(&req, &id);
+        }
+        if (res == 1)
+        {
+            gs_client[i].ring_blocked = 1;
+            
+            return;
+        }
+        if (res != 0)
+        {
+            memset(&msg, 0, sizeof(syn6288_daemon_event_t));
+            msg.tag = req.tag;
+            msg.type = SYN6288_DAEMON_EVENT_REJECT;
+            msg.reason = SYN6288_DAEMON_REJECT_INVALID;
+            a_daemon_send(gs_client[i].fd, &msg);
+            syn6288_shm_consumer_take(&gs_client[i].ring, 0);
+            (void)syn6288_shm_consumer_release(&gs_client[i].ring, 0);
+            
+            continue;
+        }
+        syn6288_shm_consumer_take(&gs_client[i].ring, id);
+        
+        /* a transcoded text is copied, the slot is free at once */
+        if (req.encoding == SYN6288_SERVICE_ENCODING_UTF8)
+        {
+            (void)syn6288_shm_consumer_release(&gs_client[i].ring, id);
+        }
+    }
+}
+
+/**
+ * @brief     read a request of a client
+ * @param[in] i client slot
+ * @return    status code
+ *            - 0 success
+ *            - 1 client is closed
+ * @note      none
+ */
+static uint8_t a_daemon_read(uint32_t i)
+{
+    uint8_t res;
+    uint32_t id;
+    ssize_t n;
+    syn6288_service_request_t req;
+    syn6288_daemon_event_t msg;
+    
+    n = recv(gs_client[i].fd, &gs_request, sizeof(syn6288_daemon_request_t), MSG_DONTWAIT | MSG_TRUNC);
+    if (n < 0)
+    {
+        return ((errno == EAGAIN) || (errno == EINTR)) ? 0 : 1;
+    }
+    if (n == 0)
+    {
+        return 1;
+    }
+    memset(&msg, 0, sizeof(syn6288_daemon_event_t));
+    if (((size_t)n >= SYN6288_DAEMON_REQUEST_HEADER) && (gs_request.magic == SYN6288_DAEMON_MAGIC) &&
+        (gs_request.version == SYN6288_DAEMON_VERSION) && (gs_request.command == SYN6288_DAEMON_COMMAND_RING))
+    {
+        a_daemon_ring(i, (size_t)n == SYN6288_DAEMON_REQUEST_HEADER);
+        
+        return 0;
+    }
+    if (((size_t)n <= SYN6288_DAEMON_REQUEST_HEADER) || ((size_t)n > sizeof(syn6288_daemon_request_t)) ||
+        (gs_request.magic != SYN6288_DAEMON_MAGIC) || (gs_request.version != SYN6288_DAEMON_VERSION) ||
+        (gs_request.command != SYN6288_DAEMON_COMMAND_SAY))
+    {
+        msg.type = SYN6288_DAEMON_EVENT_REJECT;
+        msg.reason = SYN6288_DAEMON_REJECT_PROTOCOL;
+        a_daemon_send(gs_client[i].fd, &msg);
+        
+        return 0;
+    }
+    req.client = i | (gs_client[i].gen << 8);
+    req.tag = gs_request.tag;
+    req.encoding = gs_request.encoding;
+    req.priority = gs_request.priority;
+    req.deadline = gs_request.deadline;
+    req.mode = gs_request.mode;
+    req.volume = gs_request.volume;
+    req.background_volume = gs_request.background_volume;
+    req.speed = gs_request.speed;
+    req.producer = gs_request.producer;
+    req.weight = gs_request.weight;
+    req.buf = gs_request.text;
+    req.len = (uint16_t)((size_t)n - SYN6288_DAEMON_REQUEST_HEADER);
+    msg.tag = gs_request.tag;
+    res = syn6288_service_submit(&req, &id);
+    if (res != 0)
+    {
+        msg.type = SYN6288_DAEMON_EVENT_REJECT;
+        msg.reason = (res == 1) ? SYN6288_DAEMON_REJECT_FULL : SYN6288_DAEMON_REJECT_INVALID;
+        a_daemon_send(gs_client[i].fd, &msg);
+        syn6288_interface_debug_print("syn6288: client %d request rejected.\n", i);
+        
+        return 0;
+    }
+    msg.type = SYN6288_DAEMON_EVENT_ACCEPT;
+    msg.id = id;
+    a_daemon_send(gs_client[i].fd, &msg);
+    syn6288_interface_debug_print("syn6288: client %d request %d queued with priority %d for producer %d.\n",
+                                  i, id, req.priority, req.producer);
+    
+    return 0;
+}
+
+/**
+ * @brief     accept a client
+ * @param[in] fd listening socket
+ * @note      a client over SYN6288_DAEMON_MAX_CLIENT is closed at once
+ */
+static void a_daemon_accept(int fd)
+{
+    int c;
+    uint32_t i;
+    
+    c = accept4(fd, NULL, NULL, SOCK_CLOEXEC | SOCK_NONBLOCK);
+    if (c < 0)
+    {
+        return;
+    }
+    for (i = 0; i < SYN6288_DAEMON_MAX_CLIENT; i++)
+    {
+        if ((gs_client[i].fd < 0) && (gs_client[i].ring_used == 0))
+        {
+            gs_client[i].fd = c;
+            syn6288_interface_debug_print("syn6288: client %d connected.\n", i);
+            
+            return;
+        }
+    }
+    syn6288_interface_debug_print("syn6288: too many clients.\n");
+    (void)close(c);
+}
+
+/**
+ * @brief     close the ring of a closed client
+ * @param[in] i client slot
+ * @note      nothing is done while a slot is played
+ */
+static void a_daemon_ring_close(uint32_t i)
+{
+    if ((gs_client[i].ring_used != 0) && (syn6288_shm_consumer_busy(&gs_client[i].ring) == 0))
+    {
+        syn6288_shm_consumer_deinit(&gs_client[i].ring);
+        gs_client[i].ring_used = 0;
+    }
+}
+
+/**
+ * @brief     close a client
+ * @param[in] i client slot
+ * @note      the generation is changed so the events of its requests are discarded,
+ *            a ring with playing slots is kept until they are released
+ */
+static void a_daemon_close(uint32_t i)
+{
+    (void)close(gs_client[i].fd);
+    gs_client[i].fd = -1;
+    gs_client[i].gen = (gs_client[i].gen + 1) & 0xFFFFFF;
+    syn6288_interface_debug_print("syn6288: client %d disconnected.\n", i);
+    a_daemon_ring_close(i);
+}
+
+/**
+ * @brief     daemon run
+ * @param[in] *path pointer to a socket path
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the daemon owns the chip, serves the clients until syn6288_daemon_stop is called
+ *            and prints the service stats at the end
+ */
+uint8_t syn6288_daemon_run(const char *path)
+{
+    int fd;
+    int n;
+    int timeout;
+    uint32_t i;
+    uint32_t num;
+    uint32_t sock;
+    uint8_t failed;
+    struct sockaddr_un addr;
+    struct pollfd pfd[SYN6288_DAEMON_MAX_CLIENT * 2 + 1];
+    uint32_t slot[SYN6288_DAEMON_MAX_CLIENT * 2 + 1];
+    syn6288_service_stats_t stats;
+    syn6288_service_producer_stats_t producer;
+    
+    if (a_daemon_addr(path, &addr) != 0)
+    {
+        return 1;
+    }
+    
+    /* refuse to replace the socket of a running daemon */
+    fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        perror("syn6288: socket failed.\n");
+        
+        return 1;
+    }
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(struct sockaddr_un)) == 0)
+    {
+        syn6288_interface_debug_print("syn6288: a daemon is already running on %s.\n", path);
+        (void)close(fd);
+        
+        return 1;
+    }
+    (void)unlink(path);
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(struct sockaddr_un)) != 0)
+    {
+        perror("syn6288: bind failed.\n");
+        (void)close(fd);
+        
+        return 1;
+    }
+    if (listen(fd, SYN6288_DAEMON_MAX_CLIENT) != 0)
+    {
+        perror("syn6288: listen failed.\n");
+        (void)close(fd);
+        (void)unlink(path);
+        
+        return 1;
+    }
+    
+    /* the service owns the chip */
+    if (syn6288_service_init(a_daemon_event) != 0)
+    {
+        (void)close(fd);
+        (void)unlink(path);
+        
+        return 1;
+    }
+    for (i = 0; i < SYN6288_DAEMON_MAX_CLIENT; i++)
+    {
+        gs_client[i].fd = -1;
+        gs_client[i].gen = 0;
+        gs_client[i].ring_used = 0;
+    }
+    syn6288_interface_debug_print("syn6288: daemon listening on %s.\n", path);
+    
+    failed = 0;
+    gs_stop = 0;
+    while (gs_stop == 0)
+    {
+        pfd[0].fd = fd;
+        pfd[0].events = POLLIN;
+        num = 1;
+        for (i = 0; i < SYN6288_DAEMON_MAX_CLIENT; i++)
+        {
+            if (gs_client[i].fd >= 0)
+            {
+                pfd[num].fd = gs_client[i].fd;
+                pfd[num].events = POLLIN;
+                slot[num] = i;
+                num++;
+            }
+        }
+        sock = num;
+        
+        /* a ring producer writes its eventfd only when the ring sleeps */
+        timeout = SYN6288_DAEMON_POLL_MS;
+        for (i = 0; i < SYN6288_DAEMON_MAX_CLIENT; i++)
+        {
+            gs_client[i].ring_slept = 0;
+            if ((gs_client[i].fd < 0) || (gs_client[i].ring_used == 0) || (gs_client[i].ring_blocked != 0))
+            {
+                continue;
+            }
+            if (syn6288_shm_consumer_sleep(&gs_client[i].ring) != 0)
+            {
+                timeout = 0;
+                
+                continue;
+            }
+            gs_client[i].ring_slept = 1;
+            pfd[num].fd = gs_client[i].ring.efd;
+            pfd[num].events = POLLIN;
+            slot[num] = i;
+            num++;
+        }
+        n = poll(pfd, num, timeout);
+        for (i = 0; i < SYN6288_DAEMON_MAX_CLIENT; i++)
+        {
+            if (gs_client[i].ring_slept != 0)
+            {
+                syn6288_shm_consumer_wake(&gs_client[i].ring);
+            }
+        }
+        if (n > 0)
+        {
+            for (i = 1; i < sock; i++)
+            {
+                if ((pfd[i].revents & (POLLIN | POLLHUP | POLLERR)) != 0)
+                {
+                    if (a_daemon_read(slot[i]) != 0)
+                    {
+                        a_daemon_close(slot[i]);
+                    }
+                }
+            }
+            if ((pfd[0].revents & POLLIN) != 0)
+            {
+                a_daemon_accept(fd);
+            }
+        }
+        for (i = 0; i < SYN6288_DAEMON_MAX_CLIENT; i++)
+        {
+            if (gs_client[i].ring_used == 0)
+            {
+                continue;
+            }
+            if (gs_client[i].fd >= 0)
+            {
+                a_daemon_consume(i);
+            }
+            else
+            {
+                a_daemon_ring_close(i);
+            }
+        }
+        
+        /* a failed transaction is retried by the queue */
+        if (syn6288_service_process() != 0)
+        {
+            if (failed == 0)
+            {
+                syn6288_interface_debug_print("syn6288: service process failed.\n");
+            }
+            failed = 1;
+        }
+        else
+        {
+            failed = 0;
+        }
+    }
+    
+    (void)syn6288_service_get_stats(&stats);
+    syn6288_interface_debug_print("syn6288: %d requests, %d done, %d dropped, %d rejected, %d preempted.\n",
+                                  stats.submitted, stats.done, stats.dropped, stats.rejected, stats.preempted);
+    syn6288_interface_debug_print("syn6288: wait avg %dms max %dms, %d played in place.\n",
+                                  stats.wait_avg, stats.wait_max, stats.zero_copy);
+    for (i = 0; i < SYN6288_SERVICE_MAX_PRODUCER; i++)
+    {
+        if (syn6288_service_get_producer_stats((uint8_t)i, &producer) == 0)
+        {
+            syn6288_interface_debug_print("syn6288: producer %d weight %d, %d requests, %d done, %d dropped, "
+                                          "speaking %dms share %d.%d%%, wait avg %dms max %dms.\n",
+                                          producer.producer, producer.weight, producer.submitted, producer.done,
+                                          producer.dropped, producer.time, producer.share / 10, producer.share % 10,
+                                          producer.wait_avg, producer.wait_max);
+        }
+    }
+    for (i = 0; i < SYN6288_DAEMON_MAX_CLIENT; i++)
+    {
+        if (gs_client[i].fd >= 0)
+        {
+            a_daemon_close(i);
+        }
+    }
+    (void)close(fd);
+    (void)unlink(path);
+    failed = syn6288_service_deinit();
+    
+    /* the service doesn't read the rings any more */
+    for (i = 0; i < SYN6288_DAEMON_MAX_CLIENT; i++)
+    {
+        if (gs_client[i].ring_used != 0)
+        {
+            syn6288_shm_consumer_deinit(&gs_client[i].ring);
+            gs_client[i].ring_used = 0;
+        }
+    }
+    
+    return failed;
+}
+
+/**
+ * @brief daemon stop
+ * @note  async signal safe
+ */
+void syn6288_daemon_stop(void)
+{
+    gs_stop = 1;
+}
+
+/**
+ * @brief     daemon client say
+ * @param[in] *path pointer to a socket path
+ * @param[in] *request pointer to a request message
+ * @param[in] len text length
+ * @param[in] *callback pointer to an event callback
+ * @return    status code
+ *            - 0 success
+ *            - 1 say failed
+ * @note      the magic and the version are filled in, the events are passed to the callback
+ *            until the request is done, dropped or rejected, only a done request is a success
+ */
+uint8_t syn6288_daemon_say(const char *path, syn6288_daemon_request_t *request, uint16_t len,
+                           void (*callback)(syn6288_daemon_event_t *event))
+{
+    int fd;
+    ssize_t n;
+    struct sockaddr_un addr;
+    syn6288_daemon_event_t event;
+    
+    if ((len == 0) || (len > SYN6288_SERVICE_MAX_TEXT))
+    {
+        syn6288_interface_debug_print("syn6288: text length is invalid.\n");
+        
+        return 1;
+    }
+    if (a_daemon_addr(path, &addr) != 0)
+    {
+        return 1;
+    }
+    fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        perror("syn6288: socket failed.\n");
+        
+        return 1;
+    }
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(struct sockaddr_un)) != 0)
+    {
+        syn6288_interface_debug_print("syn6288: connect %s failed.\n", path);
+        (void)close(fd);
+        
+        return 1;
+    }
+    request->magic = SYN6288_DAEMON_MAGIC;
+    request->version = SYN6288_DAEMON_VERSION;
+    request->command = SYN6288_DAEMON_COMMAND_SAY;
+    if (send(fd, request, SYN6288_DAEMON_REQUEST_HEADER + len, MSG_NOSIGNAL) < 0)
+    {
+        perror("syn6288: send failed.\n");
+        (void)close(fd);
+        
+        return 1;
+    }
+    while (1)
+    {
+        n = recv(fd, &event, sizeof(syn6288_daemon_event_t), 0);
+        if ((n < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+        if ((n != (ssize_t)sizeof(syn6288_daemon_event_t)) || (event.magic != SYN6288_DAEMON_MAGIC))
+        {
+            syn6288_interface_debug_print("syn6288: daemon closed the connection.\n");
+            (void)close(fd);
+            
+            return 1;
+        }
+        if (callback != NULL)
+        {
+            callback(&event);
+        }
+        if ((event.type == SYN6288_DAEMON_EVENT_DONE) || (event.type == SYN6288_DAEMON_EVENT_DROP) ||
+            (event.type == SYN6288_DAEMON_EVENT_REJECT))
+        {
+            break;
+        }
+    }
+    (void)close(fd);
+    
+    return (event.type == SYN6288_DAEMON_EVENT_DONE) ? 0 : 1;
+}
+
+/**
+ * @brief      daemon client open a shared memory ring
+ * @param[in]  *path pointer to a socket path
+ * @param[out] *fd pointer to a socket buffer
+ * @param[out] *producer pointer to a producer structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 open failed
+ * @note       the events of the ring requests are read from the socket, the ring is closed
+ *             by syn6288_shm_producer_deinit and closing the socket
+ */
+uint8_t syn6288_daemon_ring_open(const char *path, int *fd, syn6288_shm_producer_t *producer)
+{
+    int fds[2];
+    ssize_t n;
+    char control[CMSG_SPACE(sizeof(fds))];
+    struct msghdr mh;
+    struct iovec iov;
+    struct cmsghdr *cmsg;
+    struct sockaddr_un addr;
+    syn6288_daemon_request_t request;
+    syn6288_daemon_event_t event;
+    
+    if (a_daemon_addr(path, &addr) != 0)
+    {
+        return 1;
+    }
+    *fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (*fd < 0)
+    {
+        perror("syn6288: socket failed.\n");
+        
+        return 1;
+    }
+    if (connect(*fd, (struct sockaddr *)&addr, sizeof(struct sockaddr_un)) != 0)
+    {
+        syn6288_interface_debug_print("syn6288: connect %s failed.\n", path);
+        (void)close(*fd);
+        
+        return 1;
+    }
+    memset(&request, 0, sizeof(syn6288_daemon_request_t));
+    request.magic = SYN6288_DAEMON_MAGIC;
+    request.version = SYN6288_DAEMON_VERSION;
+    request.command = SYN6288_DAEMON_COMMAND_RING;
+    if (send(*fd, &request, SYN6288_DAEMON_REQUEST_HEADER, MSG_NOSIGNAL) < 0)
+    {
+        perror("syn6288: send failed.\n");
+        (void)close(*fd);
+        
+        return 1;
+    }
+    
+    /* the accept event carries the memfd and the eventfd */
+    memset(&mh, 0, sizeof(struct msghdr));
+    iov.iov_base = &event;
+    iov.iov_len = sizeof(syn6288_daemon_event_t);
+    mh.msg_iov = &iov;
+    mh.msg_iovlen = 1;
+    mh.msg_control = control;
+    mh.msg_controllen = sizeof(control);
+    do
+    {
+        n = recvmsg(*fd, &mh, MSG_CMSG_CLOEXEC);
+    } while ((n < 0) && (errno == EINTR));
+    cmsg = CMSG_FIRSTHDR(&mh);
+    if ((n != (ssize_t)sizeof(syn6288_daemon_event_t)) || (event.magic != SYN6288_DAEMON_MAGIC) ||
+        (event.type != SYN6288_DAEMON_EVENT_ACCEPT) || (cmsg == NULL) ||
+        (cmsg->cmsg_level != SOL_SOCKET) || (cmsg->cmsg_type != SCM_RIGHTS) ||
+        (cmsg->cmsg_len != CMSG_LEN(sizeof(fds))))
+    {
+        syn6288_interface_debug_print("syn6288: daemon refused the ring.\n");
+        (void)close(*fd);
+        
+        return 1;
+    }
+    memcpy(fds, CMSG_DATA(cmsg), sizeof(fds));
+    if (syn6288_shm_producer_init(producer, fds[0], fds[1]) != 0)
+    {
+        (void)close(fds[0]);
+        (void)close(fds[1]);
+        (void)close(*fd);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief         read one event of a ring
+ * @param[in]     fd client socket
+ * @param[in]     *callback pointer to an event callback
+ * @param[in,out] *finals pointer to a final event counter
+ * @param[in,out] *done pointer to a done event counter
+ * @return        status code
+ *                - 0 success
+ *                - 1 daemon closed the connection
+ * @note          none
+ */
+static uint8_t a_daemon_ring_event(int fd, void (*callback)(syn6288_daemon_event_t *event),
+                                   uint32_t *finals, uint32_t *done)
+{
+    ssize_t n;
+    syn6288_daemon_event_t event;
+    
+    do
+    {
+        n = recv(fd, &event, sizeof(syn6288_daemon_event_t), 0);
+    } while ((n < 0) && (errno == EINTR));
+    if ((n != (ssize_t)sizeof(syn6288_daemon_event_t)) || (event.magic != SYN6288_DAEMON_MAGIC))
+    {
+        syn6288_interface_debug_print("syn6288: daemon closed the connection.\n");
+        
+        return 1;
+    }
+    if (callback != NULL)
+    {
+        callback(&event);
+    }
+    if ((event.type == SYN6288_DAEMON_EVENT_DONE) || (event.type == SYN6288_DAEMON_EVENT_DROP) ||
+        (event.type == SYN6288_DAEMON_EVENT_REJECT))
+    {
+        (*finals)++;
+    }
+    if (event.type == SYN6288_DAEMON_EVENT_DONE)
+    {
+        (*done)++;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     daemon client say through a shared memory ring
+ * @param[in] *path pointer to a socket path
+ * @param[in] *request pointer to a request message
+ * @param[in] len text length
+ * @param[in] times request number
+ * @param[in] *callback pointer to an event callback
+ * @return    status code
+ *            - 0 success
+ *            - 1 say failed
+ * @note      the request is written in place times times, the events are passed to the callback
+ *            until every request is done, dropped or rejected, only all done is a success
+ */
+uint8_t syn6288_daemon_ring_say(const char *path, syn6288_daemon_request_t *request, uint16_t len, uint32_t times,
+                                void (*callback)(syn6288_daemon_event_t *event))
+{
+    int fd;
+    uint32_t k;
+    uint32_t finals;
+    uint32_t done;
+    uint64_t ns;
+    struct timespec t0;
+    struct timespec t1;
+    syn6288_shm_slot_t *slot;
+    syn6288_shm_producer_t producer;
+    
+    if ((len == 0) || (len > SYN6288_SERVICE_MAX_TEXT) || (times == 0))
+    {
+        syn6288_interface_debug_print("syn6288: text length or times is invalid.\n");
+        
+        return 1;
+    }
+    if (syn6288_daemon_ring_open(path, &fd, &producer) != 0)
+    {
+        return 1;
+    }
+    
+    finals = 0;
+    done = 0;
+    ns = 0;
+    for (k = 0; k < times; k++)
+    {
+        /* a full ring waits for the events of the played slots */
+        (void)clock_gettime(CLOCK_MONOTONIC, &t0);
+        while (syn6288_shm_producer_reserve(&producer, &slot) != 0)
+        {
+            if (a_daemon_ring_event(fd, callback, &finals, &done) != 0)
+            {
+                goto failed;
+            }
+            (void)clock_gettime(CLOCK_MONOTONIC, &t0);
+        }
+        slot->tag = request->tag + k;
+        slot->deadline = request->deadline;
+        slot->encoding = request->encoding;
+        slot->priority = request->priority;
+        slot->mode = request->mode;
+        slot->volume = request->volume;
+        slot->background_volume = request->background_volume;
+        slot->speed = request->speed;
+        slot->producer = request->producer;
+        slot->weight = request->weight;
+        slot->len = len;
+        memcpy(slot->text, request->text, len);
+        syn6288_shm_producer_commit(&producer);
+        (void)clock_gettime(CLOCK_MONOTONIC, &t1);
+        ns += (uint64_t)((int64_t)(t1.tv_sec - t0.tv_sec) * 1000000000LL + (t1.tv_nsec - t0.tv_nsec));
+    }
+    while (finals < times)
+    {
+        if (a_daemon_ring_event(fd, callback, &finals, &done) != 0)
+        {
+            goto failed;
+        }
+    }
+    syn6288_interface_debug_print("syn6288: %d requests, %d done, %d not done.\n", times, done, times - done);
+    syn6288_interface_debug_print("syn6288: enqueue %dns per request, %d full retries, %d wake ups.\n",
+                                  (uint32_t)(ns / times), producer.full, producer.wakes);
+    syn6288_shm_producer_deinit(&producer);
+    (void)close(fd);
+    
+    return (done == times) ? 0 : 1;
+    
+    failed:
+    syn6288_shm_producer_deinit(&producer);
+    (void)close(fd);
+    
+    return 1;
+}
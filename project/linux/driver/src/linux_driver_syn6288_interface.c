@@ -0,0 +1,521 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      linux_driver_syn6288_interface.c
+ * @brief     linux driver syn6288 interface source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "linux_driver_syn6288_interface.h"
+#include "driver_syn6288_queue.h"
+#include "uart.h"
+#include "gpio.h"
+#include "record.h"
+#include <stdarg.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief uart device handle definition
+ */
+static char gs_name[256] = "/dev/ttyS0";        /**< uart device name */
+static uint32_t gs_baud = 9600;                 /**< uart baud rate */
+static int gs_fd;                               /**< uart handle */
+
+/**
+ * @brief gpio line handle definition
+ */
+static char gs_chip[64];                        /**< gpio chip name, empty if no line is used */
+static uint32_t gs_line;                        /**< gpio line offset */
+static uint8_t gs_active_low;                   /**< gpio active low flag */
+static int gs_gpio_fd = -1;                     /**< gpio line handle */
+static uint8_t gs_env = 0;                      /**< environment loaded flag */
+
+/**
+ * @brief interface event ring definition
+ */
+#define SYN6288_INTERFACE_EVENT_MAX    16        /**< event ring size */
+
+/**
+ * @brief interface event structure definition
+ */
+typedef struct syn6288_interface_event_s
+{
+    uint8_t code;           /**< event code */
+    uint8_t command;        /**< command opcode */
+    uint32_t value;         /**< event value */
+} syn6288_interface_event_t;
+
+static syn6288_interface_event_t gs_event[SYN6288_INTERFACE_EVENT_MAX];        /**< event ring */
+static volatile uint32_t gs_event_write = 0;                                   /**< written event count */
+static volatile uint32_t gs_event_read = 0;                                    /**< read event count */
+
+/**
+ * @brief      parse a gpio option
+ * @param[in]  *str pointer to a "chip:line[:low]" string
+ * @param[out] *chip pointer to a chip name buffer
+ * @param[in]  size chip name buffer size
+ * @param[out] *line pointer to a line offset buffer
+ * @param[out] *active_low pointer to an active low flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 parse failed
+ * @note       none
+ */
+uint8_t syn6288_interface_parse_gpio(const char *str, char *chip, uint32_t size,
+                                     uint32_t *line, uint8_t *active_low)
+{
+    const char *p;
+    char *end;
+    unsigned long l;
+    
+    p = strchr(str, ':');
+    if ((p == NULL) || (p == str) || ((uint32_t)(p - str) >= size))
+    {
+        return 1;
+    }
+    memcpy(chip, str, p - str);
+    chip[p - str] = '\0';
+    l = strtoul(p + 1, &end, 10);
+    if (end == p + 1)
+    {
+        return 1;
+    }
+    if (*end == '\0')
+    {
+        *active_low = 0;
+    }
+    else if (strcmp(end, ":low") == 0)
+    {
+        *active_low = 1;
+    }
+    else if (strcmp(end, ":high") == 0)
+    {
+        *active_low = 0;
+    }
+    else
+    {
+        return 1;
+    }
+    *line = (uint32_t)l;
+    
+    return 0;
+}
+
+/**
+ * @brief  load the environment defaults
+ * @note   SYN6288_DEVICE, SYN6288_BAUD and SYN6288_GPIO are read once
+ */
+static void a_interface_load_env(void)
+{
+    const char *str;
+    
+    if (gs_env != 0)
+    {
+        return;
+    }
+    gs_env = 1;
+    
+    str = getenv("SYN6288_DEVICE");
+    if ((str != NULL) && (str[0] != '\0'))
+    {
+        (void)snprintf(gs_name, sizeof(gs_name), "%s", str);
+    }
+    str = getenv("SYN6288_BAUD");
+    if ((str != NULL) && (atoi(str) > 0))
+    {
+        gs_baud = (uint32_t)atoi(str);
+    }
+    str = getenv("SYN6288_GPIO");
+    if ((str != NULL) && (str[0] != '\0'))
+    {
+        if (syn6288_interface_parse_gpio(str, gs_chip, sizeof(gs_chip), &gs_line, &gs_active_low) != 0)
+        {
+            (void)fprintf(stderr, "syn6288: SYN6288_GPIO %s is invalid.\n", str);
+            gs_chip[0] = '\0';
+        }
+    }
+}
+
+/**
+ * @brief     interface set the uart device
+ * @param[in] *name pointer to a device name
+ * @note      used by the next uart init, the default is SYN6288_DEVICE or /dev/ttyS0
+ */
+void syn6288_interface_set_device(const char *name)
+{
+    a_interface_load_env();
+    (void)snprintf(gs_name, sizeof(gs_name), "%s", name);
+}
+
+/**
+ * @brief     interface set the uart baud rate
+ * @param[in] baud baud rate
+ * @note      used by the next uart init, the default is SYN6288_BAUD or 9600
+ */
+void syn6288_interface_set_baud(uint32_t baud)
+{
+    a_interface_load_env();
+    gs_baud = baud;
+}
+
+/**
+ * @brief     interface set the enable gpio line
+ * @param[in] *chip pointer to a chip name, NULL disables the line
+ * @param[in] line line offset of the chip
+ * @param[in] active_low 1 if the line is active low
+ * @note      used by the next uart init, the default is SYN6288_GPIO or none
+ */
+void syn6288_interface_set_gpio(const char *chip, uint32_t line, uint8_t active_low)
+{
+    a_interface_load_env();
+    if (chip == NULL)
+    {
+        gs_chip[0] = '\0';
+    }
+    else
+    {
+        (void)snprintf(gs_chip, sizeof(gs_chip), "%s", chip);
+    }
+    gs_line = line;
+    gs_active_low = active_low;
+}
+
+/**
+ * @brief      interface get the current settings
+ * @param[out] **name pointer to a device name pointer
+ * @param[out] *baud pointer to a baud rate buffer
+ * @param[out] **chip pointer to a chip name pointer, NULL if no line is used
+ * @param[out] *line pointer to a line offset buffer
+ * @param[out] *active_low pointer to an active low flag buffer
+ * @note       none
+ */
+void syn6288_interface_get_settings(const char **name, uint32_t *baud, const char **chip,
+                                    uint32_t *line, uint8_t *active_low)
+{
+    a_interface_load_env();
+    *name = gs_name;
+    *baud = gs_baud;
+    *chip = (gs_chip[0] != '\0') ? gs_chip : NULL;
+    *line = gs_line;
+    *active_low = gs_active_low;
+}
+
+/**
+ * @brief  interface uart init
+ * @return status code
+ *         - 0 success
+ *         - 1 uart init failed
+ * @note   the enable line is driven active before the uart is opened
+ */
+uint8_t syn6288_interface_uart_init(void)
+{
+    a_interface_load_env();
+    if (record_init() != 0)
+    {
+        return 1;
+    }
+    if (record_get_mode() == RECORD_MODE_REPLAY)
+    {
+        return 0;
+    }
+    if ((gs_chip[0] != '\0') && (gs_gpio_fd < 0))
+    {
+        if (gpio_init(gs_chip, gs_line, gs_active_low, &gs_gpio_fd) != 0)
+        {
+            return 1;
+        }
+        if (gpio_write(gs_gpio_fd, 1) != 0)
+        {
+            (void)gpio_deinit(gs_gpio_fd);
+            gs_gpio_fd = -1;
+            
+            return 1;
+        }
+    }
+    if (uart_init(gs_name, &gs_fd, gs_baud, 8, 'N', 1) != 0)
+    {
+        if (gs_gpio_fd >= 0)
+        {
+            (void)gpio_deinit(gs_gpio_fd);
+            gs_gpio_fd = -1;
+        }
+        
+        return 1;
+    }
+    record_log(RECORD_TYPE_INIT, NULL, 0, gs_baud);
+    
+    return 0;
+}
+
+/**
+ * @brief  interface uart deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 uart deinit failed
+ * @note   the enable line is released after the uart is closed
+ */
+uint8_t syn6288_interface_uart_deinit(void)
+{
+    uint8_t res;
+    
+    if (record_get_mode() == RECORD_MODE_REPLAY)
+    {
+        return 0;
+    }
+    record_log(RECORD_TYPE_DEINIT, NULL, 0, 0);
+    res = uart_deinit(gs_fd);
+    if (gs_gpio_fd >= 0)
+    {
+        (void)gpio_write(gs_gpio_fd, 0);
+        if (gpio_deinit(gs_gpio_fd) != 0)
+        {
+            res = 1;
+        }
+        gs_gpio_fd = -1;
+    }
+    
+    return res;
+}
+/**
+ * @brief      interface uart read
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint16_t syn6288_interface_uart_read(uint8_t *buf, uint16_t len)
+{
+    uint32_t l = len;
+
+    if (record_get_mode() == RECORD_MODE_REPLAY)
+    {
+        return replay_read(buf, len);
+    }
+    if (uart_read(gs_fd, buf, (uint32_t *)&l))
+    {
+        return 0;
+    }
+    else
+    {
+        if (l != 0)
+        {
+            record_log(RECORD_TYPE_READ, buf, (uint16_t)l, 0);
+        }
+        
+        return l;
+    }
+}
+
+/**
+ * @brief  interface uart flush
+ * @return status code
+ *         - 0 success
+ *         - 1 uart flush failed
+ * @note   none
+ */
+uint8_t syn6288_interface_uart_flush(void)
+{
+    if (record_get_mode() == RECORD_MODE_REPLAY)
+    {
+        return replay_flush();
+    }
+    record_log(RECORD_TYPE_FLUSH, NULL, 0, 0);
+    
+    return uart_flush(gs_fd);
+}
+
+/**
+ * @brief     interface uart write
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t syn6288_interface_uart_write(uint8_t *buf, uint16_t len)
+{
+    if (record_get_mode() == RECORD_MODE_REPLAY)
+    {
+        return replay_write(buf, len);
+    }
+    record_log(RECORD_TYPE_WRITE, buf, len, 0);
+    
+    return uart_write(gs_fd, buf, len);
+}
+
+/**
+ * @brief     interface delay ms
+ * @param[in] ms time
+ * @note      none
+ */
+void syn6288_interface_delay_ms(uint32_t ms)
+{
+    if (record_get_mode() == RECORD_MODE_REPLAY)
+    {
+        replay_delay_ms(ms);
+        
+        return;
+    }
+    usleep(1000 * ms);
+    record_log(RECORD_TYPE_DELAY, NULL, 0, ms);
+}
+
+/**
+ * @brief     interface print format data
+ * @param[in] fmt format data
+ * @note      none
+ */
+void syn6288_interface_debug_print(const char *const fmt, ...)
+{
+    char str[256];
+    va_list args;
+    
+    memset((char *)str, 0, sizeof(char) * 256); 
+    va_start(args, fmt);
+    vsnprintf((char *)str, 255, (char const *)fmt, args);
+    va_end(args);
+    
+    (void)printf("%s", str);
+}
+
+/**
+ * @brief  interface timestamp ms
+ * @return current monotonic time in ms
+ * @note   the value may wrap around
+ */
+uint32_t syn6288_interface_timestamp_ms(void)
+{
+    struct timespec ts;
+    
+    if (record_get_mode() == RECORD_MODE_REPLAY)
+    {
+        return replay_timestamp_ms();
+    }
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000);
+}
+
+/**
+ * @brief     interface event
+ * @param[in] code event code
+ * @param[in] command command opcode
+ * @param[in] value event value
+ * @note      the event is kept in a ring, the oldest event is overwritten when the ring is full
+ */
+void syn6288_interface_event(uint8_t code, uint8_t command, uint32_t value)
+{
+    uint32_t i;
+    
+    i = gs_event_write % SYN6288_INTERFACE_EVENT_MAX;
+    gs_event[i].code = code;
+    gs_event[i].command = command;
+    gs_event[i].value = value;
+    gs_event_write++;
+    if ((gs_event_write - gs_event_read) > SYN6288_INTERFACE_EVENT_MAX)
+    {
+        gs_event_read = gs_event_write - SYN6288_INTERFACE_EVENT_MAX;
+    }
+}
+
+/**
+ * @brief      interface event read
+ * @param[out] *code pointer to an event code buffer
+ * @param[out] *command pointer to a command opcode buffer
+ * @param[out] *value pointer to an event value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no event
+ * @note       none
+ */
+uint8_t syn6288_interface_event_read(uint8_t *code, uint8_t *command, uint32_t *value)
+{
+    uint32_t i;
+    
+    if (gs_event_read == gs_event_write)
+    {
+        return 1;
+    }
+    i = gs_event_read % SYN6288_INTERFACE_EVENT_MAX;
+    *code = gs_event[i].code;
+    *command = gs_event[i].command;
+    *value = gs_event[i].value;
+    gs_event_read++;
+    
+    return 0;
+}
+
+/**
+ * @brief     interface receive callback
+ * @param[in] type event type
+ * @param[in] id item id
+ * @note      none
+ */
+void syn6288_interface_receive_callback(uint8_t type, uint32_t id)
+{
+    switch (type)
+    {
+        case SYN6288_QUEUE_EVENT_START :
+        {
+            syn6288_interface_debug_print("syn6288: irq item %u start.\n", id);
+            
+            break;
+        }
+        case SYN6288_QUEUE_EVENT_DONE :
+        {
+            syn6288_interface_debug_print("syn6288: irq item %u done.\n", id);
+            
+            break;
+        }
+        case SYN6288_QUEUE_EVENT_DROP :
+        {
+            syn6288_interface_debug_print("syn6288: irq item %u drop.\n", id);
+            
+            break;
+        }
+        case SYN6288_QUEUE_EVENT_PREEMPT :
+        {
+            syn6288_interface_debug_print("syn6288: irq item %u preempt.\n", id);
+            
+            break;
+        }
+        default :
+        {
+            syn6288_interface_debug_print("syn6288: unknown code.\n");
+            
+            break;
+        }
+    }
+}
@@ -0,0 +1,344 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      linux_driver_syn6288_shm.c
+ * @brief     linux driver syn6288 shm source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#define _GNU_SOURCE
+#include "linux_driver_syn6288_shm.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief syn6288 shm slot index mask definition
+ */
+#define SYN6288_SHM_MASK (SYN6288_SHM_SLOTS - 1)        /**< index mask */
+
+/**
+ * @brief      shm consumer init
+ * @param[out] *consumer pointer to a consumer structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 init failed
+ * @note       the ring is created in an anonymous shared memory file with an eventfd for the wake ups
+ */
+uint8_t syn6288_shm_consumer_init(syn6288_shm_consumer_t *consumer)
+{
+    void *p;
+    
+    memset(consumer, 0, sizeof(syn6288_shm_consumer_t));
+    consumer->memfd = memfd_create("syn6288-ring", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (consumer->memfd < 0)
+    {
+        perror("syn6288: memfd_create failed.\n");
+        
+        return 1;
+    }
+    if (ftruncate(consumer->memfd, sizeof(syn6288_shm_ring_t)) != 0)
+    {
+        perror("syn6288: ftruncate failed.\n");
+        (void)close(consumer->memfd);
+        
+        return 1;
+    }
+    
+    /* a client can't shrink the file under the mapping of the daemon */
+    (void)fcntl(consumer->memfd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL);
+    p = mmap(NULL, sizeof(syn6288_shm_ring_t), PROT_READ | PROT_WRITE, MAP_SHARED, consumer->memfd, 0);
+    if (p == MAP_FAILED)
+    {
+        perror("syn6288: mmap failed.\n");
+        (void)close(consumer->memfd);
+        
+        return 1;
+    }
+    consumer->efd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (consumer->efd < 0)
+    {
+        perror("syn6288: eventfd failed.\n");
+        (void)munmap(p, sizeof(syn6288_shm_ring_t));
+        (void)close(consumer->memfd);
+        
+        return 1;
+    }
+    consumer->ring = (syn6288_shm_ring_t *)p;
+    consumer->ring->magic = SYN6288_SHM_MAGIC;
+    consumer->ring->version = SYN6288_SHM_VERSION;
+    consumer->ring->slots = SYN6288_SHM_SLOTS;
+    consumer->ring->size = sizeof(syn6288_shm_ring_t);
+    
+    return 0;
+}
+
+/**
+ * @brief     shm consumer deinit
+ * @param[in] *consumer pointer to a consumer structure
+ * @note      none
+ */
+void syn6288_shm_consumer_deinit(syn6288_shm_consumer_t *consumer)
+{
+    if (consumer->ring != NULL)
+    {
+        (void)munmap(consumer->ring, sizeof(syn6288_shm_ring_t));
+        (void)close(consumer->memfd);
+        (void)close(consumer->efd);
+        consumer->ring = NULL;
+    }
+}
+
+/**
+ * @brief      shm consumer peek the next published slot
+ * @param[in]  *consumer pointer to a consumer structure
+ * @param[out] **slot pointer to a slot pointer
+ * @return     1 if a slot is published, else 0
+ * @note       the slot stays published until it is taken
+ */
+uint8_t syn6288_shm_consumer_peek(syn6288_shm_consumer_t *consumer, syn6288_shm_slot_t **slot)
+{
+    uint32_t head;
+    
+    head = __atomic_load_n(&consumer->ring->head, __ATOMIC_ACQUIRE);
+    if ((head == consumer->next) || ((consumer->next - consumer->tail) >= SYN6288_SHM_SLOTS))
+    {
+        return 0;
+    }
+    *slot = &consumer->ring->slot[consumer->next & SYN6288_SHM_MASK];
+    
+    return 1;
+}
+
+/**
+ * @brief     shm consumer take the peeked slot
+ * @param[in] *consumer pointer to a consumer structure
+ * @param[in] id request id of the slot
+ * @note      the slot is owned by the consumer until it is released
+ */
+void syn6288_shm_consumer_take(syn6288_shm_consumer_t *consumer, uint32_t id)
+{
+    consumer->id[consumer->next & SYN6288_SHM_MASK] = id;
+    consumer->done[consumer->next & SYN6288_SHM_MASK] = 0;
+    consumer->next++;
+}
+
+/**
+ * @brief     shm consumer release a taken slot
+ * @param[in] *consumer pointer to a consumer structure
+ * @param[in] id request id of the slot
+ * @return    1 if the id is found, else 0
+ * @note      slots are returned to the producer in order, a slot released early waits for the ones before it
+ */
+uint8_t syn6288_shm_consumer_release(syn6288_shm_consumer_t *consumer, uint32_t id)
+{
+    uint32_t k;
+    uint8_t found;
+    
+    found = 0;
+    for (k = consumer->tail; k != consumer->next; k++)
+    {
+        if ((consumer->id[k & SYN6288_SHM_MASK] == id) && (consumer->done[k & SYN6288_SHM_MASK] == 0))
+        {
+            consumer->done[k & SYN6288_SHM_MASK] = 1;
+            found = 1;
+            
+            break;
+        }
+    }
+    while ((consumer->tail != consumer->next) && (consumer->done[consumer->tail & SYN6288_SHM_MASK] != 0))
+    {
+        consumer->tail++;
+    }
+    __atomic_store_n(&consumer->ring->tail, consumer->tail, __ATOMIC_RELEASE);
+    
+    return found;
+}
+
+/**
+ * @brief     shm consumer check the taken slots
+ * @param[in] *consumer pointer to a consumer structure
+ * @return    1 if a taken slot is not released, else 0
+ * @note      none
+ */
+uint8_t syn6288_shm_consumer_busy(syn6288_shm_consumer_t *consumer)
+{
+    return (consumer->tail != consumer->next) ? 1 : 0;
+}
+
+/**
+ * @brief     shm consumer prepare to sleep
+ * @param[in] *consumer pointer to a consumer structure
+ * @return    1 if a slot is already published and the consumer must not sleep, else 0
+ * @note      the producer writes the eventfd only after this call, call syn6288_shm_consumer_wake after the sleep
+ */
+uint8_t syn6288_shm_consumer_sleep(syn6288_shm_consumer_t *consumer)
+{
+    __atomic_store_n(&consumer->ring->waiting, 1, __ATOMIC_RELAXED);
+    
+    /* pairs with the fence of the commit, one side always sees the other */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&consumer->ring->head, __ATOMIC_ACQUIRE) != consumer->next)
+    {
+        __atomic_store_n(&consumer->ring->waiting, 0, __ATOMIC_RELAXED);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     shm consumer wake up
+ * @param[in] *consumer pointer to a consumer structure
+ * @note      the eventfd is drained
+ */
+void syn6288_shm_consumer_wake(syn6288_shm_consumer_t *consumer)
+{
+    uint64_t v;
+    
+    __atomic_store_n(&consumer->ring->waiting, 0, __ATOMIC_RELAXED);
+    (void)read(consumer->efd, &v, sizeof(uint64_t));
+}
+
+/**
+ * @brief     shm producer init
+ * @param[in] *producer pointer to a producer structure
+ * @param[in] memfd shared memory handle
+ * @param[in] efd wake up handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      the producer owns the handles after a success
+ */
+uint8_t syn6288_shm_producer_init(syn6288_shm_producer_t *producer, int memfd, int efd)
+{
+    void *p;
+    struct stat st;
+    syn6288_shm_ring_t *ring;
+    
+    memset(producer, 0, sizeof(syn6288_shm_producer_t));
+    if ((fstat(memfd, &st) != 0) || ((size_t)st.st_size < sizeof(syn6288_shm_ring_t)))
+    {
+        syn6288_interface_debug_print("syn6288: ring size is invalid.\n");
+        
+        return 1;
+    }
+    p = mmap(NULL, sizeof(syn6288_shm_ring_t), PROT_READ | PROT_WRITE, MAP_SHARED, memfd, 0);
+    if (p == MAP_FAILED)
+    {
+        perror("syn6288: mmap failed.\n");
+        
+        return 1;
+    }
+    ring = (syn6288_shm_ring_t *)p;
+    if ((ring->magic != SYN6288_SHM_MAGIC) || (ring->version != SYN6288_SHM_VERSION) ||
+        (ring->slots != SYN6288_SHM_SLOTS) || (ring->size != sizeof(syn6288_shm_ring_t)))
+    {
+        syn6288_interface_debug_print("syn6288: ring layout is invalid.\n");
+        (void)munmap(p, sizeof(syn6288_shm_ring_t));
+        
+        return 1;
+    }
+    producer->ring = ring;
+    producer->memfd = memfd;
+    producer->efd = efd;
+    producer->head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    
+    return 0;
+}
+
+/**
+ * @brief     shm producer deinit
+ * @param[in] *producer pointer to a producer structure
+ * @note      none
+ */
+void syn6288_shm_producer_deinit(syn6288_shm_producer_t *producer)
+{
+    if (producer->ring != NULL)
+    {
+        (void)munmap(producer->ring, sizeof(syn6288_shm_ring_t));
+        (void)close(producer->memfd);
+        (void)close(producer->efd);
+        producer->ring = NULL;
+    }
+}
+
+/**
+ * @brief      shm producer reserve a slot
+ * @param[in]  *producer pointer to a producer structure
+ * @param[out] **slot pointer to a slot pointer
+ * @return     status code
+ *             - 0 success
+ *             - 1 ring is full
+ * @note       write the request in the slot and commit it, no system call is made
+ */
+uint8_t syn6288_shm_producer_reserve(syn6288_shm_producer_t *producer, syn6288_shm_slot_t **slot)
+{
+    uint32_t tail;
+    
+    tail = __atomic_load_n(&producer->ring->tail, __ATOMIC_ACQUIRE);
+    if ((producer->head - tail) >= SYN6288_SHM_SLOTS)
+    {
+        producer->full++;
+        
+        return 1;
+    }
+    *slot = &producer->ring->slot[producer->head & SYN6288_SHM_MASK];
+    
+    return 0;
+}
+
+/**
+ * @brief     shm producer commit the reserved slot
+ * @param[in] *producer pointer to a producer structure
+ * @note      the eventfd is only written when the consumer sleeps
+ */
+void syn6288_shm_producer_commit(syn6288_shm_producer_t *producer)
+{
+    uint64_t v;
+    
+    producer->head++;
+    producer->commits++;
+    __atomic_store_n(&producer->ring->head, producer->head, __ATOMIC_RELEASE);
+    
+    /* pairs with the fence of the sleep, one side always sees the other */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&producer->ring->waiting, __ATOMIC_RELAXED) != 0)
+    {
+        v = 1;
+        (void)write(producer->efd, &v, sizeof(uint64_t));
+        producer->wakes++;
+    }
+}
@@ -0,0 +1,155 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      gpio.c
+ * @brief     gpio source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "gpio.h"
+#include <fcntl.h>
+#include <linux/gpio.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+/**
+ * @brief      gpio output init
+ * @param[in]  *chip pointer to a chip name, such as "gpiochip0", "/dev/gpiochip0" or "0"
+ * @param[in]  line line offset of the chip
+ * @param[in]  active_low 1 if the line is active low
+ * @param[out] *fd pointer to a line handle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 gpio init failed
+ * @note       the line starts inactive, no library is needed
+ */
+uint8_t gpio_init(const char *chip, uint32_t line, uint8_t active_low, int *fd)
+{
+    int chip_fd;
+    char path[64];
+    struct gpio_v2_line_request req;
+    
+    /* get the chip path */
+    if (chip[0] == '/')
+    {
+        (void)snprintf(path, sizeof(path), "%s", chip);
+    }
+    else if ((chip[0] >= '0') && (chip[0] <= '9'))
+    {
+        (void)snprintf(path, sizeof(path), "/dev/gpiochip%s", chip);
+    }
+    else
+    {
+        (void)snprintf(path, sizeof(path), "/dev/%s", chip);
+    }
+    
+    /* open the chip */
+    chip_fd = open(path, O_RDWR | O_CLOEXEC);
+    if (chip_fd < 0)
+    {
+        perror("gpio: open failed.\n");
+        
+        return 1;
+    }
+    
+    /* request the line as an output */
+    memset(&req, 0, sizeof(req));
+    req.offsets[0] = line;
+    req.num_lines = 1;
+    (void)snprintf(req.consumer, sizeof(req.consumer), "syn6288");
+    req.config.flags = GPIO_V2_LINE_FLAG_OUTPUT;
+    if (active_low != 0)
+    {
+        req.config.flags |= GPIO_V2_LINE_FLAG_ACTIVE_LOW;
+    }
+    req.config.num_attrs = 1;
+    req.config.attrs[0].attr.id = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;
+    req.config.attrs[0].attr.values = 0;
+    req.config.attrs[0].mask = 1;
+    if (ioctl(chip_fd, GPIO_V2_GET_LINE_IOCTL, &req) < 0)
+    {
+        perror("gpio: request line failed.\n");
+        (void)close(chip_fd);
+        
+        return 1;
+    }
+    (void)close(chip_fd);
+    *fd = req.fd;
+    
+    return 0;
+}
+
+/**
+ * @brief     gpio deinit
+ * @param[in] fd line handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t gpio_deinit(int fd)
+{
+    if (close(fd) < 0)
+    {
+        perror("gpio: close failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     gpio write
+ * @param[in] fd line handle
+ * @param[in] value 1 active, 0 inactive
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t gpio_write(int fd, uint8_t value)
+{
+    struct gpio_v2_line_values values;
+    
+    values.bits = (value != 0) ? 1 : 0;
+    values.mask = 1;
+    if (ioctl(fd, GPIO_V2_LINE_SET_VALUES_IOCTL, &values) < 0)
+    {
+        perror("gpio: write failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
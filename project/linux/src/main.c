@@ -0,0 +1,1076 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      main.c
+ * @brief     main source file
+ * @version   2.0.0
+ * @author    Shifeng Li
+ * @date      2021-03-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2021/03/17  <td>2.0      <td>Shifeng Li  <td>format the code
+ * <tr><td>2020/12/01  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_syn6288_basic.h"
+#include "driver_syn6288_advance.h"
+#include "driver_syn6288_stream.h"
+#include "driver_syn6288_register_test.h"
+#include "driver_syn6288_synthesis_test.h"
+#include "driver_syn6288_queue_test.h"
+#include "driver_syn6288_perf_test.h"
+#include "driver_syn6288_queue.h"
+#include "linux_driver_syn6288_interface.h"
+#include "linux_driver_syn6288_daemon.h"
+#include <getopt.h>
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief     stream a file or stdin
+ * @param[in] *path pointer to a file path, NULL or "-" reads stdin
+ * @param[in] encoding input encoding
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the file is memory mapped, stdin is read in chunks and the queue is processed while it waits
+ */
+static uint8_t a_syn6288_stream(const char *path, syn6288_stream_encoding_t encoding)
+{
+    uint8_t res;
+    uint32_t i;
+    syn6288_stream_stats_t stats;
+    syn6288_stream_segment_t seg;
+    
+    /* stream init */
+    res = syn6288_stream_init(encoding);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    if ((path != NULL) && (strcmp(path, "-") != 0))
+    {
+        int fd;
+        struct stat st;
+        uint8_t *buf;
+        
+        /* map the file */
+        fd = open(path, O_RDONLY);
+        if (fd < 0)
+        {
+            syn6288_interface_debug_print("syn6288: open %s failed.\n", path);
+            (void)syn6288_stream_deinit();
+            
+            return 1;
+        }
+        if (fstat(fd, &st) != 0)
+        {
+            syn6288_interface_debug_print("syn6288: stat %s failed.\n", path);
+            (void)close(fd);
+            (void)syn6288_stream_deinit();
+            
+            return 1;
+        }
+        if (st.st_size > 0)
+        {
+            buf = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (buf == MAP_FAILED)
+            {
+                syn6288_interface_debug_print("syn6288: mmap %s failed.\n", path);
+                (void)close(fd);
+                (void)syn6288_stream_deinit();
+                
+                return 1;
+            }
+            (void)madvise(buf, (size_t)st.st_size, MADV_SEQUENTIAL);
+            res = syn6288_stream_write(buf, (uint32_t)st.st_size);
+            (void)munmap(buf, (size_t)st.st_size);
+        }
+        (void)close(fd);
+    }
+    else
+    {
+        uint8_t buf[4096];
+        struct pollfd pfd;
+        ssize_t l;
+        
+        /* read stdin and keep playing while it waits */
+        pfd.fd = STDIN_FILENO;
+        pfd.events = POLLIN;
+        while (1)
+        {
+            if (poll(&pfd, 1, 50) <= 0)
+            {
+                res = syn6288_stream_process();
+                if (res != 0)
+                {
+                    break;
+                }
+                
+                continue;
+            }
+            l = read(STDIN_FILENO, buf, sizeof(buf));
+            if (l <= 0)
+            {
+                break;
+            }
+            res = syn6288_stream_write(buf, (uint32_t)l);
+            if (res != 0)
+            {
+                break;
+            }
+        }
+    }
+    
+    /* play the rest */
+    if (res == 0)
+    {
+        res = syn6288_stream_flush();
+    }
+    
+    /* print the segments */
+    (void)syn6288_stream_get_stats(&stats);
+    for (i = 0; syn6288_stream_get_segment(i, &seg) == 0; i++)
+    {
+        if (seg.status == SYN6288_STREAM_SEGMENT_DONE)
+        {
+            syn6288_interface_debug_print("syn6288: segment %d len %d estimate %dms wait %dms play %dms.\n",
+                                          i + 1, seg.len, seg.estimate, seg.start - seg.push, seg.done - seg.start);
+        }
+        else if (seg.status == SYN6288_STREAM_SEGMENT_DROPPED)
+        {
+            syn6288_interface_debug_print("syn6288: segment %d len %d dropped.\n", i + 1, seg.len);
+        }
+        else
+        {
+            syn6288_interface_debug_print("syn6288: segment %d len %d not played.\n", i + 1, seg.len);
+        }
+    }
+    syn6288_interface_debug_print("syn6288: stream segments %d, bytes %d, frames %d, done %d, dropped %d, skipped %d.\n",
+                                  stats.segments, stats.bytes, stats.frames, stats.done, stats.dropped, stats.skipped);
+    syn6288_interface_debug_print("syn6288: stream time %dms, wait avg %dms max %dms, gap avg %dms max %dms.\n",
+                                  stats.time, stats.wait_avg, stats.wait_max, stats.gap_avg, stats.gap_max);
+    
+    /* stream deinit */
+    (void)syn6288_stream_deinit();
+    
+    return (res != 0) ? 1 : 0;
+}
+
+/**
+ * @brief     signal handler
+ * @param[in] sig signal number
+ * @note      none
+ */
+static void a_syn6288_signal(int sig)
+{
+    (void)sig;
+    
+    syn6288_daemon_stop();
+}
+
+/**
+ * @brief     print a daemon event
+ * @param[in] *event pointer to an event message
+ * @note      none
+ */
+static void a_syn6288_say_event(syn6288_daemon_event_t *event)
+{
+    const char *reason[] = {"none", "daemon is full", "request is invalid", "protocol mismatch"};
+    
+    switch (event->type)
+    {
+        case SYN6288_DAEMON_EVENT_ACCEPT :
+        {
+            syn6288_interface_debug_print("syn6288: request %d queued.\n", event->id);
+            
+            break;
+        }
+        case SYN6288_DAEMON_EVENT_REJECT :
+        {
+            syn6288_interface_debug_print("syn6288: request rejected, %s.\n", reason[event->reason & 0x03]);
+            
+            break;
+        }
+        case SYN6288_DAEMON_EVENT_START :
+        {
+            syn6288_interface_debug_print("syn6288: request %d started after %dms.\n", event->id, event->wait);
+            
+            break;
+        }
+        case SYN6288_DAEMON_EVENT_PREEMPT :
+        {
+            syn6288_interface_debug_print("syn6288: request %d preempted after %dms.\n", event->id, event->time);
+            
+            break;
+        }
+        case SYN6288_DAEMON_EVENT_DONE :
+        {
+            syn6288_interface_debug_print("syn6288: request %d done in %dms.\n", event->id, event->time);
+            
+            break;
+        }
+        case SYN6288_DAEMON_EVENT_DROP :
+        {
+            syn6288_interface_debug_print("syn6288: request %d dropped after %dms.\n", event->id, event->time);
+            
+            break;
+        }
+        default :
+        {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief     syn6288 full function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 param is invalid
+ * @note      none
+ */
+uint8_t syn6288(uint8_t argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    const char short_options[] = "hipd:e:t:";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"information", no_argument, NULL, 'i'},
+        {"port", no_argument, NULL, 'p'},
+        {"device", required_argument, NULL, 'd'},
+        {"example", required_argument, NULL, 'e'},
+        {"test", required_argument, NULL, 't'},
+        {"msg", required_argument, NULL, 1},
+        {"ring", required_argument, NULL, 2},
+        {"sound", required_argument, NULL, 3},
+        {"text", required_argument, NULL, 4},
+        {"file", required_argument, NULL, 7},
+        {"encoding", required_argument, NULL, 8},
+        {"times", required_argument, NULL, 9},
+        {"socket", required_argument, NULL, 10},
+        {"priority", required_argument, NULL, 11},
+        {"deadline", required_argument, NULL, 12},
+        {"volume", required_argument, NULL, 13},
+        {"speed", required_argument, NULL, 14},
+        {"producer", required_argument, NULL, 15},
+        {"weight", required_argument, NULL, 16},
+        {"baud", required_argument, NULL, 5},
+        {"gpio", required_argument, NULL, 6},
+        {NULL, 0, NULL, 0},
+    };
+    char type[33] = "unknown";
+    uint8_t sound_flag = 0;
+    uint8_t msg_flag = 0;
+    uint8_t ring_flag = 0;
+    uint8_t text_flag = 0;
+    syn6288_sound_t sound = SYN6288_SOUND_A;
+    syn6288_message_t msg = SYN6288_MESSAGE_A;
+    syn6288_ring_t ring = SYN6288_RING_A;
+    char text[129] = {0};
+    char *file = NULL;
+    uint32_t times = 20;
+    syn6288_stream_encoding_t encoding = SYN6288_STREAM_ENCODING_UTF8;
+    char *socket_path = SYN6288_DAEMON_DEFAULT_SOCKET;
+    syn6288_queue_priority_t priority = SYN6288_QUEUE_PRIORITY_NORMAL;
+    uint32_t deadline = 0;
+    uint8_t volume = SYN6288_SERVICE_SETTING_DEFAULT;
+    uint8_t speed = SYN6288_SERVICE_SETTING_DEFAULT;
+    uint32_t producer = 0;
+    uint8_t weight = 0;
+    
+    /* if no params */
+    if (argc == 1)
+    {
+        /* goto the help */
+        goto help;
+    }
+    
+    /* init 0 */
+    optind = 0;
+    
+    /* parse */
+    do
+    {
+        /* parse the args */
+        c = getopt_long(argc, argv, short_options, long_options, &longindex);
+        
+        /* judge the result */
+        switch (c)
+        {
+            /* help */
+            case 'h' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "h");
+                
+                break;
+            }
+            
+            /* information */
+            case 'i' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "i");
+                
+                break;
+            }
+            
+            /* port */
+            case 'p' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "p");
+                
+                break;
+            }
+            
+            /* device */
+            case 'd' :
+            {
+                /* set the device */
+                syn6288_interface_set_device(optarg);
+                
+                break;
+            }
+            
+            /* example */
+            case 'e' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "e_%s", optarg);
+                
+                break;
+            }
+            
+            /* test */
+            case 't' :
+            {
+                /* set the type */
+                memset(type, 0, sizeof(char) * 33);
+                snprintf(type, 32, "t_%s", optarg);
+                
+                break;
+            }
+            
+            /* msg */
+            case 1 :
+            {
+                /* set the msg */
+                msg = (syn6288_message_t)(tolower(optarg[0]));
+                msg_flag = 1;
+                
+                break;
+            }
+            
+            /* ring */
+            case 2 :
+            {
+                /* set the ring */
+                ring = (syn6288_ring_t)(tolower(optarg[0]));
+                ring_flag = 1;
+                
+                break;
+            }
+            
+            /* sound */
+            case 3 :
+            {
+                /* set the sound */
+                sound = (syn6288_sound_t)(tolower(optarg[0]));
+                sound_flag = 1;
+                
+                break;
+            }
+             
+            /* text */
+            case 4 :
+            {
+                /* set the test */
+                memset(text, 0, sizeof(char) * 129);
+                strncpy(text, optarg, 128);
+                text_flag = 1;
+                
+                break;
+            } 
+            
+            /* baud */
+            case 5 :
+            {
+                /* check the baud */
+                if (atoi(optarg) <= 0)
+                {
+                    return 5;
+                }
+                
+                /* set the baud */
+                syn6288_interface_set_baud((uint32_t)atoi(optarg));
+                
+                break;
+            }
+            
+            /* gpio */
+            case 6 :
+            {
+                char chip[64];
+                uint32_t line;
+                uint8_t active_low;
+                
+                /* parse the gpio */
+                if (syn6288_interface_parse_gpio(optarg, chip, 64, &line, &active_low) != 0)
+                {
+                    return 5;
+                }
+                
+                /* set the gpio */
+                syn6288_interface_set_gpio(chip, line, active_low);
+                
+                break;
+            }
+            
+            /* file */
+            case 7 :
+            {
+                /* set the file */
+                file = optarg;
+                
+                break;
+            }
+            
+            /* encoding */
+            case 8 :
+            {
+                /* set the encoding */
+                if (strcmp("gb2312", optarg) == 0)
+                {
+                    encoding = SYN6288_STREAM_ENCODING_GB2312;
+                }
+                else if (strcmp("gbk", optarg) == 0)
+                {
+                    encoding = SYN6288_STREAM_ENCODING_GBK;
+                }
+                else if (strcmp("big5", optarg) == 0)
+                {
+                    encoding = SYN6288_STREAM_ENCODING_BIG5;
+                }
+                else if (strcmp("unicode", optarg) == 0)
+                {
+                    encoding = SYN6288_STREAM_ENCODING_UNICODE;
+                }
+                else if (strcmp("utf8", optarg) == 0)
+                {
+                    encoding = SYN6288_STREAM_ENCODING_UTF8;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* times */
+            case 9 :
+            {
+                /* set the times */
+                times = (uint32_t)atol(optarg);
+                
+                break;
+            }
+            
+            /* socket */
+            case 10 :
+            {
+                /* set the socket */
+                socket_path = optarg;
+                
+                break;
+            }
+            
+            /* priority */
+            case 11 :
+            {
+                /* set the priority */
+                if (strcmp("low", optarg) == 0)
+                {
+                    priority = SYN6288_QUEUE_PRIORITY_LOW;
+                }
+                else if (strcmp("normal", optarg) == 0)
+                {
+                    priority = SYN6288_QUEUE_PRIORITY_NORMAL;
+                }
+                else if (strcmp("high", optarg) == 0)
+                {
+                    priority = SYN6288_QUEUE_PRIORITY_HIGH;
+                }
+                else if (strcmp("emergency", optarg) == 0)
+                {
+                    priority = SYN6288_QUEUE_PRIORITY_EMERGENCY;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* deadline */
+            case 12 :
+            {
+                /* set the deadline */
+                deadline = (uint32_t)atol(optarg);
+                
+                break;
+            }
+            
+            /* volume */
+            case 13 :
+            {
+                /* check the volume */
+                if ((atoi(optarg) < 0) || (atoi(optarg) > 16))
+                {
+                    return 5;
+                }
+                
+                /* set the volume */
+                volume = (uint8_t)atoi(optarg);
+                
+                break;
+            }
+            
+            /* speed */
+            case 14 :
+            {
+                /* check the speed */
+                if ((atoi(optarg) < 0) || (atoi(optarg) > 5))
+                {
+                    return 5;
+                }
+                
+                /* set the speed */
+                speed = (uint8_t)atoi(optarg);
+                
+                break;
+            }
+            
+            /* producer */
+            case 15 :
+            {
+                /* set the producer */
+                producer = (uint32_t)atol(optarg);
+                
+                break;
+            }
+            
+            /* weight */
+            case 16 :
+            {
+                /* check the weight */
+                if ((atoi(optarg) < 1) || (atoi(optarg) > 255))
+                {
+                    return 5;
+                }
+                
+                /* set the weight */
+                weight = (uint8_t)atoi(optarg);
+                
+                break;
+            }
+            
+            /* the end */
+            case -1 :
+            {
+                break;
+            }
+            
+            /* others */
+            default :
+            {
+                return 5;
+            }
+        }
+    } while (c != -1);
+
+    /* run the function */
+    if (strcmp("t_reg", type) == 0)
+    {
+        /* run reg test */
+        if (syn6288_register_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_syn", type) == 0)
+    {
+        /* run syn test */
+        if (syn6288_synthesis_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_queue", type) == 0)
+    {
+        /* run queue test */
+        if (syn6288_queue_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_perf", type) == 0)
+    {
+        /* run perf test */
+        if (syn6288_perf_test(times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("e_syn", type) == 0)
+    {
+        uint8_t res;
+        
+        /* check the flag */
+        if (text_flag != 1)
+        {
+            return 5;
+        }
+        
+        /* basic init */
+        res = syn6288_basic_init();
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* delay 500ms */
+        syn6288_interface_delay_ms(500);
+        
+        /* output */
+        syn6288_interface_debug_print("syn6288: synthesis %s.\n", text);
+        
+        /* syn */
+        res = syn6288_basic_synthesis(text);
+        if (res != 0)
+        {
+            (void)syn6288_basic_deinit();
+            
+            return 1;
+        }
+        
+        /* basic deinit */
+        (void)syn6288_basic_sync();
+        (void)syn6288_basic_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_stream", type) == 0)
+    {
+        /* run the stream */
+        return a_syn6288_stream(file, encoding);
+    }
+    else if (strcmp("e_daemon", type) == 0)
+    {
+        /* stop on a signal */
+        (void)signal(SIGINT, a_syn6288_signal);
+        (void)signal(SIGTERM, a_syn6288_signal);
+        
+        /* run the daemon */
+        return syn6288_daemon_run(socket_path);
+    }
+    else if (strcmp("e_say", type) == 0)
+    {
+        syn6288_daemon_request_t request;
+        
+        /* check the flag */
+        if (text_flag != 1)
+        {
+            return 5;
+        }
+        
+        /* set the request */
+        memset(&request, 0, sizeof(syn6288_daemon_request_t));
+        request.encoding = (uint8_t)encoding;
+        request.priority = (uint8_t)priority;
+        request.deadline = deadline;
+        request.mode = SYN6288_SERVICE_SETTING_DEFAULT;
+        request.volume = volume;
+        request.background_volume = SYN6288_SERVICE_SETTING_DEFAULT;
+        request.speed = speed;
+        request.tag = (uint32_t)getpid();
+        request.producer = producer;
+        request.weight = weight;
+        memcpy(request.text, text, strlen(text));
+        
+        /* say through the daemon */
+        return syn6288_daemon_say(socket_path, &request, (uint16_t)strlen(text), a_syn6288_say_event);
+    }
+    else if (strcmp("e_ring", type) == 0)
+    {
+        syn6288_daemon_request_t request;
+        
+        /* check the flag */
+        if (text_flag != 1)
+        {
+            return 5;
+        }
+        
+        /* set the request */
+        memset(&request, 0, sizeof(syn6288_daemon_request_t));
+        request.encoding = (uint8_t)encoding;
+        request.priority = (uint8_t)priority;
+        request.deadline = deadline;
+        request.mode = SYN6288_SERVICE_SETTING_DEFAULT;
+        request.volume = volume;
+        request.background_volume = SYN6288_SERVICE_SETTING_DEFAULT;
+        request.speed = speed;
+        request.tag = (uint32_t)getpid() << 8;
+        request.producer = producer;
+        request.weight = weight;
+        memcpy(request.text, text, strlen(text));
+        
+        /* say times times through a shared memory ring */
+        return syn6288_daemon_ring_say(socket_path, &request, (uint16_t)strlen(text), times, a_syn6288_say_event);
+    }
+    else if (strcmp("e_advance-syn", type) == 0)
+    {
+        uint8_t res;
+        
+        /* check the flag */
+        if (text_flag != 1)
+        {
+            return 5;
+        }
+
+        /* advance init */
+        res = syn6288_advance_init();
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* delay 500ms */
+        syn6288_interface_delay_ms(500);
+        
+        /* output */
+        syn6288_interface_debug_print("syn6288: synthesis %s.\n", text);
+        
+        /* syn */
+        res = syn6288_advance_synthesis(text);
+        if (res != 0)
+        {
+            (void)syn6288_advance_deinit();
+            
+            return 1;
+        }
+        
+        /* advance deinit */
+        (void)syn6288_advance_sync();
+        (void)syn6288_advance_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_advance-sound", type) == 0)
+    {
+        uint8_t res;
+        
+        /* check the flag */
+        if (sound_flag != 1)
+        {
+            return 5;
+        }
+        
+        /* advance init */
+        res = syn6288_advance_init();
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* delay 500ms */
+        syn6288_interface_delay_ms(500);
+        
+        /* output */
+        syn6288_interface_debug_print("syn6288: synthesis sound %c.\n", sound);
+        res = syn6288_advance_sound(sound);
+        if (res != 0)
+        {
+            (void)syn6288_advance_deinit();
+            
+            return 1;
+        }
+        
+        /* advance deinit */
+        (void)syn6288_advance_sync();
+        (void)syn6288_advance_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_advance-msg", type) == 0)
+    {
+        uint8_t res;
+        
+        /* check the flag */
+        if (msg_flag != 1)
+        {
+            return 5;
+        }
+        
+        /* advance init */
+        res = syn6288_advance_init();
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* delay 500ms */
+        syn6288_interface_delay_ms(500);
+        
+        /* output */
+        syn6288_interface_debug_print("syn6288: synthesis message %c.\n", msg);
+        
+        /* msg */
+        res = syn6288_advance_message(msg);
+        if (res != 0)
+        {
+            (void)syn6288_advance_deinit();
+            
+            return 1;
+        }
+        
+        /* advance deinit */
+        (void)syn6288_advance_sync();
+        (void)syn6288_advance_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("e_advance-ring", type) == 0)
+    {
+        uint8_t res;
+        
+        /* check the flag */
+        if (ring_flag != 1)
+        {
+            return 5;
+        }
+        
+        /* advance init */
+        res = syn6288_advance_init();
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* delay 500ms */
+        syn6288_interface_delay_ms(500);
+        
+        /* output */
+        syn6288_interface_debug_print("syn6288: synthesis ring %c.\n", ring);
+        
+        /* ring */
+        res = syn6288_advance_ring(ring);
+        if (res != 0)
+        {
+            (void)syn6288_advance_deinit();
+            
+            return 1;
+        }
+        
+        /* advance deinit */
+        (void)syn6288_advance_sync();
+        (void)syn6288_advance_deinit();
+        
+        return 0;
+    }
+    else if (strcmp("h", type) == 0)
+    {
+        help:
+        syn6288_interface_debug_print("Usage:\n");
+        syn6288_interface_debug_print("  syn6288 (-i | --information)\n");
+        syn6288_interface_debug_print("  syn6288 (-h | --help)\n");
+        syn6288_interface_debug_print("  syn6288 (-p | --port)\n");
+        syn6288_interface_debug_print("  syn6288 (-t reg | --test=reg)\n");
+        syn6288_interface_debug_print("  syn6288 (-t syn | --test=syn)\n");
+        syn6288_interface_debug_print("  syn6288 (-t queue | --test=queue)\n");
+        syn6288_interface_debug_print("  syn6288 (-t perf | --test=perf) [--times=<num>]\n");
+        syn6288_interface_debug_print("  syn6288 (-e syn | --example=syn) --text=<gb2312>\n");
+        syn6288_interface_debug_print("  syn6288 (-e advance-syn | --example=advance-syn) --text=<gb2312>\n");
+        syn6288_interface_debug_print("  syn6288 (-e advance-sound | --example=advance-sound) --sound=<type>\n");
+        syn6288_interface_debug_print("  syn6288 (-e advance-msg | --example=advance-msg) --msg=<type>\n");
+        syn6288_interface_debug_print("  syn6288 (-e advance-ring | --example=advance-ring) --ring=<type>\n");
+        syn6288_interface_debug_print("  syn6288 (-e stream | --example=stream) [--file=<path>] [--encoding=<utf8 | gb2312 | gbk | big5 | unicode>]\n");
+        syn6288_interface_debug_print("  syn6288 (-e daemon | --example=daemon) [--socket=<path>]\n");
+        syn6288_interface_debug_print("  syn6288 (-e say | --example=say) --text=<text> [--socket=<path>] [--encoding=<utf8 | gb2312 | gbk | big5 | unicode>]\n");
+        syn6288_interface_debug_print("          [--priority=<low | normal | high | emergency>] [--deadline=<ms>] [--volume=<0 - 16>] [--speed=<0 - 5>]\n");
+        syn6288_interface_debug_print("          [--producer=<id>] [--weight=<1 - 255>]\n");
+        syn6288_interface_debug_print("  syn6288 (-e ring | --example=ring) --text=<text> [--times=<num>] [--socket=<path>] [--encoding=<utf8 | gb2312 | gbk | big5 | unicode>]\n");
+        syn6288_interface_debug_print("          [--priority=<low | normal | high | emergency>] [--deadline=<ms>] [--volume=<0 - 16>] [--speed=<0 - 5>]\n");
+        syn6288_interface_debug_print("          [--producer=<id>] [--weight=<1 - 255>]\n");
+        syn6288_interface_debug_print("\n");
+        syn6288_interface_debug_print("Options:\n");
+        syn6288_interface_debug_print("      --baud=<rate>       Set the uart baud rate, the default is $SYN6288_BAUD or 9600.\n");
+        syn6288_interface_debug_print("      --deadline=<ms>     Set the latest start of the said text after the request, the default is 0 and means none.\n");
+        syn6288_interface_debug_print("  -d <path>, --device=<path>\n");
+        syn6288_interface_debug_print("                          Set the uart device, the default is $SYN6288_DEVICE or /dev/ttyS0.\n");
+        syn6288_interface_debug_print("  -e <syn | advance-syn | advance-sound | advance-msg | advance-ring | stream | daemon | say | ring>,\n");
+        syn6288_interface_debug_print("     --example=<syn | advance-syn | advance-sound | advance-msg | advance-ring | stream | daemon | say | ring>\n");
+        syn6288_interface_debug_print("                          Run the driver example.\n");
+        syn6288_interface_debug_print("      --encoding=<utf8 | gb2312 | gbk | big5 | unicode>\n");
+        syn6288_interface_debug_print("                          Set the stream or said text encoding, utf8 is sent as unicode and the default is utf8.\n");
+        syn6288_interface_debug_print("      --file=<path>       Set the stream file, it's memory mapped and the default is stdin.\n");
+        syn6288_interface_debug_print("      --gpio=<chip:line[:low]>\n");
+        syn6288_interface_debug_print("                          Set the optional enable line, the default is $SYN6288_GPIO or none.\n");
+        syn6288_interface_debug_print("  -h, --help              Show the help.\n");
+        syn6288_interface_debug_print("  -i, --information       Show the chip information.\n");
+        syn6288_interface_debug_print("      --msg=<type>        Set the synthesis message and type can be \"A\" - \"H\".\n");
+        syn6288_interface_debug_print("  -p, --port              Display the current device, baud rate and enable line.\n");
+        syn6288_interface_debug_print("      --producer=<id>     Set the producer sharing the speaking time with the said text and the default is 0.\n");
+        syn6288_interface_debug_print("      --priority=<low | normal | high | emergency>\n");
+        syn6288_interface_debug_print("                          Set the priority of the said text and the default is normal.\n");
+        syn6288_interface_debug_print("      --ring=<type>       Set the synthesis ring and type can be \"A\" - \"O\".\n");
+        syn6288_interface_debug_print("      --socket=<path>     Set the daemon socket and the default is %s.\n", SYN6288_DAEMON_DEFAULT_SOCKET);
+        syn6288_interface_debug_print("      --sound=<type>      Set the synthesis sound and type can be \"A\" - \"Y\".\n");
+        syn6288_interface_debug_print("      --speed=<0 - 5>     Set the speed of the said text and the default is 5.\n");
+        syn6288_interface_debug_print("  -t <reg | syn | queue | perf>, --test=<reg | syn | queue | perf>\n");
+        syn6288_interface_debug_print("                          Run the driver test.\n");
+        syn6288_interface_debug_print("      --times=<num>       Set the sample number of each perf latency or the ring request number and the default is 20.\n");
+        syn6288_interface_debug_print("      --text=<gb2312>     Set the synthesis text and it's format is GB2312.\n");
+        syn6288_interface_debug_print("      --volume=<0 - 16>   Set the volume of the said text and the default is 16.\n");
+        syn6288_interface_debug_print("      --weight=<1 - 255>  Set the speaking time share of the producer and the default is the current weight or 1.\n");
+        
+        return 0;
+    }
+    else if (strcmp("i", type) == 0)
+    {
+        syn6288_info_t info;
+        
+        /* print syn6288 info */
+        syn6288_info(&info);
+        syn6288_interface_debug_print("syn6288: chip is %s.\n", info.chip_name);
+        syn6288_interface_debug_print("syn6288: manufacturer is %s.\n", info.manufacturer_name);
+        syn6288_interface_debug_print("syn6288: interface is %s.\n", info.interface);
+        syn6288_interface_debug_print("syn6288: driver version is %d.%d.\n", info.driver_version / 1000, (info.driver_version % 1000) / 100);
+        syn6288_interface_debug_print("syn6288: min supply voltage is %0.1fV.\n", info.supply_voltage_min_v);
+        syn6288_interface_debug_print("syn6288: max supply voltage is %0.1fV.\n", info.supply_voltage_max_v);
+        syn6288_interface_debug_print("syn6288: max current is %0.2fmA.\n", info.max_current_ma);
+        syn6288_interface_debug_print("syn6288: max temperature is %0.1fC.\n", info.temperature_max);
+        syn6288_interface_debug_print("syn6288: min temperature is %0.1fC.\n", info.temperature_min);
+        
+        return 0;
+    }
+    else if (strcmp("p", type) == 0)
+    {
+        const char *name;
+        const char *chip;
+        uint32_t baud;
+        uint32_t line;
+        uint8_t active_low;
+        
+        /* print the connection */
+        syn6288_interface_get_settings(&name, &baud, &chip, &line, &active_low);
+        syn6288_interface_debug_print("syn6288: device is %s.\n", name);
+        syn6288_interface_debug_print("syn6288: baud rate is %d.\n", baud);
+        if (chip != NULL)
+        {
+            syn6288_interface_debug_print("syn6288: enable line is %s:%d active %s.\n", chip, line, (active_low != 0) ? "low" : "high");
+        }
+        else
+        {
+            syn6288_interface_debug_print("syn6288: enable line is not used.\n");
+        }
+        
+        return 0;
+    }
+    else
+    {
+        return 5;
+    }
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *             - 0 success
+ * @note      none
+ */
+int main(uint8_t argc, char **argv)
+{
+    uint8_t res;
+
+    res = syn6288(argc, argv);
+    if (res == 0)
+    {
+        /* run success */
+    }
+    else if (res == 1)
+    {
+        syn6288_interface_debug_print("syn6288: run failed.\n");
+    }
+    else if (res == 5)
+    {
+        syn6288_interface_debug_print("syn6288: param is invalid.\n");
+    }
+    else
+    {
+        syn6288_interface_debug_print("syn6288: unknown status code.\n");
+    }
+
+    return 0;
+}
@@ -36,19 +36,44 @@
  */
 
 #include "driver_syn6288_interface.h"
+#include "driver_syn6288_queue.h"
 #include "uart.h"
+#include "record.h"
 #include <stdarg.h>
+#include <time.h>
 
 /**
  * @brief uart device name definition
+ * @note  can be set at build time, such as the link of a protocol emulator
  */
-#define UART_DEVICE_NAME "/dev/ttyS0"        /**< uart device name */
+#ifndef UART_DEVICE_NAME
+    #define UART_DEVICE_NAME "/dev/ttyS0"        /**< uart device name */
+#endif
 
 /**
  * @brief uart device handle definition
  */
 static int gs_fd;                           /**< uart handle */
 
+/**
+ * @brief interface event ring definition
+ */
+#define SYN6288_INTERFACE_EVENT_MAX    16        /**< event ring size */
+
+/**
+ * @brief interface event structure definition
+ */
+typedef struct syn6288_interface_event_s
+{
+    uint8_t code;           /**< event code */
+    uint8_t command;        /**< command opcode */
+    uint32_t value;         /**< event value */
+} syn6288_interface_event_t;
+
+static syn6288_interface_event_t gs_event[SYN6288_INTERFACE_EVENT_MAX];        /**< event ring */
+static volatile uint32_t gs_event_write = 0;                                   /**< written event count */
+static volatile uint32_t gs_event_read = 0;                                    /**< read event count */
+
 /**
  * @brief  interface uart init
  * @return status code
@@ -58,7 +83,21 @@ static int gs_fd;                           /**< uart handle */
  */
 uint8_t syn6288_interface_uart_init(void)
 {
-    return uart_init(UART_DEVICE_NAME, &gs_fd, 9600, 8, 'N', 1);
+    if (record_init() != 0)
+    {
+        return 1;
+    }
+    if (record_get_mode() == RECORD_MODE_REPLAY)
+    {
+        return 0;
+    }
+    if (uart_init(UART_DEVICE_NAME, &gs_fd, 9600, 8, 'N', 1) != 0)
+    {
+        return 1;
+    }
+    record_log(RECORD_TYPE_INIT, NULL, 0, 9600);
+    
+    return 0;
 }
 
 /**
@@ -70,6 +109,12 @@ uint8_t syn6288_interface_uart_init(void)
  */
 uint8_t syn6288_interface_uart_deinit(void)
 {
+    if (record_get_mode() == RECORD_MODE_REPLAY)
+    {
+        return 0;
+    }
+    record_log(RECORD_TYPE_DEINIT, NULL, 0, 0);
+    
     return uart_deinit(gs_fd);
 }
 
@@ -86,12 +131,21 @@ uint16_t syn6288_interface_uart_read(uint8_t *buf, uint16_t len)
 {
     uint32_t l = len;
 
+    if (record_get_mode() == RECORD_MODE_REPLAY)
+    {
+        return replay_read(buf, len);
+    }
     if (uart_read(gs_fd, buf, (uint32_t *)&l))
     {
         return 0;
     }
     else
     {
+        if (l != 0)
+        {
+            record_log(RECORD_TYPE_READ, buf, (uint16_t)l, 0);
+        }
+        
         return l;
     }
 }
@@ -105,6 +159,12 @@ uint16_t syn6288_interface_uart_read(uint8_t *buf, uint16_t len)
  */
 uint8_t syn6288_interface_uart_flush(void)
 {
+    if (record_get_mode() == RECORD_MODE_REPLAY)
+    {
+        return replay_flush();
+    }
+    record_log(RECORD_TYPE_FLUSH, NULL, 0, 0);
+    
     return uart_flush(gs_fd);
 }
 
@@ -119,6 +179,12 @@ uint8_t syn6288_interface_uart_flush(void)
  */
 uint8_t syn6288_interface_uart_write(uint8_t *buf, uint16_t len)
 {
+    if (record_get_mode() == RECORD_MODE_REPLAY)
+    {
+        return replay_write(buf, len);
+    }
+    record_log(RECORD_TYPE_WRITE, buf, len, 0);
+    
     return uart_write(gs_fd, buf, len);
 }
 
@@ -129,7 +195,14 @@ uint8_t syn6288_interface_uart_write(uint8_t *buf, uint16_t len)
  */
 void syn6288_interface_delay_ms(uint32_t ms)
 {
+    if (record_get_mode() == RECORD_MODE_REPLAY)
+    {
+        replay_delay_ms(ms);
+        
+        return;
+    }
     usleep(1000 * ms);
+    record_log(RECORD_TYPE_DELAY, NULL, 0, ms);
 }
 
 /**
@@ -149,3 +222,113 @@ void syn6288_interface_debug_print(const char *const fmt, ...)
     
     (void)printf((uint8_t *)str);
 }
+
+/**
+ * @brief  interface timestamp ms
+ * @return current monotonic time in ms
+ * @note   the value may wrap around
+ */
+uint32_t syn6288_interface_timestamp_ms(void)
+{
+    struct timespec ts;
+    
+    if (record_get_mode() == RECORD_MODE_REPLAY)
+    {
+        return replay_timestamp_ms();
+    }
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000);
+}
+
+/**
+ * @brief     interface event
+ * @param[in] code event code
+ * @param[in] command command opcode
+ * @param[in] value event value
+ * @note      the event is kept in a ring, the oldest event is overwritten when the ring is full
+ */
+void syn6288_interface_event(uint8_t code, uint8_t command, uint32_t value)
+{
+    uint32_t i;
+    
+    i = gs_event_write % SYN6288_INTERFACE_EVENT_MAX;
+    gs_event[i].code = code;
+    gs_event[i].command = command;
+    gs_event[i].value = value;
+    gs_event_write++;
+    if ((gs_event_write - gs_event_read) > SYN6288_INTERFACE_EVENT_MAX)
+    {
+        gs_event_read = gs_event_write - SYN6288_INTERFACE_EVENT_MAX;
+    }
+}
+
+/**
+ * @brief      interface event read
+ * @param[out] *code pointer to an event code buffer
+ * @param[out] *command pointer to a command opcode buffer
+ * @param[out] *value pointer to an event value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 no event
+ * @note       none
+ */
+uint8_t syn6288_interface_event_read(uint8_t *code, uint8_t *command, uint32_t *value)
+{
+    uint32_t i;
+    
+    if (gs_event_read == gs_event_write)
+    {
+        return 1;
+    }
+    i = gs_event_read % SYN6288_INTERFACE_EVENT_MAX;
+    *code = gs_event[i].code;
+    *command = gs_event[i].command;
+    *value = gs_event[i].value;
+    gs_event_read++;
+    
+    return 0;
+}
+
+/**
+ * @brief     interface receive callback
+ * @param[in] type event type
+ * @param[in] id item id
+ * @note      none
+ */
+void syn6288_interface_receive_callback(uint8_t type, uint32_t id)
+{
+    switch (type)
+    {
+        case SYN6288_QUEUE_EVENT_START :
+        {
+            syn6288_interface_debug_print("syn6288: irq item %u start.\n", id);
+            
+            break;
+        }
+        case SYN6288_QUEUE_EVENT_DONE :
+        {
+            syn6288_interface_debug_print("syn6288: irq item %u done.\n", id);
+            
+            break;
+        }
+        case SYN6288_QUEUE_EVENT_DROP :
+        {
+            syn6288_interface_debug_print("syn6288: irq item %u drop.\n", id);
+            
+            break;
+        }
+        case SYN6288_QUEUE_EVENT_PREEMPT :
+        {
+            syn6288_interface_debug_print("syn6288: irq item %u preempt.\n", id);
+            
+            break;
+        }
+        default :
+        {
+            syn6288_interface_debug_print("syn6288: unknown code.\n");
+            
+            break;
+        }
+    }
+}
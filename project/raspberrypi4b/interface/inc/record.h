@@ -0,0 +1,161 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      record.h
+ * @brief     record header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RECORD_H
+#define RECORD_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup record record function
+ * @brief    uart traffic record and replay modules
+ * @{
+ */
+
+/**
+ * @brief record mode enumeration definition
+ */
+typedef enum
+{
+    RECORD_MODE_NONE   = 0x00,        /**< pass through */
+    RECORD_MODE_RECORD = 0x01,        /**< record the traffic */
+    RECORD_MODE_REPLAY = 0x02,        /**< replay a recording instead of the uart */
+} record_mode_t;
+
+/**
+ * @brief record type enumeration definition
+ */
+typedef enum
+{
+    RECORD_TYPE_INIT   = 'I',        /**< uart init, arg is the baud rate */
+    RECORD_TYPE_DEINIT = 'X',        /**< uart deinit */
+    RECORD_TYPE_WRITE  = 'W',        /**< written bytes */
+    RECORD_TYPE_READ   = 'R',        /**< read bytes, empty reads are not recorded */
+    RECORD_TYPE_FLUSH  = 'F',        /**< uart flush */
+    RECORD_TYPE_DELAY  = 'D',        /**< delay, arg is the time in ms */
+} record_type_t;
+
+/**
+ * @brief  record init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   SYN6288_RECORD=<path> records the traffic, SYN6288_REPLAY=<path> replays it
+ *         and SYN6288_REPLAY_SPEED=<n> replays n times faster, 0 means no wait
+ *         the file is opened once and closed at exit
+ */
+uint8_t record_init(void);
+
+/**
+ * @brief  record deinit
+ * @note   flush the recording or print the replay summary
+ */
+void record_deinit(void);
+
+/**
+ * @brief  get the record mode
+ * @return record mode
+ * @note   none
+ */
+record_mode_t record_get_mode(void);
+
+/**
+ * @brief     log one link call in the record mode
+ * @param[in] type record type
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @param[in] arg record arg
+ * @note      each record is the type, the time since the last record in us,
+ *            the arg of init and delay and the length and the data of write and read,
+ *            the numbers are unsigned leb128
+ */
+void record_log(record_type_t type, const uint8_t *buf, uint16_t len, uint32_t arg);
+
+/**
+ * @brief     replay a uart write
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ * @note      the bytes are checked against the recorded write and
+ *            the recorded reads of this write are played from now on
+ */
+uint8_t replay_write(uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      replay a uart read
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len buffer length
+ * @return     read length
+ * @note       a recorded read is due after the same delays since its write as recorded
+ */
+uint16_t replay_read(uint8_t *buf, uint16_t len);
+
+/**
+ * @brief  replay a uart flush
+ * @return status code
+ *         - 0 success
+ * @note   the due reads are dropped
+ */
+uint8_t replay_flush(void);
+
+/**
+ * @brief     replay a delay
+ * @param[in] ms time in ms
+ * @note      the replay clock advances by ms and sleeps ms divided by the speed
+ */
+void replay_delay_ms(uint32_t ms);
+
+/**
+ * @brief  get the replay clock
+ * @return replay time in ms
+ * @note   none
+ */
+uint32_t replay_timestamp_ms(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
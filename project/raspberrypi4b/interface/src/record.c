@@ -0,0 +1,548 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      record.c
+ * @brief     record source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "record.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief record file definition
+ */
+#define RECORD_MAGIC        "SYN6288R"        /**< file magic */
+#define RECORD_VERSION      1                 /**< file version */
+
+/**
+ * @brief record item structure definition
+ */
+typedef struct record_item_s
+{
+    uint64_t time;           /**< record time in us */
+    uint32_t clock;          /**< sum of the delays before the record in ms */
+    uint32_t arg;            /**< record arg */
+    uint32_t offset;         /**< data offset in the file */
+    uint16_t len;            /**< data length */
+    uint8_t type;            /**< record type */
+} record_item_t;
+
+/**
+ * @brief record structure definition
+ */
+typedef struct record_s
+{
+    uint8_t inited;                 /**< inited flag */
+    record_mode_t mode;             /**< record mode */
+    FILE *fp;                       /**< record file */
+    uint64_t last;                  /**< last record time in us */
+    uint8_t *data;                  /**< replay file data */
+    record_item_t *item;            /**< replay items */
+    uint32_t num;                   /**< replay item number */
+    uint32_t speed;                 /**< replay speed */
+    uint32_t now;                   /**< replay clock in ms */
+    uint32_t write;                 /**< next write item */
+    uint32_t read;                  /**< next read item */
+    uint16_t read_pos;              /**< read position in the read item */
+    uint32_t anchor_clock;          /**< recorded clock of the current write in ms */
+    uint32_t anchor;                /**< replay time of the current write in ms */
+    uint32_t writes;                /**< replayed writes */
+    uint32_t mismatched;            /**< writes not equal to the recording */
+    uint32_t missing;               /**< writes after the end of the recording */
+    uint32_t read_bytes;            /**< replayed read bytes */
+    uint64_t start;                 /**< replay start in us */
+} record_t;
+
+/**
+ * @brief global var definition
+ */
+static record_t gs_record;        /**< record handle */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in us
+ * @note   none
+ */
+static uint64_t a_record_now(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+/**
+ * @brief     write an unsigned leb128 number
+ * @param[in] value number
+ * @note      none
+ */
+static void a_record_put(uint64_t value)
+{
+    uint8_t b;
+    
+    do
+    {
+        b = (uint8_t)(value & 0x7F);
+        value >>= 7;
+        if (value != 0)
+        {
+            b |= 0x80;
+        }
+        (void)fputc(b, gs_record.fp);
+    } while (value != 0);
+}
+
+/**
+ * @brief         read an unsigned leb128 number
+ * @param[in]     *buf pointer to the file data
+ * @param[in]     size file size
+ * @param[in,out] *pos pointer to a read position
+ * @param[out]    *value pointer to a number buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 file is truncated
+ * @note          none
+ */
+static uint8_t a_record_get(const uint8_t *buf, uint32_t size, uint32_t *pos, uint64_t *value)
+{
+    uint8_t shift = 0;
+    
+    *value = 0;
+    while (*pos < size)
+    {
+        *value |= (uint64_t)(buf[*pos] & 0x7F) << shift;
+        if ((buf[(*pos)++] & 0x80) == 0)
+        {
+            return 0;
+        }
+        shift = (uint8_t)(shift + 7);
+        if (shift > 63)
+        {
+            return 1;
+        }
+    }
+    
+    return 1;
+}
+
+/**
+ * @brief     load a recording
+ * @param[in] *path pointer to a file path
+ * @return    status code
+ *            - 0 success
+ *            - 1 load failed
+ * @note      none
+ */
+static uint8_t a_record_load(const char *path)
+{
+    FILE *fp;
+    long size;
+    uint32_t pos;
+    uint32_t num;
+    uint32_t clock;
+    uint64_t t;
+    uint64_t v;
+    record_item_t *item;
+    
+    fp = fopen(path, "rb");
+    if (fp == NULL)
+    {
+        perror("record: open failed.\n");
+        
+        return 1;
+    }
+    if ((fseek(fp, 0, SEEK_END) != 0) || ((size = ftell(fp)) < 9) || (fseek(fp, 0, SEEK_SET) != 0))
+    {
+        (void)fprintf(stderr, "record: %s is not a recording.\n", path);
+        (void)fclose(fp);
+        
+        return 1;
+    }
+    gs_record.data = (uint8_t *)malloc((size_t)size);
+    
+    /* each record takes 3 bytes at least */
+    gs_record.item = (record_item_t *)malloc(sizeof(record_item_t) * ((size_t)size / 3 + 1));
+    if ((gs_record.data == NULL) || (gs_record.item == NULL) ||
+        (fread(gs_record.data, 1, (size_t)size, fp) != (size_t)size))
+    {
+        (void)fprintf(stderr, "record: load %s failed.\n", path);
+        (void)fclose(fp);
+        
+        return 1;
+    }
+    (void)fclose(fp);
+    if ((memcmp(gs_record.data, RECORD_MAGIC, 8) != 0) || (gs_record.data[8] != RECORD_VERSION))
+    {
+        (void)fprintf(stderr, "record: %s is not a recording.\n", path);
+        
+        return 1;
+    }
+    
+    /* parse the records */
+    pos = 9;
+    num = 0;
+    clock = 0;
+    t = 0;
+    while (pos < (uint32_t)size)
+    {
+        item = &gs_record.item[num];
+        item->type = gs_record.data[pos++];
+        item->arg = 0;
+        item->len = 0;
+        item->offset = 0;
+        if (a_record_get(gs_record.data, (uint32_t)size, &pos, &v) != 0)
+        {
+            break;
+        }
+        t += v;
+        item->time = t;
+        if ((item->type == RECORD_TYPE_INIT) || (item->type == RECORD_TYPE_DELAY))
+        {
+            if (a_record_get(gs_record.data, (uint32_t)size, &pos, &v) != 0)
+            {
+                break;
+            }
+            item->arg = (uint32_t)v;
+            if (item->type == RECORD_TYPE_DELAY)
+            {
+                clock += item->arg;
+            }
+        }
+        else if ((item->type == RECORD_TYPE_WRITE) || (item->type == RECORD_TYPE_READ))
+        {
+            if ((a_record_get(gs_record.data, (uint32_t)size, &pos, &v) != 0) || (v > (uint64_t)size - pos))
+            {
+                break;
+            }
+            item->len = (uint16_t)v;
+            item->offset = pos;
+            pos += (uint32_t)v;
+        }
+        else
+        {
+            
+        }
+        item->clock = clock;
+        num++;
+    }
+    if (pos < (uint32_t)size)
+    {
+        (void)fprintf(stderr, "record: %s is truncated after %u records.\n", path, (unsigned int)num);
+    }
+    gs_record.num = num;
+    
+    return 0;
+}
+
+/**
+ * @brief  record init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   SYN6288_RECORD=<path> records the traffic, SYN6288_REPLAY=<path> replays it
+ *         and SYN6288_REPLAY_SPEED=<n> replays n times faster, 0 means no wait
+ *         the file is opened once and closed at exit
+ */
+uint8_t record_init(void)
+{
+    char *path;
+    char *speed;
+    
+    if (gs_record.inited != 0)
+    {
+        return 0;
+    }
+    memset(&gs_record, 0, sizeof(record_t));
+    path = getenv("SYN6288_REPLAY");
+    if (path != NULL)
+    {
+        if (a_record_load(path) != 0)
+        {
+            free(gs_record.data);
+            free(gs_record.item);
+            memset(&gs_record, 0, sizeof(record_t));
+            
+            return 1;
+        }
+        speed = getenv("SYN6288_REPLAY_SPEED");
+        gs_record.speed = (speed != NULL) ? (uint32_t)strtoul(speed, NULL, 0) : 1;
+        gs_record.start = a_record_now();
+        gs_record.mode = RECORD_MODE_REPLAY;
+    }
+    else
+    {
+        path = getenv("SYN6288_RECORD");
+        if (path != NULL)
+        {
+            gs_record.fp = fopen(path, "wb");
+            if (gs_record.fp == NULL)
+            {
+                perror("record: open failed.\n");
+                
+                return 1;
+            }
+            (void)fwrite(RECORD_MAGIC, 1, 8, gs_record.fp);
+            (void)fputc(RECORD_VERSION, gs_record.fp);
+            gs_record.last = a_record_now();
+            gs_record.mode = RECORD_MODE_RECORD;
+        }
+    }
+    gs_record.inited = 1;
+    (void)atexit(record_deinit);
+    
+    return 0;
+}
+
+/**
+ * @brief  record deinit
+ * @note   flush the recording or print the replay summary
+ */
+void record_deinit(void)
+{
+    if (gs_record.inited == 0)
+    {
+        return;
+    }
+    if (gs_record.mode == RECORD_MODE_RECORD)
+    {
+        (void)fclose(gs_record.fp);
+    }
+    else if (gs_record.mode == RECORD_MODE_REPLAY)
+    {
+        (void)fprintf(stderr, "replay: writes %u, mismatched %u, missing %u, read bytes %u.\n",
+                      (unsigned int)gs_record.writes, (unsigned int)gs_record.mismatched,
+                      (unsigned int)gs_record.missing, (unsigned int)gs_record.read_bytes);
+        (void)fprintf(stderr, "replay: recorded %u ms, replayed %u ms in %u ms.\n",
+                      (unsigned int)((gs_record.num != 0) ? (gs_record.item[gs_record.num - 1].time / 1000) : 0),
+                      (unsigned int)gs_record.now, (unsigned int)((a_record_now() - gs_record.start) / 1000));
+        free(gs_record.data);
+        free(gs_record.item);
+    }
+    else
+    {
+        
+    }
+    memset(&gs_record, 0, sizeof(record_t));
+}
+
+/**
+ * @brief  get the record mode
+ * @return record mode
+ * @note   none
+ */
+record_mode_t record_get_mode(void)
+{
+    return gs_record.mode;
+}
+
+/**
+ * @brief     log one link call in the record mode
+ * @param[in] type record type
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @param[in] arg record arg
+ * @note      each record is the type, the time since the last record in us,
+ *            the arg of init and delay and the length and the data of write and read,
+ *            the numbers are unsigned leb128
+ */
+void record_log(record_type_t type, const uint8_t *buf, uint16_t len, uint32_t arg)
+{
+    uint64_t now;
+    
+    if (gs_record.mode != RECORD_MODE_RECORD)
+    {
+        return;
+    }
+    now = a_record_now();
+    (void)fputc((int)type, gs_record.fp);
+    a_record_put(now - gs_record.last);
+    gs_record.last = now;
+    if ((type == RECORD_TYPE_INIT) || (type == RECORD_TYPE_DELAY))
+    {
+        a_record_put(arg);
+    }
+    else if ((type == RECORD_TYPE_WRITE) || (type == RECORD_TYPE_READ))
+    {
+        a_record_put(len);
+        (void)fwrite(buf, 1, len, gs_record.fp);
+    }
+    else if (type == RECORD_TYPE_DEINIT)
+    {
+        (void)fflush(gs_record.fp);
+    }
+    else
+    {
+        
+    }
+}
+
+/**
+ * @brief     replay a uart write
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ * @note      the bytes are checked against the recorded write and
+ *            the recorded reads of this write are played from now on
+ */
+uint8_t replay_write(uint8_t *buf, uint16_t len)
+{
+    record_item_t *item;
+    
+    while ((gs_record.write < gs_record.num) && (gs_record.item[gs_record.write].type != RECORD_TYPE_WRITE))
+    {
+        gs_record.write++;
+    }
+    if (gs_record.write >= gs_record.num)
+    {
+        gs_record.missing++;
+        gs_record.read = gs_record.num;
+        
+        return 0;
+    }
+    item = &gs_record.item[gs_record.write];
+    gs_record.writes++;
+    if ((item->len != len) || (memcmp(&gs_record.data[item->offset], buf, len) != 0))
+    {
+        if (gs_record.mismatched == 0)
+        {
+            (void)fprintf(stderr, "replay: write %u differs from the recording.\n", (unsigned int)gs_record.writes);
+        }
+        gs_record.mismatched++;
+    }
+    gs_record.anchor_clock = item->clock;
+    gs_record.anchor = gs_record.now;
+    gs_record.read = gs_record.write + 1;
+    gs_record.read_pos = 0;
+    gs_record.write++;
+    
+    return 0;
+}
+
+/**
+ * @brief      replay a uart read
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len buffer length
+ * @return     read length
+ * @note       a recorded read is due after the same delays since its write as recorded
+ */
+uint16_t replay_read(uint8_t *buf, uint16_t len)
+{
+    uint16_t l = 0;
+    uint16_t n;
+    record_item_t *item;
+    
+    while ((l < len) && (gs_record.read < gs_record.num))
+    {
+        item = &gs_record.item[gs_record.read];
+        if (item->type == RECORD_TYPE_WRITE)
+        {
+            break;
+        }
+        if (item->type != RECORD_TYPE_READ)
+        {
+            gs_record.read++;
+            
+            continue;
+        }
+        if ((gs_record.now - gs_record.anchor) < (item->clock - gs_record.anchor_clock))
+        {
+            break;
+        }
+        n = (uint16_t)(item->len - gs_record.read_pos);
+        if (n > len - l)
+        {
+            n = (uint16_t)(len - l);
+        }
+        memcpy(&buf[l], &gs_record.data[item->offset + gs_record.read_pos], n);
+        l = (uint16_t)(l + n);
+        gs_record.read_pos = (uint16_t)(gs_record.read_pos + n);
+        if (gs_record.read_pos >= item->len)
+        {
+            gs_record.read++;
+            gs_record.read_pos = 0;
+        }
+    }
+    gs_record.read_bytes += l;
+    
+    return l;
+}
+
+/**
+ * @brief  replay a uart flush
+ * @return status code
+ *         - 0 success
+ * @note   the due reads are dropped
+ */
+uint8_t replay_flush(void)
+{
+    uint8_t buf[32];
+    uint32_t bytes;
+    
+    bytes = gs_record.read_bytes;
+    while (replay_read(buf, sizeof(buf)) != 0)
+    {
+        
+    }
+    gs_record.read_bytes = bytes;
+    
+    return 0;
+}
+
+/**
+ * @brief     replay a delay
+ * @param[in] ms time in ms
+ * @note      the replay clock advances by ms and sleeps ms divided by the speed
+ */
+void replay_delay_ms(uint32_t ms)
+{
+    gs_record.now += ms;
+    if (gs_record.speed != 0)
+    {
+        (void)usleep(1000 * ms / gs_record.speed);
+    }
+}
+
+/**
+ * @brief  get the replay clock
+ * @return replay time in ms
+ * @note   none
+ */
+uint32_t replay_timestamp_ms(void)
+{
+    return gs_record.now;
+}
@@ -37,11 +37,153 @@
 
 #include "driver_syn6288_basic.h"
 #include "driver_syn6288_advance.h"
+#include "driver_syn6288_stream.h"
 #include "driver_syn6288_register_test.h"
 #include "driver_syn6288_synthesis_test.h"
+#include "driver_syn6288_queue_test.h"
+#include "driver_syn6288_perf_test.h"
+#include "driver_syn6288_queue.h"
 #include <getopt.h>
 #include <ctype.h>
+#include <stdlib.h>
 #include <string.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief     stream a file or stdin
+ * @param[in] *path pointer to a file path, NULL or "-" reads stdin
+ * @param[in] encoding input encoding
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the file is memory mapped, stdin is read in chunks and the queue is processed while it waits
+ */
+static uint8_t a_syn6288_stream(const char *path, syn6288_stream_encoding_t encoding)
+{
+    uint8_t res;
+    uint32_t i;
+    syn6288_stream_stats_t stats;
+    syn6288_stream_segment_t seg;
+    
+    /* stream init */
+    res = syn6288_stream_init(encoding);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    if ((path != NULL) && (strcmp(path, "-") != 0))
+    {
+        int fd;
+        struct stat st;
+        uint8_t *buf;
+        
+        /* map the file */
+        fd = open(path, O_RDONLY);
+        if (fd < 0)
+        {
+            syn6288_interface_debug_print("syn6288: open %s failed.\n", path);
+            (void)syn6288_stream_deinit();
+            
+            return 1;
+        }
+        if (fstat(fd, &st) != 0)
+        {
+            syn6288_interface_debug_print("syn6288: stat %s failed.\n", path);
+            (void)close(fd);
+            (void)syn6288_stream_deinit();
+            
+            return 1;
+        }
+        if (st.st_size > 0)
+        {
+            buf = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (buf == MAP_FAILED)
+            {
+                syn6288_interface_debug_print("syn6288: mmap %s failed.\n", path);
+                (void)close(fd);
+                (void)syn6288_stream_deinit();
+                
+                return 1;
+            }
+            (void)madvise(buf, (size_t)st.st_size, MADV_SEQUENTIAL);
+            res = syn6288_stream_write(buf, (uint32_t)st.st_size);
+            (void)munmap(buf, (size_t)st.st_size);
+        }
+        (void)close(fd);
+    }
+    else
+    {
+        uint8_t buf[4096];
+        struct pollfd pfd;
+        ssize_t l;
+        
+        /* read stdin and keep playing while it waits */
+        pfd.fd = STDIN_FILENO;
+        pfd.events = POLLIN;
+        while (1)
+        {
+            if (poll(&pfd, 1, 50) <= 0)
+            {
+                res = syn6288_stream_process();
+                if (res != 0)
+                {
+                    break;
+                }
+                
+                continue;
+            }
+            l = read(STDIN_FILENO, buf, sizeof(buf));
+            if (l <= 0)
+            {
+                break;
+            }
+            res = syn6288_stream_write(buf, (uint32_t)l);
+            if (res != 0)
+            {
+                break;
+            }
+        }
+    }
+    
+    /* play the rest */
+    if (res == 0)
+    {
+        res = syn6288_stream_flush();
+    }
+    
+    /* print the segments */
+    (void)syn6288_stream_get_stats(&stats);
+    for (i = 0; syn6288_stream_get_segment(i, &seg) == 0; i++)
+    {
+        if (seg.status == SYN6288_STREAM_SEGMENT_DONE)
+        {
+            syn6288_interface_debug_print("syn6288: segment %d len %d estimate %dms wait %dms play %dms.\n",
+                                          i + 1, seg.len, seg.estimate, seg.start - seg.push, seg.done - seg.start);
+        }
+        else if (seg.status == SYN6288_STREAM_SEGMENT_DROPPED)
+        {
+            syn6288_interface_debug_print("syn6288: segment %d len %d dropped.\n", i + 1, seg.len);
+        }
+        else
+        {
+            syn6288_interface_debug_print("syn6288: segment %d len %d not played.\n", i + 1, seg.len);
+        }
+    }
+    syn6288_interface_debug_print("syn6288: stream segments %d, bytes %d, frames %d, done %d, dropped %d, skipped %d.\n",
+                                  stats.segments, stats.bytes, stats.frames, stats.done, stats.dropped, stats.skipped);
+    syn6288_interface_debug_print("syn6288: stream time %dms, wait avg %dms max %dms, gap avg %dms max %dms.\n",
+                                  stats.time, stats.wait_avg, stats.wait_max, stats.gap_avg, stats.gap_max);
+    
+    /* stream deinit */
+    (void)syn6288_stream_deinit();
+    
+    return (res != 0) ? 1 : 0;
+}
 
 /**
  * @brief     syn6288 full function
@@ -69,6 +211,9 @@ uint8_t syn6288(uint8_t argc, char **argv)
         {"ring", required_argument, NULL, 2},
         {"sound", required_argument, NULL, 3},
         {"text", required_argument, NULL, 4},
+        {"file", required_argument, NULL, 5},
+        {"encoding", required_argument, NULL, 6},
+        {"times", required_argument, NULL, 7},
         {NULL, 0, NULL, 0},
     };
     char type[33] = "unknown";
@@ -80,6 +225,9 @@ uint8_t syn6288(uint8_t argc, char **argv)
     syn6288_message_t msg = SYN6288_MESSAGE_A;
     syn6288_ring_t ring = SYN6288_RING_A;
     char text[129] = {0};
+    char *file = NULL;
+    uint32_t times = 20;
+    syn6288_stream_encoding_t encoding = SYN6288_STREAM_ENCODING_UTF8;
     
     /* if no params */
     if (argc == 1)
@@ -191,6 +339,56 @@ uint8_t syn6288(uint8_t argc, char **argv)
                 break;
             } 
             
+            /* file */
+            case 5 :
+            {
+                /* set the file */
+                file = optarg;
+                
+                break;
+            }
+            
+            /* encoding */
+            case 6 :
+            {
+                /* set the encoding */
+                if (strcmp("gb2312", optarg) == 0)
+                {
+                    encoding = SYN6288_STREAM_ENCODING_GB2312;
+                }
+                else if (strcmp("gbk", optarg) == 0)
+                {
+                    encoding = SYN6288_STREAM_ENCODING_GBK;
+                }
+                else if (strcmp("big5", optarg) == 0)
+                {
+                    encoding = SYN6288_STREAM_ENCODING_BIG5;
+                }
+                else if (strcmp("unicode", optarg) == 0)
+                {
+                    encoding = SYN6288_STREAM_ENCODING_UNICODE;
+                }
+                else if (strcmp("utf8", optarg) == 0)
+                {
+                    encoding = SYN6288_STREAM_ENCODING_UTF8;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* times */
+            case 7 :
+            {
+                /* set the times */
+                times = (uint32_t)atol(optarg);
+                
+                break;
+            }
+            
             /* the end */
             case -1 :
             {
@@ -230,6 +428,30 @@ uint8_t syn6288(uint8_t argc, char **argv)
             return 0;
         }
     }
+    else if (strcmp("t_queue", type) == 0)
+    {
+        /* run queue test */
+        if (syn6288_queue_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+    else if (strcmp("t_perf", type) == 0)
+    {
+        /* run perf test */
+        if (syn6288_perf_test(times) != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
     else if (strcmp("e_syn", type) == 0)
     {
         uint8_t res;
@@ -268,6 +490,11 @@ uint8_t syn6288(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("e_stream", type) == 0)
+    {
+        /* run the stream */
+        return a_syn6288_stream(file, encoding);
+    }
     else if (strcmp("e_advance-syn", type) == 0)
     {
         uint8_t res;
@@ -427,24 +654,31 @@ uint8_t syn6288(uint8_t argc, char **argv)
         syn6288_interface_debug_print("  syn6288 (-p | --port)\n");
         syn6288_interface_debug_print("  syn6288 (-t reg | --test=reg)\n");
         syn6288_interface_debug_print("  syn6288 (-t syn | --test=syn)\n");
+        syn6288_interface_debug_print("  syn6288 (-t queue | --test=queue)\n");
+        syn6288_interface_debug_print("  syn6288 (-t perf | --test=perf) [--times=<num>]\n");
         syn6288_interface_debug_print("  syn6288 (-e syn | --example=syn) --text=<gb2312>\n");
         syn6288_interface_debug_print("  syn6288 (-e advance-syn | --example=advance-syn) --text=<gb2312>\n");
         syn6288_interface_debug_print("  syn6288 (-e advance-sound | --example=advance-sound) --sound=<type>\n");
         syn6288_interface_debug_print("  syn6288 (-e advance-msg | --example=advance-msg) --msg=<type>\n");
         syn6288_interface_debug_print("  syn6288 (-e advance-ring | --example=advance-ring) --ring=<type>\n");
+        syn6288_interface_debug_print("  syn6288 (-e stream | --example=stream) [--file=<path>] [--encoding=<utf8 | gb2312 | gbk | big5 | unicode>]\n");
         syn6288_interface_debug_print("\n");
         syn6288_interface_debug_print("Options:\n");
-        syn6288_interface_debug_print("  -e <syn | advance-syn | advance-sound | advance-msg | advance-ring>, --example=<syn\n");
-        syn6288_interface_debug_print("     | advance-syn | advance-sound | advance-msg | advance-ring>\n");
+        syn6288_interface_debug_print("  -e <syn | advance-syn | advance-sound | advance-msg | advance-ring | stream>, --example=<syn\n");
+        syn6288_interface_debug_print("     | advance-syn | advance-sound | advance-msg | advance-ring | stream>\n");
         syn6288_interface_debug_print("                          Run the driver example.\n");
+        syn6288_interface_debug_print("      --encoding=<utf8 | gb2312 | gbk | big5 | unicode>\n");
+        syn6288_interface_debug_print("                          Set the stream encoding, utf8 is sent as unicode and the default is utf8.\n");
+        syn6288_interface_debug_print("      --file=<path>       Set the stream file, it's memory mapped and the default is stdin.\n");
         syn6288_interface_debug_print("  -h, --help              Show the help.\n");
         syn6288_interface_debug_print("  -i, --information       Show the chip information.\n");
         syn6288_interface_debug_print("      --msg=<type>        Set the synthesis message and type can be \"A\" - \"H\".\n");
         syn6288_interface_debug_print("  -p, --port              Display the pin connections of the current board.\n");
         syn6288_interface_debug_print("      --ring=<type>       Set the synthesis ring and type can be \"A\" - \"O\".\n");
         syn6288_interface_debug_print("      --sound=<type>      Set the synthesis sound and type can be \"A\" - \"Y\".\n");
-        syn6288_interface_debug_print("  -t <reg | syn>, --test=<reg | syn>\n");
+        syn6288_interface_debug_print("  -t <reg | syn | queue | perf>, --test=<reg | syn | queue | perf>\n");
         syn6288_interface_debug_print("                          Run the driver test.\n");
+        syn6288_interface_debug_print("      --times=<num>       Set the sample number of each perf latency and the default is 20.\n");
         syn6288_interface_debug_print("      --text=<gb2312>     Set the synthesis text and it's format is GB2312.\n");
         
         return 0;
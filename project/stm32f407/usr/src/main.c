@@ -38,6 +38,8 @@
 #include "driver_syn6288_advance.h"
 #include "driver_syn6288_register_test.h"
 #include "driver_syn6288_synthesis_test.h"
+#include "driver_syn6288_queue_test.h"
+#include "driver_syn6288_queue.h"
 #include "shell.h"
 #include "clock.h"
 #include "delay.h"
@@ -239,6 +241,18 @@ uint8_t syn6288(uint8_t argc, char **argv)
             return 0;
         }
     }
+    else if (strcmp("t_queue", type) == 0)
+    {
+        /* run queue test */
+        if (syn6288_queue_test() != 0)
+        {
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
     else if (strcmp("e_syn", type) == 0)
     {
         uint8_t res;
@@ -436,6 +450,7 @@ uint8_t syn6288(uint8_t argc, char **argv)
         syn6288_interface_debug_print("  syn6288 (-p | --port)\n");
         syn6288_interface_debug_print("  syn6288 (-t reg | --test=reg)\n");
         syn6288_interface_debug_print("  syn6288 (-t syn | --test=syn)\n");
+        syn6288_interface_debug_print("  syn6288 (-t queue | --test=queue)\n");
         syn6288_interface_debug_print("  syn6288 (-e syn | --example=syn) --text=<gb2312>\n");
         syn6288_interface_debug_print("  syn6288 (-e advance-syn | --example=advance-syn) --text=<gb2312>\n");
         syn6288_interface_debug_print("  syn6288 (-e advance-sound | --example=advance-sound) --sound=<type>\n");
@@ -452,7 +467,7 @@ uint8_t syn6288(uint8_t argc, char **argv)
         syn6288_interface_debug_print("  -p, --port              Display the pin connections of the current board.\n");
         syn6288_interface_debug_print("      --ring=<type>       Set the synthesis ring and type can be \"A\" - \"O\".\n");
         syn6288_interface_debug_print("      --sound=<type>      Set the synthesis sound and type can be \"A\" - \"Y\".\n");
-        syn6288_interface_debug_print("  -t <reg | syn>, --test=<reg | syn>\n");
+        syn6288_interface_debug_print("  -t <reg | syn | queue>, --test=<reg | syn | queue>\n");
         syn6288_interface_debug_print("                          Run the driver test.\n");
         syn6288_interface_debug_print("      --text=<gb2312>     Set the synthesis text and it's format is GB2312.\n");
         
@@ -36,6 +36,8 @@
  */
 
 #include "driver_syn6288.h"
+#include "driver_syn6288_log.h"
+#include "driver_syn6288_trace.h"
 
 /**
  * @brief chip information definition
@@ -49,6 +51,427 @@
 #define TEMPERATURE_MAX           85.0f                        /**< chip max operating temperature */
 #define DRIVER_VERSION            2000                         /**< driver version */
 
+/**
+ * @brief chip frame definition
+ */
+#define SYN6288_TEXT_MAX_LEN      200        /**< max text length of one frame */
+#define SYN6288_ACK_TIMEOUT       100        /**< max ack wait time in ms */
+#define SYN6288_WAKE_RETRY        5          /**< max wake up frames */
+#define SYN6288_IDLE_RETRY        600        /**< max status polls while waiting idle */
+#define SYN6288_IDLE_INTERVAL     100        /**< status poll interval in ms */
+
+/**
+ * @brief     get the histogram bucket of a time
+ * @param[in] ms time in ms
+ * @return    bucket index
+ * @note      none
+ */
+static uint8_t a_syn6288_stats_bucket(uint32_t ms)
+{
+    uint8_t i;
+    
+    i = 0;                                                                /* init 0 */
+    while ((ms != 0) && (i < (SYN6288_STATS_BUCKET_NUM - 1)))             /* log2 scale */
+    {
+        ms >>= 1;                                                         /* ms /= 2 */
+        i++;                                                              /* i++ */
+    }
+    
+    return i;                                                             /* return the bucket */
+}
+
+/**
+ * @brief     count a written frame
+ * @param[in] *handle pointer to a syn6288 handle structure
+ * @param[in] opcode frame opcode
+ * @param[in] len frame length
+ * @note      none
+ */
+static void a_syn6288_stats_write(syn6288_handle_t *handle, uint8_t opcode, uint16_t len)
+{
+    handle->stats.opcode[opcode].frames++;                                /* frames++ */
+    handle->stats.opcode[opcode].bytes += len;                            /* add the bytes */
+    if (handle->timestamp_ms != NULL)                                     /* check timestamp_ms */
+    {
+        handle->write_timestamp = handle->timestamp_ms();                 /* save the write time */
+    }
+    SYN6288_TRACE_WRITE(opcode, len);                                     /* trace the write */
+}
+
+/**
+ * @brief     count an answer
+ * @param[in] *handle pointer to a syn6288 handle structure
+ * @param[in] opcode frame opcode
+ * @param[in] res 0 ack, 1 wrong answer, 2 no answer
+ * @note      an acked text frame starts the playback,
+ *            the histograms are skipped without timestamp_ms
+ */
+static void a_syn6288_stats_ack(syn6288_handle_t *handle, uint8_t opcode, uint8_t res)
+{
+    uint8_t b;
+    uint32_t now;
+    
+    now = (handle->timestamp_ms != NULL) ? handle->timestamp_ms() : handle->write_timestamp; /* get the time */
+    SYN6288_TRACE_ACK(opcode, res, now - handle->write_timestamp);        /* trace the answer */
+    if (res == 1)                                                         /* wrong answer */
+    {
+        handle->stats.opcode[opcode].naks++;                              /* naks++ */
+        
+        return;                                                           /* return */
+    }
+    if (res == 2)                                                         /* no answer */
+    {
+        handle->stats.opcode[opcode].timeouts++;                          /* timeouts++ */
+        
+        return;                                                           /* return */
+    }
+    b = a_syn6288_stats_bucket(now - handle->write_timestamp);            /* get the bucket */
+    if (handle->timestamp_ms != NULL)                                     /* check timestamp_ms */
+    {
+        handle->stats.ack_latency[b]++;                                   /* count the latency */
+    }
+    if (opcode == SYN6288_OPCODE_SYNTHESIS)                               /* text frame */
+    {
+        if (handle->timestamp_ms != NULL)                                 /* check timestamp_ms */
+        {
+            handle->stats.first_audio[b]++;                               /* count the first audio */
+            handle->stats.first_audio_last = now - handle->write_timestamp;    /* save the first audio */
+        }
+        handle->play_timestamp = now;                                     /* playback starts */
+        handle->playing = 1;                                              /* set playing */
+        SYN6288_TRACE_STATUS(1);                                          /* trace the transition */
+    }
+    else if ((opcode == SYN6288_OPCODE_STOP) || (opcode == SYN6288_OPCODE_POWER_DOWN))
+    {
+        if (handle->playing != 0)                                         /* playing */
+        {
+            SYN6288_TRACE_STATUS(0);                                      /* trace the transition */
+        }
+        handle->playing = 0;                                              /* playback is cut */
+    }
+    else
+    {
+        
+    }
+}
+
+/**
+ * @brief     count the finished playback
+ * @param[in] *handle pointer to a syn6288 handle structure
+ * @note      called when the chip is found idle
+ */
+static void a_syn6288_stats_idle(syn6288_handle_t *handle)
+{
+    if (handle->playing != 0)                                             /* playing */
+    {
+        if (handle->timestamp_ms != NULL)                                 /* check timestamp_ms */
+        {
+            handle->stats.playback[a_syn6288_stats_bucket(handle->timestamp_ms() -
+                                   handle->play_timestamp)]++;            /* count the playback */
+        }
+        handle->playing = 0;                                              /* clear playing */
+        SYN6288_TRACE_STATUS(0);                                          /* trace the transition */
+    }
+}
+
+/**
+ * @brief     get the answer timeout of a written frame
+ * @param[in] *handle pointer to a syn6288 handle structure
+ * @param[in] frame written frame length
+ * @return    timeout in ms
+ * @note      the chip answers after the last byte, so the wire time of the frame is added,
+ *            one byte is 10 bits on the wire
+ */
+static uint16_t a_syn6288_ack_timeout(syn6288_handle_t *handle, uint16_t frame)
+{
+    uint32_t baud;
+    
+    baud = (handle->rate <= SYN6288_BAUD_RATE_38400_BPS) ? (9600UL << handle->rate) : 9600UL;    /* get the baud rate */
+    
+    return (uint16_t)(SYN6288_ACK_TIMEOUT + ((uint32_t)frame * 10000UL + baud - 1) / baud);     /* add the wire time */
+}
+
+/**
+ * @brief      read an answer
+ * @param[in]  *handle pointer to a syn6288 handle structure
+ * @param[out] *buf pointer to an answer buffer
+ * @param[in]  len answer length
+ * @param[in]  frame written frame length
+ * @return     read length
+ * @note       the uart is polled every 1 ms until the frame is on the wire and SYN6288_ACK_TIMEOUT
+ *             more ms elapse, so the read ends as soon as the answer arrives
+ */
+static uint16_t a_syn6288_read_answer(syn6288_handle_t *handle, uint8_t *buf, uint16_t len, uint16_t frame)
+{
+    uint16_t got;
+    uint16_t timeout;
+    
+    got = 0;                                                              /* init 0 */
+    timeout = a_syn6288_ack_timeout(handle, frame);                       /* set the timeout */
+    while (1)                                                             /* poll the answer */
+    {
+        got = (uint16_t)(got + handle->uart_read(&buf[got], (uint16_t)(len - got)));    /* uart read */
+        if ((got >= len) || (timeout == 0))                               /* check the answer */
+        {
+            break;                                                        /* break */
+        }
+        handle->delay_ms(1);                                              /* delay 1 ms */
+        timeout--;                                                        /* timeout-- */
+    }
+    
+    return got;                                                           /* return the length */
+}
+
+/**
+ * @brief     wait for the command acks
+ * @param[in] *handle pointer to a syn6288 handle structure
+ * @param[in] opcode frame opcode
+ * @param[in] num ack number
+ * @param[in] frame written frame length
+ * @return    status code
+ *            - 0 success
+ *            - 1 wait ack failed
+ *            - 2 timeout
+ * @note      the uart is polled every 1 ms, so the wait ends as soon as the acks arrive
+ */
+static uint8_t a_syn6288_wait_ack(syn6288_handle_t *handle, uint8_t opcode, uint8_t num, uint16_t frame)
+{
+    uint8_t i;
+    uint8_t temp[4];
+    
+    SYN6288_TRACE_ACK_WAIT(num);                                          /* trace the wait */
+    if (a_syn6288_read_answer(handle, temp, num, frame) != num)           /* read the acks */
+    {
+        return 2;                                                         /* return error */
+    }
+    for (i = 0; i < num; i++)
+    {
+        if (temp[i] != 0x41)                                              /* check return */
+        {
+            SYN6288_LOG_ERROR(handle, SYN6288_EVENT_RECEIVE_FAILED, opcode, temp[i], "syn6288: command receive failed.\n"); /* command receive failed */
+            
+            return 1;                                                     /* return error */
+        }
+    }
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief     write the stop frame and the text frame stored in the handle buffer
+ * @param[in] *handle pointer to a syn6288 handle structure
+ * @param[in] len text length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write frames failed
+ * @note      the text must be stored from handle->buf[10]
+ */
+static uint8_t a_syn6288_write_barge_in(syn6288_handle_t *handle, uint16_t len)
+{
+    uint8_t res;
+    uint8_t xor_cal = 0;
+    
+    handle->buf[0] = 0xFD;                                                /* frame header */
+    handle->buf[1] = 0x00;                                                /* length msb */
+    handle->buf[2] = 0x02;                                                /* length lsb */
+    handle->buf[3] = 0x02;                                                /* stop command */
+    handle->buf[4] = 0xFD;                                                /* xor */
+    handle->buf[5] = 0xFD;                                                /* frame header */
+    handle->buf[6] = (uint8_t)((len + 3) / 256);                          /* length msb */
+    handle->buf[7] = (uint8_t)((len + 3) % 256);                          /* length lsb */
+    handle->buf[8] = 0x01;                                                /* command */
+    handle->buf[9] = handle->mode | handle->type;                         /* command param */
+    (void)syn6288_frame_xor((uint8_t *)&handle->buf[5], len + 5, &xor_cal); /* calculate xor */
+    handle->buf[len + 10] = xor_cal;                                      /* set xor */
+    SYN6288_TRACE_FRAME(SYN6288_OPCODE_STOP, handle->buf, 5);             /* trace the stop frame */
+    SYN6288_TRACE_FRAME(SYN6288_OPCODE_SYNTHESIS, &handle->buf[5], len + 6); /* trace the text frame */
+    res = handle->uart_flush();                                           /* uart flush */
+    if (res != 0)                                                         /* check result */
+    {
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_FLUSH_FAILED, SYN6288_OPCODE_SYNTHESIS, 0, "syn6288: uart flush failed.\n"); /* uart flush failed */
+        
+        return 1;                                                         /* return error */
+    }
+    res = handle->uart_write((uint8_t *)handle->buf, len + 11);           /* write both frames */
+    if (res != 0)                                                         /* check result */
+    {
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_WRITE_FAILED, SYN6288_OPCODE_SYNTHESIS, len + 11, "syn6288: uart write failed.\n"); /* uart write failed */
+        
+        return 1;                                                         /* return error */
+    }
+    a_syn6288_stats_write(handle, SYN6288_OPCODE_STOP, 5);                /* count the stop frame */
+    a_syn6288_stats_write(handle, SYN6288_OPCODE_SYNTHESIS, len + 6);     /* count the text frame */
+    res = a_syn6288_wait_ack(handle, SYN6288_OPCODE_SYNTHESIS, 2, len + 11);    /* wait both acks */
+    a_syn6288_stats_ack(handle, SYN6288_OPCODE_STOP, res);                /* count the stop answer */
+    a_syn6288_stats_ack(handle, SYN6288_OPCODE_SYNTHESIS, res);           /* count the text answer */
+    if (res == 2)                                                         /* check timeout */
+    {
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_READ_FAILED, SYN6288_OPCODE_SYNTHESIS, 0, "syn6288: uart read failed.\n"); /* uart read failed */
+        
+        return 1;                                                         /* return error */
+    }
+    
+    return res;                                                           /* return the result */
+}
+
+/**
+ * @brief     write the text frame stored in the handle buffer
+ * @param[in] *handle pointer to a syn6288 handle structure
+ * @param[in] param command param
+ * @param[in] len text length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write frame failed
+ * @note      the text must be stored from handle->buf[5]
+ */
+static uint8_t a_syn6288_write_text_frame(syn6288_handle_t *handle, uint8_t param, uint16_t len)
+{
+    uint8_t res;
+    uint8_t temp;
+    uint16_t l;
+    uint8_t xor_cal = 0;
+    
+    handle->buf[0] = 0xFD;                                                /* frame header */
+    handle->buf[1] = (uint8_t)((len + 3) / 256);                          /* length msb */
+    handle->buf[2] = (uint8_t)((len + 3) % 256);                          /* length lsb */
+    handle->buf[3] = 0x01;                                                /* command */
+    handle->buf[4] = param;                                               /* command param */
+    (void)syn6288_frame_xor((uint8_t *)handle->buf, len + 5, &xor_cal);   /* calculate xor */
+    handle->buf[len + 5] = xor_cal;                                       /* set xor */
+    SYN6288_TRACE_FRAME(SYN6288_OPCODE_SYNTHESIS, handle->buf, len + 6);  /* trace the frame */
+    res = handle->uart_flush();                                           /* uart flush */
+    if (res != 0)                                                         /* check result */
+    {
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_FLUSH_FAILED, SYN6288_OPCODE_SYNTHESIS, 0, "syn6288: uart flush failed.\n"); /* uart flush failed */
+        
+        return 1;                                                         /* return error */
+    }
+    res = handle->uart_write((uint8_t *)handle->buf, len + 6);            /* uart write */
+    if (res != 0)                                                         /* check result */
+    {
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_WRITE_FAILED, SYN6288_OPCODE_SYNTHESIS, len + 6, "syn6288: uart write failed.\n"); /* uart write failed */
+        
+        return 1;                                                         /* return error */
+    }
+    a_syn6288_stats_write(handle, SYN6288_OPCODE_SYNTHESIS, len + 6);     /* count the frame */
+    l = a_syn6288_read_answer(handle, &temp, 1, len + 6);                 /* read the answer */
+    if (l != 1)                                                           /* check result */
+    {
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_SYNTHESIS, 2);         /* count the answer */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_READ_FAILED, SYN6288_OPCODE_SYNTHESIS, l, "syn6288: uart read failed.\n"); /* uart read failed */
+        
+        return 1;                                                         /* return error */
+    }
+    if (temp != 0x41)                                                     /* check return */
+    {
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_SYNTHESIS, 1);         /* count the answer */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_RECEIVE_FAILED, SYN6288_OPCODE_SYNTHESIS, temp, "syn6288: command receive failed.\n"); /* command receive failed */
+        
+        return 1;                                                         /* return error */
+    }
+    a_syn6288_stats_ack(handle, SYN6288_OPCODE_SYNTHESIS, 0);             /* count the answer */
+    
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief      encode a prompt tone item as the text type
+ * @param[in]  type text type
+ * @param[in]  *item pointer to a sequence item structure
+ * @param[out] *buf pointer to a token buffer
+ * @return     token length, 0 means the item is invalid
+ * @note       the token buffer must hold at least 12 bytes
+ */
+static uint16_t a_syn6288_encode_token(uint8_t type, syn6288_sequence_item_t *item, uint8_t *buf)
+{
+    const char *name;
+    uint8_t last;
+    uint16_t len;
+    uint16_t i;
+    
+    switch (item->type)                                                   /* check item type */
+    {
+        case SYN6288_SEQUENCE_TYPE_SOUND :                                /* sound */
+        {
+            name = "sound";                                               /* set name */
+            last = (uint8_t)SYN6288_SOUND_Y;                              /* set last index */
+            
+            break;                                                        /* break */
+        }
+        case SYN6288_SEQUENCE_TYPE_MESSAGE :                              /* message */
+        {
+            name = "msg";                                                 /* set name */
+            last = (uint8_t)SYN6288_MESSAGE_H;                            /* set last index */
+            
+            break;                                                        /* break */
+        }
+        case SYN6288_SEQUENCE_TYPE_RING :                                 /* ring */
+        {
+            name = "ring";                                                /* set name */
+            last = (uint8_t)SYN6288_RING_O;                               /* set last index */
+            
+            break;                                                        /* break */
+        }
+        default :
+        {
+            return 0;                                                     /* invalid item */
+        }
+    }
+    if ((item->index < 'a') || (item->index > last))                      /* check index */
+    {
+        return 0;                                                         /* invalid item */
+    }
+    len = (uint16_t)strlen(name);                                         /* get name length */
+    for (i = 0; i < len + 1; i++)
+    {
+        uint8_t c;
+        
+        c = (i < len) ? (uint8_t)name[i] : item->index;                   /* get the char */
+        if (type == SYN6288_TYPE_UNICODE)                                 /* unicode is 2 bytes big endian */
+        {
+            buf[i * 2 + 0] = 0x00;                                        /* set msb */
+            buf[i * 2 + 1] = c;                                           /* set lsb */
+        }
+        else
+        {
+            buf[i] = c;                                                   /* set the char */
+        }
+    }
+    
+    return (type == SYN6288_TYPE_UNICODE) ? (uint16_t)((len + 1) * 2) : (uint16_t)(len + 1);
+}
+
+/**
+ * @brief     wait until the chip is idle
+ * @param[in] *handle pointer to a syn6288 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 wait idle failed
+ * @note      the chip is polled at most SYN6288_IDLE_RETRY times
+ */
+static uint8_t a_syn6288_wait_idle(syn6288_handle_t *handle)
+{
+    uint16_t i;
+    syn6288_status_t status;
+    
+    for (i = 0; i < SYN6288_IDLE_RETRY; i++)                              /* poll the status */
+    {
+        if (syn6288_get_status(handle, &status) != 0)                     /* get status */
+        {
+            return 1;                                                     /* return error */
+        }
+        if (status == SYN6288_STATUS_OK)                                  /* check idle */
+        {
+            return 0;                                                     /* success return 0 */
+        }
+        handle->delay_ms(SYN6288_IDLE_INTERVAL);                          /* delay the interval */
+    }
+    SYN6288_LOG_ERROR(handle, SYN6288_EVENT_IDLE_TIMEOUT, SYN6288_OPCODE_STATUS, i, "syn6288: wait idle timeout.\n"); /* wait idle timeout */
+    
+    return 1;                                                             /* return error */
+}
+
 /**
  * @brief     initialize the chip
  * @param[in] *handle pointer to a syn6288 handle structure
@@ -65,50 +488,46 @@ uint8_t syn6288_init(syn6288_handle_t *handle)
     {
         return 2;                                                      /* return error */
     }
-    if (handle->debug_print == NULL)                                   /* check debug_print */
-    {
-        return 3;                                                      /* return error */
-    }
     if (handle->uart_init == NULL)                                     /* check uart_init */
     {
-        handle->debug_print("syn6288: uart_init is null.\n");          /* uart_init is null */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_LINK_NULL, SYN6288_OPCODE_NUM, SYN6288_LINK_UART_INIT, "syn6288: uart_init is null.\n"); /* uart_init is null */
         
         return 3;                                                      /* return error */
     }
     if (handle->uart_deinit == NULL)                                   /* check uart_deinit */
     {
-        handle->debug_print("syn6288: uart_deinit is null.\n");        /* uart_deinit is null */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_LINK_NULL, SYN6288_OPCODE_NUM, SYN6288_LINK_UART_DEINIT, "syn6288: uart_deinit is null.\n"); /* uart_deinit is null */
         
         return 3;                                                      /* return error */
     }
     if (handle->uart_read == NULL)                                     /* check uart_read */
     {
-        handle->debug_print("syn6288: uart_read is null.\n");          /* uart_read is null */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_LINK_NULL, SYN6288_OPCODE_NUM, SYN6288_LINK_UART_READ, "syn6288: uart_read is null.\n"); /* uart_read is null */
         
         return 3;                                                      /* return error */
     }
     if (handle->uart_write == NULL)                                    /* check uart_write */
     {
-        handle->debug_print("syn6288: uart_write is null.\n");         /* uart_write is null */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_LINK_NULL, SYN6288_OPCODE_NUM, SYN6288_LINK_UART_WRITE, "syn6288: uart_write is null.\n"); /* uart_write is null */
         
         return 3;                                                      /* return error */
     } 
     if (handle->uart_flush == NULL)                                    /* check uart_flush */
     {
-        handle->debug_print("syn6288: uart_flush is null.\n");         /* uart_flush is null */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_LINK_NULL, SYN6288_OPCODE_NUM, SYN6288_LINK_UART_FLUSH, "syn6288: uart_flush is null.\n"); /* uart_flush is null */
         
         return 3;                                                      /* return error */
     }
     if (handle->delay_ms == NULL)                                      /* check delay_ms */
     {
-        handle->debug_print("syn6288: delay_ms is null.\n");           /* delay_ms is null */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_LINK_NULL, SYN6288_OPCODE_NUM, SYN6288_LINK_DELAY_MS, "syn6288: delay_ms is null.\n"); /* delay_ms is null */
         
         return 3;                                                      /* return error */
     }
 
     if (handle->uart_init() != 0)                                      /* uart init */
     {
-        handle->debug_print("syn6288: uart init failed.\n");           /* uart init failed */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_INIT_FAILED, SYN6288_OPCODE_NUM, 0, "syn6288: uart init failed.\n"); /* uart init failed */
         
         return 1;                                                      /* return error */
     }
@@ -140,7 +559,7 @@ uint8_t syn6288_deinit(syn6288_handle_t *handle)
     
     if (handle->uart_deinit() != 0)                                   /* uart deinit */
     {
-        handle->debug_print("syn6288: uart deinit failed.\n");        /* uart deinit failed */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_DEINIT_FAILED, SYN6288_OPCODE_NUM, 0, "syn6288: uart deinit failed.\n"); /* uart deinit failed */
         
         return 1;                                                     /* return error */
     }         
@@ -184,38 +603,44 @@ uint8_t syn6288_get_status(syn6288_handle_t *handle, syn6288_status_t *status)
     cmd[4] = 0xDE;                                                            /* xor */
     while (1)                                                                 /* loop */
     {
+        SYN6288_TRACE_FRAME(SYN6288_OPCODE_STATUS, cmd, 5);                   /* trace the frame */
         res = handle->uart_flush();                                           /* uart flush */
         if (res != 0)                                                         /* check result */
         {
-            handle->debug_print("syn6288: uart flush failed.\n");             /* uart flush failed */
+            SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_FLUSH_FAILED, SYN6288_OPCODE_STATUS, 0, "syn6288: uart flush failed.\n"); /* uart flush failed */
             
             return 1;                                                         /* return error */
         }
         res = handle->uart_write((uint8_t *)cmd, 5);                          /* uart write */
         if (res != 0)                                                         /* check result */
         {
-            handle->debug_print("syn6288: uart write failed.\n");             /* uart write failed */
+            SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_WRITE_FAILED, SYN6288_OPCODE_STATUS, 5, "syn6288: uart write failed.\n"); /* uart write failed */
             
             return 1;                                                         /* return error */
         }
-        handle->delay_ms(100);                                                /* delay 100 ms */
+        a_syn6288_stats_write(handle, SYN6288_OPCODE_STATUS, 5);              /* count the frame */
         memset(temp, 0, sizeof(uint8_t) * 2);                                 /* clear the buffer */
-        len = handle->uart_read((uint8_t *)temp, 2);                          /* uart read */
+        len = a_syn6288_read_answer(handle, temp, 2, 5);                      /* read the answer */
         if (len != 2)                                                         /* check result */
         {
-            handle->debug_print("syn6288: uart read failed.\n");              /* uart read failed */
+            a_syn6288_stats_ack(handle, SYN6288_OPCODE_STATUS, 2);            /* count the answer */
+            SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_READ_FAILED, SYN6288_OPCODE_STATUS, len, "syn6288: uart read failed.\n"); /* uart read failed */
             
             return 1;                                                         /* return error */
         }
         if ((temp[0] == 0x41) && (temp[1] == 0x4F))                           /* check frame */
         {
             *status = (syn6288_status_t)(0);                                  /* set status */
+            a_syn6288_stats_ack(handle, SYN6288_OPCODE_STATUS, 0);            /* count the answer */
+            a_syn6288_stats_idle(handle);                                     /* count the playback */
             
             return 0;                                                         /* success return 0 */
         }
         else if ((temp[0] == 0x41) && (temp[1] == 0x4E))                      /* check frame */
         {
             *status = (syn6288_status_t)(1);                                  /* set status */
+            a_syn6288_stats_ack(handle, SYN6288_OPCODE_STATUS, 0);            /* count the answer */
+            
             
             return 0;                                                         /* success return 0 */
         }
@@ -224,11 +649,13 @@ uint8_t syn6288_get_status(syn6288_handle_t *handle, syn6288_status_t *status)
             if (times != 0)                                                   /* check times */
             {
                 times--;                                                      /* retry times-- */
+                handle->stats.opcode[SYN6288_OPCODE_STATUS].retries++;        /* retries++ */
                 handle->delay_ms(100);                                        /* delay 100 ms */
                 
                 continue;                                                     /* continue */
             }
-            handle->debug_print("syn6288: command receive failed.\n");        /* command receive failed */
+            a_syn6288_stats_ack(handle, SYN6288_OPCODE_STATUS, 1);            /* count the answer */
+            SYN6288_LOG_ERROR(handle, SYN6288_EVENT_RECEIVE_FAILED, SYN6288_OPCODE_STATUS, temp[1], "syn6288: command receive failed.\n"); /* command receive failed */
             
             return 1;                                                         /* return error */
         }
@@ -266,40 +693,81 @@ uint8_t syn6288_stop(syn6288_handle_t *handle)
     cmd[2] = 0x02;                                                         /* length lsb */
     cmd[3] = 0x02;                                                         /* command */
     cmd[4] = 0xFD;                                                         /* xor */
+    SYN6288_TRACE_FRAME(SYN6288_OPCODE_STOP, cmd, 5);                      /* trace the frame */
     res = handle->uart_flush();                                            /* uart flush */
     if (res != 0)                                                          /* check result */
     {
-        handle->debug_print("syn6288: uart flush failed.\n");              /* uart flush failed */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_FLUSH_FAILED, SYN6288_OPCODE_STOP, 0, "syn6288: uart flush failed.\n"); /* uart flush failed */
         
         return 1;                                                          /* return error */
     }
     res = handle->uart_write((uint8_t *)cmd, 5);                           /* uart write */
     if (res != 0)                                                          /* check result */
     {
-        handle->debug_print("syn6288: uart write failed.\n");              /* uart write failed */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_WRITE_FAILED, SYN6288_OPCODE_STOP, 5, "syn6288: uart write failed.\n"); /* uart write failed */
         
         return 1;                                                          /* return error */
     }
-    handle->delay_ms(100);                                                 /* delay 100 ms */
-    len = handle->uart_read((uint8_t *)&temp, 1);                          /* uart read */
+    a_syn6288_stats_write(handle, SYN6288_OPCODE_STOP, 5);                 /* count the frame */
+    len = a_syn6288_read_answer(handle, &temp, 1, 5);                      /* read the answer */
     if (len != 1)                                                          /* check result */
     {
-        handle->debug_print("syn6288: uart read failed.\n");               /* uart read failed */
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_STOP, 2);               /* count the answer */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_READ_FAILED, SYN6288_OPCODE_STOP, len, "syn6288: uart read failed.\n"); /* uart read failed */
         
         return 1;                                                          /* return error */
     }
     if (temp == 0x41)                                                      /* check return */
     {
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_STOP, 0);               /* count the answer */
+        
         return 0;                                                          /* success return 0 */
     }
     else
     {
-        handle->debug_print("syn6288: command receive failed.\n");         /* command receive failed */
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_STOP, 1);               /* count the answer */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_RECEIVE_FAILED, SYN6288_OPCODE_STOP, temp, "syn6288: command receive failed.\n"); /* command receive failed */
         
         return 1;                                                          /* return error */
     }
 }
 
+/**
+ * @brief     stop the playing text and synthesis a new text
+ * @param[in] *handle pointer to a syn6288 handle structure
+ * @param[in] *text pointer to a text buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 barge in failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the stop frame and the text frame are written back to back and both acks are checked
+ */
+uint8_t syn6288_barge_in(syn6288_handle_t *handle, char *text)
+{
+    uint16_t len;
+    
+    if (handle == NULL)                                                   /* check handle */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (handle->inited != 1)                                              /* check handle initialization */
+    {
+        return 3;                                                         /* return error */
+    }
+    
+    len = (uint16_t)strlen(text);                                         /* get length of text */
+    if (len > SYN6288_TEXT_MAX_LEN)                                       /* check length */
+    {
+        SYN6288_LOG_WARNING(handle, SYN6288_EVENT_TOO_LONG, SYN6288_OPCODE_SYNTHESIS, len, "syn6288: text is too long.\n"); /* text is too long */
+        
+        return 1;                                                         /* return error */
+    }
+    memcpy(&handle->buf[10], text, len);                                  /* copy text */
+    
+    return a_syn6288_write_barge_in(handle, len);                         /* write frames */
+}
+
 /**
  * @brief     pause the chip
  * @param[in] *handle pointer to a syn6288 handle structure
@@ -331,35 +799,40 @@ uint8_t syn6288_pause(syn6288_handle_t *handle)
     cmd[2] = 0x02;                                                        /* length lsb */
     cmd[3] = 0x03;                                                        /* command */
     cmd[4] = 0xFC;                                                        /* xor */
+    SYN6288_TRACE_FRAME(SYN6288_OPCODE_PAUSE, cmd, 5);                    /* trace the frame */
     res = handle->uart_flush();                                           /* uart flush */
     if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart flush failed.\n");             /* uart flush failed */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_FLUSH_FAILED, SYN6288_OPCODE_PAUSE, 0, "syn6288: uart flush failed.\n"); /* uart flush failed */
         
         return 1;                                                         /* return error */
     }
     res = handle->uart_write((uint8_t *)cmd, 5);                          /* uart write */
     if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart write failed.\n");             /* uart write failed */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_WRITE_FAILED, SYN6288_OPCODE_PAUSE, 5, "syn6288: uart write failed.\n"); /* uart write failed */
         
         return 1;                                                         /* return error */
     }
-    handle->delay_ms(100);                                                /* delay 100 ms */
-    len = handle->uart_read((uint8_t *)&temp, 1);                         /* uart read */
+    a_syn6288_stats_write(handle, SYN6288_OPCODE_PAUSE, 5);               /* count the frame */
+    len = a_syn6288_read_answer(handle, &temp, 1, 5);                     /* read the answer */
     if (len != 1)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart read failed.\n");              /* uart read failed */
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_PAUSE, 2);             /* count the answer */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_READ_FAILED, SYN6288_OPCODE_PAUSE, len, "syn6288: uart read failed.\n"); /* uart read failed */
         
         return 1;                                                         /* return error */
     }
     if (temp == 0x41)                                                     /* check return */
     {
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_PAUSE, 0);             /* count the answer */
+        
         return 0;                                                         /* success return 0 */
     }
     else
     {
-        handle->debug_print("syn6288: command receive failed.\n");        /* command receive failed */
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_PAUSE, 1);             /* count the answer */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_RECEIVE_FAILED, SYN6288_OPCODE_PAUSE, temp, "syn6288: command receive failed.\n"); /* command receive failed */
         
         return 1;                                                         /* return error */
     }
@@ -396,35 +869,40 @@ uint8_t syn6288_resume(syn6288_handle_t *handle)
     cmd[2] = 0x02;                                                        /* length lsb */
     cmd[3] = 0x04;                                                        /* command */
     cmd[4] = 0xFB;                                                        /* xor */
+    SYN6288_TRACE_FRAME(SYN6288_OPCODE_RESUME, cmd, 5);                   /* trace the frame */
     res = handle->uart_flush();                                           /* uart flush */
     if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart flush failed.\n");             /* uart flush failed */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_FLUSH_FAILED, SYN6288_OPCODE_RESUME, 0, "syn6288: uart flush failed.\n"); /* uart flush failed */
         
         return 1;                                                         /* return error */
     }
     res = handle->uart_write((uint8_t *)cmd, 5);                          /* uart write */
     if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart write failed.\n");             /* uart write failed */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_WRITE_FAILED, SYN6288_OPCODE_RESUME, 5, "syn6288: uart write failed.\n"); /* uart write failed */
         
         return 1;                                                         /* return error */
     }
-    handle->delay_ms(100);                                                /* delay 100 ms */
-    len = handle->uart_read((uint8_t *)&temp, 1);                         /* uart read */
+    a_syn6288_stats_write(handle, SYN6288_OPCODE_RESUME, 5);              /* count the frame */
+    len = a_syn6288_read_answer(handle, &temp, 1, 5);                     /* read the answer */
     if (len != 1)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart read failed.\n");              /* uart read failed */
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_RESUME, 2);            /* count the answer */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_READ_FAILED, SYN6288_OPCODE_RESUME, len, "syn6288: uart read failed.\n"); /* uart read failed */
         
         return 1;                                                         /* return error */
     }
     if (temp == 0x41)                                                     /* check return */
     {
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_RESUME, 0);            /* count the answer */
+        
         return 0;                                                         /* success return 0 */
     }
     else
     {
-        handle->debug_print("syn6288: command receive failed.\n");        /* command receive failed */
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_RESUME, 1);            /* count the answer */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_RECEIVE_FAILED, SYN6288_OPCODE_RESUME, temp, "syn6288: command receive failed.\n"); /* command receive failed */
         
         return 1;                                                         /* return error */
     }
@@ -461,40 +939,116 @@ uint8_t syn6288_power_down(syn6288_handle_t *handle)
     cmd[2] = 0x02;                                                        /* length lsb */
     cmd[3] = 0x88;                                                        /* command */
     cmd[4] = 0x77;                                                        /* xor */
+    SYN6288_TRACE_FRAME(SYN6288_OPCODE_POWER_DOWN, cmd, 5);               /* trace the frame */
     res = handle->uart_flush();                                           /* uart flush */
     if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart flush failed.\n");             /* uart flush failed */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_FLUSH_FAILED, SYN6288_OPCODE_POWER_DOWN, 0, "syn6288: uart flush failed.\n"); /* uart flush failed */
         
         return 1;                                                         /* return error */
     }
     res = handle->uart_write((uint8_t *)cmd, 5);                          /* uart write */
     if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart write failed.\n");             /* uart write failed */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_WRITE_FAILED, SYN6288_OPCODE_POWER_DOWN, 5, "syn6288: uart write failed.\n"); /* uart write failed */
         
         return 1;                                                         /* return error */
     }
-    handle->delay_ms(100);                                                /* delay 100 ms */
-    len = handle->uart_read((uint8_t *)&temp, 1);                         /* uart read */
+    a_syn6288_stats_write(handle, SYN6288_OPCODE_POWER_DOWN, 5);          /* count the frame */
+    len = a_syn6288_read_answer(handle, &temp, 1, 5);                     /* read the answer */
     if (len != 1)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart read failed.\n");              /* uart read failed */
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_POWER_DOWN, 2);        /* count the answer */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_READ_FAILED, SYN6288_OPCODE_POWER_DOWN, len, "syn6288: uart read failed.\n"); /* uart read failed */
         
         return 1;                                                         /* return error */
     }
     if (temp == 0x41)                                                     /* check return */
     {
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_POWER_DOWN, 0);        /* count the answer */
+        
         return 0;                                                         /* success return 0 */
     }
     else
     {
-        handle->debug_print("syn6288: command receive failed.\n");        /* command receive failed */
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_POWER_DOWN, 1);        /* count the answer */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_RECEIVE_FAILED, SYN6288_OPCODE_POWER_DOWN, temp, "syn6288: command receive failed.\n"); /* command receive failed */
         
         return 1;                                                         /* return error */
     }
 }
 
+/**
+ * @brief     wake up the chip
+ * @param[in] *handle pointer to a syn6288 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 wake up failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the chip wakes on the uart traffic and may drop the first frame,
+ *            so a stop frame is sent until it is acked
+ */
+uint8_t syn6288_wake_up(syn6288_handle_t *handle)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t cmd[5];
+    
+    if (handle == NULL)                                                   /* check handle */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (handle->inited != 1)                                              /* check handle initialization */
+    {
+        return 3;                                                         /* return error */
+    }
+    
+    cmd[0] = 0xFD;                                                        /* frame header */
+    cmd[1] = 0x00;                                                        /* length msb */
+    cmd[2] = 0x02;                                                        /* length lsb */
+    cmd[3] = 0x02;                                                        /* stop command */
+    cmd[4] = 0xFD;                                                        /* xor */
+    for (i = 0; i < SYN6288_WAKE_RETRY; i++)
+    {
+        SYN6288_TRACE_FRAME(SYN6288_OPCODE_STOP, cmd, 5);                 /* trace the frame */
+        res = handle->uart_flush();                                       /* uart flush */
+        if (res != 0)                                                     /* check result */
+        {
+            SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_FLUSH_FAILED, SYN6288_OPCODE_STOP, 0, "syn6288: uart flush failed.\n"); /* uart flush failed */
+            
+            return 1;                                                     /* return error */
+        }
+        res = handle->uart_write((uint8_t *)cmd, 5);                      /* uart write */
+        if (res != 0)                                                     /* check result */
+        {
+            SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_WRITE_FAILED, SYN6288_OPCODE_STOP, 5, "syn6288: uart write failed.\n"); /* uart write failed */
+            
+            return 1;                                                     /* return error */
+        }
+        a_syn6288_stats_write(handle, SYN6288_OPCODE_STOP, 5);            /* count the frame */
+        res = a_syn6288_wait_ack(handle, SYN6288_OPCODE_STOP, 1, 5);  /* wait the ack */
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_STOP, res);            /* count the answer */
+        if (res == 0)                                                     /* check result */
+        {
+            return 0;                                                     /* success return 0 */
+        }
+        else if (res == 1)                                                /* wrong ack */
+        {
+            return 1;                                                     /* return error */
+        }
+        else
+        {
+            handle->stats.opcode[SYN6288_OPCODE_STOP].retries++;          /* retries++ */
+            
+            continue;                                                     /* send again */
+        }
+    }
+    SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_READ_FAILED, SYN6288_OPCODE_STOP, 0, "syn6288: uart read failed.\n"); /* uart read failed */
+    
+    return 1;                                                             /* return error */
+}
+
 /**
  * @brief     set the baud rate
  * @param[in] *handle pointer to a syn6288 handle structure
@@ -561,35 +1115,40 @@ uint8_t syn6288_set_baud_rate(syn6288_handle_t *handle, syn6288_baud_rate_t rate
             break;                                                        /* break */
         }
     }
+    SYN6288_TRACE_FRAME(SYN6288_OPCODE_BAUD_RATE, cmd, 6);                /* trace the frame */
     res = handle->uart_flush();                                           /* uart flush */
     if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart flush failed.\n");             /* uart flush failed */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_FLUSH_FAILED, SYN6288_OPCODE_BAUD_RATE, 0, "syn6288: uart flush failed.\n"); /* uart flush failed */
             
         return 1;                                                         /* return error */
     }
     res = handle->uart_write((uint8_t *)cmd, 6);                          /* uart write */
     if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart write failed.\n");             /* uart write failed */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_WRITE_FAILED, SYN6288_OPCODE_BAUD_RATE, 6, "syn6288: uart write failed.\n"); /* uart write failed */
         
         return 1;                                                         /* return error */
     }
-    handle->delay_ms(100);                                                /* delay 100 ms */
-    len = handle->uart_read((uint8_t *)&temp, 1);                         /* uart read */
+    a_syn6288_stats_write(handle, SYN6288_OPCODE_BAUD_RATE, 6);           /* count the frame */
+    len = a_syn6288_read_answer(handle, &temp, 1, 6);                     /* read the answer */
     if (len != 1)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart read failed.\n");              /* uart read failed */
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_BAUD_RATE, 2);         /* count the answer */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_READ_FAILED, SYN6288_OPCODE_BAUD_RATE, len, "syn6288: uart read failed.\n"); /* uart read failed */
         
         return 1;                                                         /* return error */
     }
     if (temp == 0x41)                                                     /* check return */
     {
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_BAUD_RATE, 0);         /* count the answer */
+        
         return 0;                                                         /* success return 0 */
     }
     else
     {
-        handle->debug_print("syn6288: command receive failed.\n");        /* command receive failed */
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_BAUD_RATE, 1);         /* count the answer */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_RECEIVE_FAILED, SYN6288_OPCODE_BAUD_RATE, temp, "syn6288: command receive failed.\n"); /* command receive failed */
         
         return 1;                                                         /* return error */
     }
@@ -741,7 +1300,6 @@ uint8_t syn6288_synthesis_sound(syn6288_handle_t *handle, syn6288_sound_t sound)
     uint8_t res;
     uint16_t len;
     uint8_t temp;
-    uint8_t i;
     uint8_t xor_cal = 0;
     char cmd[6];
     
@@ -766,40 +1324,42 @@ uint8_t syn6288_synthesis_sound(syn6288_handle_t *handle, syn6288_sound_t sound)
     handle->buf[3] = 0x01;                                                /* command */
     handle->buf[4] = 0x00;                                                /* command param */
     strncpy((char *)&handle->buf[5],(char *)cmd, 6);                      /* copy text */
-    for (i = 0; i < 6 + 5; i++)
-    {
-        xor_cal ^= handle->buf[i];                                        /* calculate xor */
-    }
+    (void)syn6288_frame_xor((uint8_t *)handle->buf, 6 + 5, &xor_cal);     /* calculate xor */
     handle->buf[6+5] = xor_cal;                                           /* set xor */
+    SYN6288_TRACE_FRAME(SYN6288_OPCODE_SYNTHESIS, handle->buf, 6+6);      /* trace the frame */
     res = handle->uart_flush();                                           /* uart flush */
     if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart flush failed.\n");             /* uart flush failed */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_FLUSH_FAILED, SYN6288_OPCODE_SYNTHESIS, 0, "syn6288: uart flush failed.\n"); /* uart flush failed */
         
         return 1;                                                         /* return error */
     }
     res = handle->uart_write((uint8_t *)handle->buf, 6+6);                /* uart write */
     if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart write failed.\n");             /* uart write failed */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_WRITE_FAILED, SYN6288_OPCODE_SYNTHESIS, 6+6, "syn6288: uart write failed.\n"); /* uart write failed */
         
         return 1;                                                         /* return error */
     }
-    handle->delay_ms(100);                                                /* delay 100 ms */
-    len = handle->uart_read((uint8_t *)&temp, 1);                         /* uart read */
+    a_syn6288_stats_write(handle, SYN6288_OPCODE_SYNTHESIS, 6 + 6);       /* count the frame */
+    len = a_syn6288_read_answer(handle, &temp, 1, 6 + 6);                 /* read the answer */
     if (len != 1)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart read failed.\n");              /* uart read failed */
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_SYNTHESIS, 2);         /* count the answer */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_READ_FAILED, SYN6288_OPCODE_SYNTHESIS, len, "syn6288: uart read failed.\n"); /* uart read failed */
         
         return 1;                                                         /* return error */
     }
     if (temp == 0x41)                                                     /* check return */
     {
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_SYNTHESIS, 0);         /* count the answer */
+        
         return 0;                                                         /* success return 0 */
     }
     else
     {
-        handle->debug_print("syn6288: command receive failed.\n");        /* command receive failed */
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_SYNTHESIS, 1);         /* count the answer */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_RECEIVE_FAILED, SYN6288_OPCODE_SYNTHESIS, temp, "syn6288: command receive failed.\n"); /* command receive failed */
        
         return 1;                                                         /* return error */
     }
@@ -821,7 +1381,6 @@ uint8_t syn6288_synthesis_message(syn6288_handle_t *handle, syn6288_message_t me
     uint8_t res;
     uint16_t len;
     uint8_t temp;
-    uint8_t i;
     uint8_t xor_cal = 0;
     char cmd[4];
     
@@ -844,40 +1403,42 @@ uint8_t syn6288_synthesis_message(syn6288_handle_t *handle, syn6288_message_t me
     handle->buf[3] = 0x01;                                                /* command */
     handle->buf[4] = 0x00;                                                /* command param */
     strncpy((char *)&handle->buf[5], (char *)cmd, 4);                     /* copy text */
-    for (i = 0; i < 4 + 5; i++)
-    {
-        xor_cal ^= handle->buf[i];                                        /* calculate xor */
-    } 
+    (void)syn6288_frame_xor((uint8_t *)handle->buf, 4 + 5, &xor_cal);     /* calculate xor */
     handle->buf[4+5] = xor_cal;                                           /* set xor */
+    SYN6288_TRACE_FRAME(SYN6288_OPCODE_SYNTHESIS, handle->buf, 6 + 4);    /* trace the frame */
     res = handle->uart_flush();                                           /* uart flush */
     if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart flush failed.\n");             /* uart flush failed */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_FLUSH_FAILED, SYN6288_OPCODE_SYNTHESIS, 0, "syn6288: uart flush failed.\n"); /* uart flush failed */
         
         return 1;                                                         /* return error */
     }
     res = handle->uart_write((uint8_t *)handle->buf, 6 + 4);              /* uart write */
     if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart write failed.\n");             /* uart write failed */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_WRITE_FAILED, SYN6288_OPCODE_SYNTHESIS, 6 + 4, "syn6288: uart write failed.\n"); /* uart write failed */
         
         return 1;                                                         /* return error */
     }
-    handle->delay_ms(100);                                                /* delay 100 ms */
-    len = handle->uart_read((uint8_t *)&temp, 1);                         /* uart read  */
+    a_syn6288_stats_write(handle, SYN6288_OPCODE_SYNTHESIS, 6 + 4);       /* count the frame */
+    len = a_syn6288_read_answer(handle, &temp, 1, 6 + 4);                 /* read the answer */
     if (len != 1)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart read failed.\n");              /* uart read failed */
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_SYNTHESIS, 2);         /* count the answer */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_READ_FAILED, SYN6288_OPCODE_SYNTHESIS, len, "syn6288: uart read failed.\n"); /* uart read failed */
         
         return 1;                                                         /* return error */
     }
     if (temp == 0x41)                                                     /* check return */
     {
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_SYNTHESIS, 0);         /* count the answer */
+        
         return 0;                                                         /* success return 0 */
     }
     else
     {
-        handle->debug_print("syn6288: command receive failed.\n");        /* command receive failed */
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_SYNTHESIS, 1);         /* count the answer */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_RECEIVE_FAILED, SYN6288_OPCODE_SYNTHESIS, temp, "syn6288: command receive failed.\n"); /* command receive failed */
         
         return 1;                                                         /* return error */
     }
@@ -899,7 +1460,6 @@ uint8_t syn6288_synthesis_ring(syn6288_handle_t *handle, syn6288_ring_t ring)
     uint8_t res;
     uint16_t len;
     uint8_t temp;
-    uint8_t i;
     uint8_t xor_cal = 0;
     char cmd[5];
     
@@ -923,45 +1483,165 @@ uint8_t syn6288_synthesis_ring(syn6288_handle_t *handle, syn6288_ring_t ring)
     handle->buf[3] = 0x01;                                                /* command */
     handle->buf[4] = 0x00;                                                /* command param */
     strncpy((char *)&handle->buf[5],(char *)cmd, 5);                      /* copy text */
-    for (i = 0; i < 5 + 5; i++)
-    {
-        xor_cal ^= handle->buf[i];                                        /* calculate xor */
-    }
+    (void)syn6288_frame_xor((uint8_t *)handle->buf, 5 + 5, &xor_cal);     /* calculate xor */
     handle->buf[5+5] = xor_cal;                                           /* set xor */
+    SYN6288_TRACE_FRAME(SYN6288_OPCODE_SYNTHESIS, handle->buf, 6+5);      /* trace the frame */
     res = handle->uart_flush();                                           /* uart flush */
     if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart flush failed.\n");             /* uart flush failed */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_FLUSH_FAILED, SYN6288_OPCODE_SYNTHESIS, 0, "syn6288: uart flush failed.\n"); /* uart flush failed */
        
         return 1;                                                         /* return error */
     }
     res = handle->uart_write((uint8_t *)handle->buf, 6+5);                /* uart write */
     if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart write failed.\n");             /* uart write failed */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_WRITE_FAILED, SYN6288_OPCODE_SYNTHESIS, 6+5, "syn6288: uart write failed.\n"); /* uart write failed */
         
         return 1;                                                         /* return error */
     }
-    handle->delay_ms(100);                                                /* delay 100 ms */
-    len = handle->uart_read((uint8_t *)&temp, 1);                         /* uart read */
+    a_syn6288_stats_write(handle, SYN6288_OPCODE_SYNTHESIS, 6 + 5);       /* count the frame */
+    len = a_syn6288_read_answer(handle, &temp, 1, 6 + 5);                 /* read the answer */
     if (len != 1)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart read failed.\n");              /* uart read failed */
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_SYNTHESIS, 2);         /* count the answer */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_READ_FAILED, SYN6288_OPCODE_SYNTHESIS, len, "syn6288: uart read failed.\n"); /* uart read failed */
         
         return 1;                                                         /* return error */
     }
     if (temp == 0x41)                                                     /* check return */
     {
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_SYNTHESIS, 0);         /* count the answer */
+        
         return 0;                                                         /* success return 0 */
     }
     else
     {
-        handle->debug_print("syn6288: command receive failed.\n");        /* command receive failed */
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_SYNTHESIS, 1);         /* count the answer */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_RECEIVE_FAILED, SYN6288_OPCODE_SYNTHESIS, temp, "syn6288: command receive failed.\n"); /* command receive failed */
         
         return 1;                                                         /* return error */
     }
 }
 
+/**
+ * @brief     synthesis a sequence of prompt tones and text
+ * @param[in] *handle pointer to a syn6288 handle structure
+ * @param[in] *item pointer to a sequence item buffer
+ * @param[in] len item buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 synthesis sequence failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 item is invalid
+ * @note      items are packed into one frame as long as the 200 bytes text limit allows,
+ *            a following frame is only sent after the chip has finished the previous one,
+ *            the wait for the previous frame fails after SYN6288_IDLE_RETRY status polls
+ */
+uint8_t syn6288_synthesis_sequence(syn6288_handle_t *handle, syn6288_sequence_item_t *item, uint8_t len)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t frames;
+    uint8_t param;
+    uint16_t pos;
+    uint16_t l;
+    uint8_t token[12];
+    uint8_t *p;
+    
+    if (handle == NULL)                                                       /* check handle */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (handle->inited != 1)                                                  /* check handle initialization */
+    {
+        return 3;                                                             /* return error */
+    }
+    if ((item == NULL) || (len == 0))                                         /* check item */
+    {
+        SYN6288_LOG_WARNING(handle, SYN6288_EVENT_PARAM_INVALID, SYN6288_OPCODE_SYNTHESIS, len, "syn6288: item is invalid.\n"); /* item is invalid */
+        
+        return 4;                                                             /* return error */
+    }
+    
+    for (i = 0; i < len; i++)                                                 /* check all items first */
+    {
+        if (item[i].type == SYN6288_SEQUENCE_TYPE_TEXT)                       /* text item */
+        {
+            if (item[i].text == NULL)                                         /* check text */
+            {
+                SYN6288_LOG_WARNING(handle, SYN6288_EVENT_PARAM_INVALID, SYN6288_OPCODE_SYNTHESIS, i, "syn6288: item is invalid.\n"); /* item is invalid */
+                
+                return 4;                                                     /* return error */
+            }
+            l = (item[i].len != 0) ? item[i].len : (uint16_t)strlen(item[i].text);
+            if (l > SYN6288_TEXT_MAX_LEN)                                     /* check length */
+            {
+                SYN6288_LOG_WARNING(handle, SYN6288_EVENT_TOO_LONG, SYN6288_OPCODE_SYNTHESIS, l, "syn6288: text is too long.\n"); /* text is too long */
+                
+                return 4;                                                     /* return error */
+            }
+        }
+        else
+        {
+            if (a_syn6288_encode_token(handle->type, &item[i], token) == 0)   /* encode token */
+            {
+                SYN6288_LOG_WARNING(handle, SYN6288_EVENT_PARAM_INVALID, SYN6288_OPCODE_SYNTHESIS, i, "syn6288: item is invalid.\n"); /* item is invalid */
+                
+                return 4;                                                     /* return error */
+            }
+        }
+    }
+    
+    frames = 0;                                                               /* no frame sent */
+    pos = 0;                                                                  /* init position */
+    param = handle->mode | handle->type;                                      /* set command param */
+    for (i = 0; i < len; i++)
+    {
+        if (item[i].type == SYN6288_SEQUENCE_TYPE_TEXT)                       /* text item */
+        {
+            l = (item[i].len != 0) ? item[i].len : (uint16_t)strlen(item[i].text);
+            p = (uint8_t *)item[i].text;                                      /* set text */
+        }
+        else
+        {
+            l = a_syn6288_encode_token(handle->type, &item[i], token);        /* encode token */
+            p = token;                                                        /* set token */
+        }
+        if ((pos + l) > SYN6288_TEXT_MAX_LEN)                                 /* frame is full */
+        {
+            if (frames != 0)                                                  /* not the first frame */
+            {
+                res = a_syn6288_wait_idle(handle);                            /* wait the previous frame */
+                if (res != 0)                                                 /* check result */
+                {
+                    return 1;                                                 /* return error */
+                }
+            }
+            res = a_syn6288_write_text_frame(handle, param, pos);             /* write frame */
+            if (res != 0)                                                     /* check result */
+            {
+                return 1;                                                     /* return error */
+            }
+            frames++;                                                         /* frames++ */
+            pos = 0;                                                          /* reset position */
+        }
+        memcpy(&handle->buf[5 + pos], p, l);                                  /* copy the item */
+        pos += l;                                                             /* position += l */
+    }
+    if (frames != 0)                                                          /* not the first frame */
+    {
+        res = a_syn6288_wait_idle(handle);                                    /* wait the previous frame */
+        if (res != 0)                                                         /* check result */
+        {
+            return 1;                                                         /* return error */
+        }
+    }
+    
+    return a_syn6288_write_text_frame(handle, param, pos);                    /* write the last frame */
+}
+
 /**
  * @brief     synthesis the test
  * @param[in] *handle pointer to a syn6288 handle structure
@@ -978,7 +1658,6 @@ uint8_t syn6288_synthesis_text(syn6288_handle_t *handle, char *text)
     uint8_t res;
     uint16_t l;
     uint8_t len, temp;
-    uint8_t i;
     uint8_t xor_cal = 0;
     
     if (handle == NULL)                                                   /* check handle */
@@ -993,7 +1672,7 @@ uint8_t syn6288_synthesis_text(syn6288_handle_t *handle, char *text)
     len = (uint8_t)strlen(text);                                          /* get length of text */
     if (len > 200)                                                        /* check length */
     {
-        handle->debug_print("syn6288: text is too long.\n");              /* text is too long */
+        SYN6288_LOG_WARNING(handle, SYN6288_EVENT_TOO_LONG, SYN6288_OPCODE_SYNTHESIS, len, "syn6288: text is too long.\n"); /* text is too long */
         
         return 1;                                                         /* return error */
     }
@@ -1003,40 +1682,42 @@ uint8_t syn6288_synthesis_text(syn6288_handle_t *handle, char *text)
     handle->buf[3] = 0x01;                                                /* command */
     handle->buf[4] = handle->mode|handle->type;                           /* command param */
     strncpy((char *)&handle->buf[5], text, len);                          /* copy text */
-    for (i = 0; i < len + 5; i++)
-    {
-        xor_cal ^= handle->buf[i];                                        /* calculate xor */
-    }
+    (void)syn6288_frame_xor((uint8_t *)handle->buf, len + 5, &xor_cal);   /* calculate xor */
     handle->buf[len+5] = xor_cal;                                         /* set xor */
+    SYN6288_TRACE_FRAME(SYN6288_OPCODE_SYNTHESIS, handle->buf, len+6);    /* trace the frame */
     res = handle->uart_flush();                                           /* uart flush */ 
     if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart flush failed.\n");             /* uart flush failed */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_FLUSH_FAILED, SYN6288_OPCODE_SYNTHESIS, 0, "syn6288: uart flush failed.\n"); /* uart flush failed */
         
         return 1;                                                         /* return error */
     }
     res = handle->uart_write((uint8_t *)handle->buf, len+6);              /* uart write */
     if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart write failed.\n");             /* uart write failed */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_WRITE_FAILED, SYN6288_OPCODE_SYNTHESIS, len+6, "syn6288: uart write failed.\n"); /* uart write failed */
         
         return 1;                                                         /* return error */
     }
-    handle->delay_ms(100);                                                /* delay 100 ms */
-    l = handle->uart_read((uint8_t *)&temp, 1);                           /* uart read */
+    a_syn6288_stats_write(handle, SYN6288_OPCODE_SYNTHESIS, len + 6);     /* count the frame */
+    l = a_syn6288_read_answer(handle, &temp, 1, len + 6);                 /* read the answer */
     if (l != 1)                                                           /* check result */
     {
-        handle->debug_print("syn6288: uart read failed.\n");              /* uart read failed */
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_SYNTHESIS, 2);         /* count the answer */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_READ_FAILED, SYN6288_OPCODE_SYNTHESIS, l, "syn6288: uart read failed.\n"); /* uart read failed */
         
         return 1;                                                         /* return error */
     }
     if (temp == 0x41)                                                     /* check return */
     {
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_SYNTHESIS, 0);         /* count the answer */
+        
         return 0;                                                         /* success return 0 */
     }
     else
     {
-        handle->debug_print("syn6288: command receive failed.\n");        /* command receive failed */
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_SYNTHESIS, 1);         /* count the answer */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_RECEIVE_FAILED, SYN6288_OPCODE_SYNTHESIS, temp, "syn6288: command receive failed.\n"); /* command receive failed */
        
         return 1;                                                         /* return error */
     }
@@ -1059,7 +1740,7 @@ uint8_t syn6288_set_synthesis_volume(syn6288_handle_t *handle, uint8_t volume)
     
     if (volume > 16)                                              /* check volume */
     {
-        handle->debug_print("syn6288: volume invalid.\n");        /* volume invalid */
+        SYN6288_LOG_WARNING(handle, SYN6288_EVENT_PARAM_INVALID, SYN6288_OPCODE_NUM, volume, "syn6288: volume invalid.\n"); /* volume invalid */
         
         return 1;                                                 /* return error */
     }
@@ -1114,7 +1795,7 @@ uint8_t syn6288_set_background_volume(syn6288_handle_t *handle, uint8_t volume)
     
     if (volume > 16)                                              /* check volume */
     {
-        handle->debug_print("syn6288: volume is invalid.\n");     /* volume is invalid */
+        SYN6288_LOG_WARNING(handle, SYN6288_EVENT_PARAM_INVALID, SYN6288_OPCODE_NUM, volume, "syn6288: volume is invalid.\n"); /* volume is invalid */
        
         return 1;                                                 /* return error */
     }
@@ -1169,7 +1850,7 @@ uint8_t syn6288_set_synthesis_speed(syn6288_handle_t *handle, uint8_t speed)
     
     if (speed > 5)                                                  /* check speed */
     {
-        handle->debug_print("syn6288: speed is invalid.\n");        /* speed is invalid */
+        SYN6288_LOG_WARNING(handle, SYN6288_EVENT_PARAM_INVALID, SYN6288_OPCODE_NUM, speed, "syn6288: speed is invalid.\n"); /* speed is invalid */
        
         return 1;                                                   /* return error */
     }
@@ -1223,7 +1904,6 @@ uint8_t syn6288_set_command(syn6288_handle_t *handle, char *command)
     uint8_t res;
     uint16_t l;
     uint8_t len, temp;
-    uint8_t i;
     uint8_t xor_cal = 0;
     
     if (handle == NULL)                                                   /* check handle */
@@ -1238,7 +1918,7 @@ uint8_t syn6288_set_command(syn6288_handle_t *handle, char *command)
     len = (uint8_t)strlen(command);                                       /* get length of command */
     if (len > 200)                                                        /* check result */
     {
-        handle->debug_print("syn6288: command is too long.\n");           /* command is too long */
+        SYN6288_LOG_WARNING(handle, SYN6288_EVENT_TOO_LONG, SYN6288_OPCODE_SYNTHESIS, len, "syn6288: command is too long.\n"); /* command is too long */
        
         return 1;                                                         /* return error */
     }
@@ -1248,45 +1928,200 @@ uint8_t syn6288_set_command(syn6288_handle_t *handle, char *command)
     handle->buf[3] = 0x01;                                                /* command */
     handle->buf[4] = 0x00;                                                /* command param */
     strncpy((char *)&handle->buf[5], command, len);                       /* copy command */
-    for (i = 0; i < len + 5; i++)
-    {
-        xor_cal ^= handle->buf[i];                                        /* calculate xor */
-    }
+    (void)syn6288_frame_xor((uint8_t *)handle->buf, len + 5, &xor_cal);   /* calculate xor */
     handle->buf[len + 5] = xor_cal;                                       /* set xor */
+    SYN6288_TRACE_FRAME(SYN6288_OPCODE_SYNTHESIS, handle->buf, len+6);    /* trace the frame */
     res = handle->uart_flush();                                           /* uart flush */ 
     if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart flush failed.\n");             /* uart flush failed */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_FLUSH_FAILED, SYN6288_OPCODE_SYNTHESIS, 0, "syn6288: uart flush failed.\n"); /* uart flush failed */
        
         return 1;                                                         /* return error */
     }
     res = handle->uart_write((uint8_t *)handle->buf, len+6);              /* uart write */
     if (res != 0)                                                         /* check result */
     {
-        handle->debug_print("syn6288: uart write failed.\n");             /* uart write failed */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_WRITE_FAILED, SYN6288_OPCODE_SYNTHESIS, len+6, "syn6288: uart write failed.\n"); /* uart write failed */
        
         return 1;                                                         /* return error */
     }
-    handle->delay_ms(100);                                                /* delay 100 ms */
-    l = handle->uart_read((uint8_t *)&temp, 1);                           /* uart read */
+    a_syn6288_stats_write(handle, SYN6288_OPCODE_SYNTHESIS, len + 6);     /* count the frame */
+    l = a_syn6288_read_answer(handle, &temp, 1, len + 6);                 /* read the answer */
     if (l != 1)                                                           /* check result */
     {
-        handle->debug_print("syn6288: uart read failed.\n");              /* uart read failed */
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_SYNTHESIS, 2);         /* count the answer */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_UART_READ_FAILED, SYN6288_OPCODE_SYNTHESIS, l, "syn6288: uart read failed.\n"); /* uart read failed */
        
         return 1;                                                         /* return error */
     }
     if (temp == 0x41)                                                     /* check return */
     {
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_SYNTHESIS, 0);         /* count the answer */
+        
         return 0;                                                         /* success return 0 */
     }
     else
     {
-        handle->debug_print("syn6288: command receive failed.\n");        /* command receive failed */
+        a_syn6288_stats_ack(handle, SYN6288_OPCODE_SYNTHESIS, 1);         /* count the answer */
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_RECEIVE_FAILED, SYN6288_OPCODE_SYNTHESIS, temp, "syn6288: command receive failed.\n"); /* command receive failed */
        
         return 1;                                                         /* return error */
     }
 }
 
+/**
+ * @brief     synthesis the text buffer
+ * @param[in] *handle pointer to a syn6288 handle structure
+ * @param[in] *buf pointer to a text buffer encoded as the current text type
+ * @param[in] len text buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 synthesis buffer failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 len is invalid
+ * @note      unlike syn6288_synthesis_text the buffer can hold 0x00 bytes such as unicode text
+ */
+uint8_t syn6288_synthesis_buffer(syn6288_handle_t *handle, uint8_t *buf, uint16_t len)
+{
+    if (handle == NULL)                                                             /* check handle */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if (handle->inited != 1)                                                        /* check handle initialization */
+    {
+        return 3;                                                                   /* return error */
+    }
+    if ((len == 0) || (len > SYN6288_TEXT_MAX_LEN))                                 /* check length */
+    {
+        SYN6288_LOG_WARNING(handle, SYN6288_EVENT_PARAM_INVALID, SYN6288_OPCODE_SYNTHESIS, len, "syn6288: len is invalid.\n"); /* len is invalid */
+        
+        return 4;                                                                   /* return error */
+    }
+    
+    memcpy(&handle->buf[5], buf, len);                                              /* copy text */
+    
+    return a_syn6288_write_text_frame(handle, handle->mode | handle->type, len);    /* write frame */
+}
+
+/**
+ * @brief     stop the playing text and synthesis a new text buffer
+ * @param[in] *handle pointer to a syn6288 handle structure
+ * @param[in] *buf pointer to a text buffer encoded as the current text type
+ * @param[in] len text buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 barge in failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 len is invalid
+ * @note      the stop frame and the text frame are written back to back and both acks are checked
+ */
+uint8_t syn6288_barge_in_buffer(syn6288_handle_t *handle, uint8_t *buf, uint16_t len)
+{
+    if (handle == NULL)                                                   /* check handle */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (handle->inited != 1)                                              /* check handle initialization */
+    {
+        return 3;                                                         /* return error */
+    }
+    if ((len == 0) || (len > SYN6288_TEXT_MAX_LEN))                       /* check length */
+    {
+        SYN6288_LOG_WARNING(handle, SYN6288_EVENT_PARAM_INVALID, SYN6288_OPCODE_SYNTHESIS, len, "syn6288: len is invalid.\n"); /* len is invalid */
+        
+        return 4;                                                         /* return error */
+    }
+    
+    memcpy(&handle->buf[10], buf, len);                                   /* copy text */
+    
+    return a_syn6288_write_barge_in(handle, len);                         /* write frames */
+}
+
+/**
+ * @brief      get the command stats
+ * @param[in]  *handle pointer to a syn6288 handle structure
+ * @param[out] *stats pointer to a stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the time to first audio is the ack latency of the text frames,
+ *             the answers are polled every 1 ms, so the latency has a 1 ms resolution,
+ *             the playback duration is counted when a status poll finds the chip idle,
+ *             the histograms stay empty when no timestamp_ms is linked
+ */
+uint8_t syn6288_get_stats(syn6288_handle_t *handle, syn6288_stats_t *stats)
+{
+    if (handle == NULL)                                                   /* check handle */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (handle->inited != 1)                                              /* check handle initialization */
+    {
+        return 3;                                                         /* return error */
+    }
+    
+    memcpy(stats, &handle->stats, sizeof(syn6288_stats_t));               /* copy the stats */
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief     reset the command stats
+ * @param[in] *handle pointer to a syn6288 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t syn6288_reset_stats(syn6288_handle_t *handle)
+{
+    if (handle == NULL)                                                   /* check handle */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (handle->inited != 1)                                              /* check handle initialization */
+    {
+        return 3;                                                         /* return error */
+    }
+    
+    memset(&handle->stats, 0, sizeof(syn6288_stats_t));                   /* clear the stats */
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief      calculate the xor checksum of a frame
+ * @param[in]  *buf pointer to a frame buffer
+ * @param[in]  len frame length without the checksum byte
+ * @param[out] *checksum pointer to a checksum buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 buf is NULL
+ * @note       the frames of the driver are built with this function
+ */
+uint8_t syn6288_frame_xor(uint8_t *buf, uint16_t len, uint8_t *checksum)
+{
+    uint16_t i;
+    uint8_t xor_cal = 0;
+    
+    if ((buf == NULL) || (checksum == NULL))                              /* check buf */
+    {
+        return 2;                                                         /* return error */
+    }
+    
+    for (i = 0; i < len; i++)
+    {
+        xor_cal ^= buf[i];                                                /* calculate xor */
+    }
+    *checksum = xor_cal;                                                  /* set xor */
+    
+    return 0;                                                             /* success return 0 */
+}
+
 /**
  * @brief      get chip's information
  * @param[out] *info pointer to a syn6288 info structure
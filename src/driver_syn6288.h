@@ -57,6 +57,71 @@ extern "C"{
  * @{
  */
 
+/**
+ * @brief syn6288 bool enumeration definition
+ */
+typedef enum
+{
+    SYN6288_BOOL_FALSE = 0x00,        /**< false */
+    SYN6288_BOOL_TRUE  = 0x01,        /**< true */
+} syn6288_bool_t;
+
+/**
+ * @brief syn6288 log level definition
+ */
+#define SYN6288_LOG_LEVEL_NONE       0        /**< no event */
+#define SYN6288_LOG_LEVEL_ERROR      1        /**< link and chip errors */
+#define SYN6288_LOG_LEVEL_WARNING    2        /**< errors, invalid parameters and a full queue */
+
+/**
+ * @brief syn6288 compiled log level definition
+ * @note  events above this level are removed at compile time
+ */
+#ifndef SYN6288_LOG_LEVEL
+    #define SYN6288_LOG_LEVEL SYN6288_LOG_LEVEL_WARNING
+#endif
+
+/**
+ * @brief syn6288 log text definition
+ * @note  0 removes all debug_print texts at compile time, only the events are kept
+ */
+#ifndef SYN6288_LOG_TEXT
+    #define SYN6288_LOG_TEXT 1
+#endif
+
+/**
+ * @brief syn6288 event enumeration definition
+ */
+typedef enum
+{
+    SYN6288_EVENT_LINK_NULL          = 0x01,        /**< linked function is null, value is the link index */
+    SYN6288_EVENT_UART_INIT_FAILED   = 0x02,        /**< uart init failed */
+    SYN6288_EVENT_UART_DEINIT_FAILED = 0x03,        /**< uart deinit failed */
+    SYN6288_EVENT_UART_FLUSH_FAILED  = 0x04,        /**< uart flush failed */
+    SYN6288_EVENT_UART_WRITE_FAILED  = 0x05,        /**< uart write failed, value is the frame length */
+    SYN6288_EVENT_UART_READ_FAILED   = 0x06,        /**< no answer, value is the read length */
+    SYN6288_EVENT_RECEIVE_FAILED     = 0x07,        /**< wrong answer, value is the answer */
+    SYN6288_EVENT_PARAM_INVALID      = 0x08,        /**< invalid parameter, value is the parameter */
+    SYN6288_EVENT_TOO_LONG           = 0x09,        /**< text or command is too long, value is the length */
+    SYN6288_EVENT_QUEUE_FULL         = 0x0A,        /**< queue is full, value is the text length */
+    SYN6288_EVENT_IDLE_TIMEOUT       = 0x0B,        /**< chip stays busy, value is the status polls */
+} syn6288_event_t;
+
+/**
+ * @brief syn6288 link index enumeration definition
+ */
+typedef enum
+{
+    SYN6288_LINK_UART_INIT        = 0x00,        /**< uart_init */
+    SYN6288_LINK_UART_DEINIT      = 0x01,        /**< uart_deinit */
+    SYN6288_LINK_UART_READ        = 0x02,        /**< uart_read */
+    SYN6288_LINK_UART_WRITE       = 0x03,        /**< uart_write */
+    SYN6288_LINK_UART_FLUSH       = 0x04,        /**< uart_flush */
+    SYN6288_LINK_DELAY_MS         = 0x05,        /**< delay_ms */
+    SYN6288_LINK_TIMESTAMP_MS     = 0x06,        /**< timestamp_ms */
+    SYN6288_LINK_RECEIVE_CALLBACK = 0x07,        /**< queue receive_callback */
+} syn6288_link_t;
+
 /**
  * @brief syn6288 sound enumeration definition
  */
@@ -146,6 +211,17 @@ typedef enum
     SYN6288_STATUS_BUSY = 0x01,         /**< busy status */
 } syn6288_status_t;
 
+/**
+ * @brief syn6288 sequence type enumeration definition
+ */
+typedef enum
+{
+    SYN6288_SEQUENCE_TYPE_TEXT    = 0x00,        /**< text item */
+    SYN6288_SEQUENCE_TYPE_SOUND   = 0x01,        /**< sound item */
+    SYN6288_SEQUENCE_TYPE_MESSAGE = 0x02,        /**< message item */
+    SYN6288_SEQUENCE_TYPE_RING    = 0x03,        /**< ring item */
+} syn6288_sequence_type_t;
+
 /**
  * @}
  */
@@ -189,6 +265,59 @@ typedef enum
     SYN6288_BAUD_RATE_38400_BPS = 0x02,         /**< 38400 bps */
 } syn6288_baud_rate_t;
 
+/**
+ * @}
+ */
+
+/**
+ * @addtogroup syn6288_extend_driver
+ * @{
+ */
+
+/**
+ * @brief syn6288 stats histogram bucket number definition
+ */
+#define SYN6288_STATS_BUCKET_NUM 18        /**< bucket i counts [2^(i-1), 2^i) ms, the last one is open */
+
+/**
+ * @brief syn6288 opcode enumeration definition
+ */
+typedef enum
+{
+    SYN6288_OPCODE_SYNTHESIS  = 0x00,        /**< synthesis command 0x01 */
+    SYN6288_OPCODE_STOP       = 0x01,        /**< stop command 0x02 */
+    SYN6288_OPCODE_PAUSE      = 0x02,        /**< pause command 0x03 */
+    SYN6288_OPCODE_RESUME     = 0x03,        /**< resume command 0x04 */
+    SYN6288_OPCODE_STATUS     = 0x04,        /**< status command 0x21 */
+    SYN6288_OPCODE_BAUD_RATE  = 0x05,        /**< baud rate command 0x31 */
+    SYN6288_OPCODE_POWER_DOWN = 0x06,        /**< power down command 0x88 */
+    SYN6288_OPCODE_NUM        = 0x07,        /**< opcode number */
+} syn6288_opcode_t;
+
+/**
+ * @brief syn6288 opcode stats structure definition
+ */
+typedef struct syn6288_opcode_stats_s
+{
+    uint32_t frames;          /**< written frames */
+    uint32_t bytes;           /**< written bytes */
+    uint32_t retries;         /**< retried frames */
+    uint32_t naks;            /**< wrong answers */
+    uint32_t timeouts;        /**< missing answers */
+} syn6288_opcode_stats_t;
+
+/**
+ * @brief syn6288 stats structure definition
+ */
+typedef struct syn6288_stats_s
+{
+    syn6288_opcode_stats_t opcode[SYN6288_OPCODE_NUM];        /**< per opcode counters */
+    uint32_t ack_latency[SYN6288_STATS_BUCKET_NUM];           /**< ack latency histogram */
+    uint32_t playback[SYN6288_STATS_BUCKET_NUM];              /**< playback duration histogram */
+    uint32_t first_audio[SYN6288_STATS_BUCKET_NUM];           /**< time to first audio histogram */
+    uint32_t first_audio_last;                                /**< last time to first audio in ms */
+} syn6288_stats_t;
+
 /**
  * @}
  */
@@ -210,6 +339,8 @@ typedef struct syn6288_handle_s
     uint8_t (*uart_write)(uint8_t *buf, uint16_t len);        /**< point to a uart_write function address */
     void (*delay_ms)(uint32_t ms);                            /**< point to a delay_ms function address */
     void (*debug_print)(const char *const fmt, ...);          /**< point to a debug_print function address */
+    void (*event)(uint8_t code, uint8_t command, uint32_t value);    /**< point to an event function address */
+    uint32_t (*timestamp_ms)(void);                           /**< point to a timestamp_ms function address */
     uint8_t type;                                             /**< text type */
     uint8_t mode;                                             /**< play mode */
     uint8_t rate;                                             /**< uart rate */
@@ -217,6 +348,10 @@ typedef struct syn6288_handle_s
     uint8_t background_volume;                                /**< play background volume */
     uint8_t speed;                                            /**< play speed */
     uint8_t inited;                                           /**< inited flag */
+    uint8_t playing;                                          /**< playing flag */
+    uint32_t write_timestamp;                                 /**< last frame write timestamp */
+    uint32_t play_timestamp;                                  /**< playback start timestamp */
+    syn6288_stats_t stats;                                    /**< command stats */
     uint8_t buf[256];                                         /**< frame buf */
 } syn6288_handle_t;
 
@@ -236,6 +371,17 @@ typedef struct syn6288_info_s
     uint32_t driver_version;           /**< driver version */
 } syn6288_info_t;
 
+/**
+ * @brief syn6288 sequence item structure definition
+ */
+typedef struct syn6288_sequence_item_s
+{
+    syn6288_sequence_type_t type;        /**< item type */
+    uint8_t index;                       /**< sound, message or ring index */
+    char *text;                          /**< text encoded as the current text type */
+    uint16_t len;                        /**< text length, 0 means strlen */
+} syn6288_sequence_item_t;
+
 /**
  * @}
  */
@@ -307,10 +453,27 @@ typedef struct syn6288_info_s
  * @brief     link debug_print function
  * @param[in] HANDLE pointer to a syn6288 handle structure
  * @param[in] FUC pointer to a debug_print function address
- * @note      none
+ * @note      debug_print is optional
  */
 #define DRIVER_SYN6288_LINK_DEBUG_PRINT(HANDLE, FUC) (HANDLE)->debug_print = FUC
 
+/**
+ * @brief     link event function
+ * @param[in] HANDLE pointer to a syn6288 handle structure
+ * @param[in] FUC pointer to an event function address
+ * @note      the event function gets a syn6288_event_t code, a syn6288_opcode_t command and a value,
+ *            SYN6288_OPCODE_NUM means no command
+ */
+#define DRIVER_SYN6288_LINK_EVENT(HANDLE, FUC)       (HANDLE)->event = FUC
+
+/**
+ * @brief     link timestamp_ms function
+ * @param[in] HANDLE pointer to a syn6288 handle structure
+ * @param[in] FUC pointer to a timestamp_ms function address
+ * @note      optional, the timing stats are skipped when it is not linked
+ */
+#define DRIVER_SYN6288_LINK_TIMESTAMP_MS(HANDLE, FUC) (HANDLE)->timestamp_ms = FUC
+
 /**
  * @}
  */
@@ -408,6 +571,23 @@ uint8_t syn6288_synthesis_message(syn6288_handle_t *handle, syn6288_message_t me
  */
 uint8_t syn6288_synthesis_ring(syn6288_handle_t *handle, syn6288_ring_t ring);
 
+/**
+ * @brief     synthesis a sequence of prompt tones and text
+ * @param[in] *handle pointer to a syn6288 handle structure
+ * @param[in] *item pointer to a sequence item buffer
+ * @param[in] len item buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 synthesis sequence failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 item is invalid
+ * @note      items are packed into one frame as long as the 200 bytes text limit allows,
+ *            a following frame is only sent after the chip has finished the previous one,
+ *            the wait for the previous frame fails after SYN6288_IDLE_RETRY status polls
+ */
+uint8_t syn6288_synthesis_sequence(syn6288_handle_t *handle, syn6288_sequence_item_t *item, uint8_t len);
+
 /**
  * @brief      get the current status
  * @param[in]  *handle pointer to a syn6288 handle structure
@@ -433,6 +613,19 @@ uint8_t syn6288_get_status(syn6288_handle_t *handle, syn6288_status_t *status);
  */
 uint8_t syn6288_stop(syn6288_handle_t *handle);
 
+/**
+ * @brief     stop the playing text and synthesis a new text
+ * @param[in] *handle pointer to a syn6288 handle structure
+ * @param[in] *text pointer to a text buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 barge in failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the stop frame and the text frame are written back to back and both acks are checked
+ */
+uint8_t syn6288_barge_in(syn6288_handle_t *handle, char *text);
+
 /**
  * @brief     pause the chip
  * @param[in] *handle pointer to a syn6288 handle structure
@@ -469,6 +662,19 @@ uint8_t syn6288_resume(syn6288_handle_t *handle);
  */
 uint8_t syn6288_power_down(syn6288_handle_t *handle);
 
+/**
+ * @brief     wake up the chip
+ * @param[in] *handle pointer to a syn6288 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 wake up failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the chip wakes on the uart traffic and may drop the first frame,
+ *            so a stop frame is sent until it is acked
+ */
+uint8_t syn6288_wake_up(syn6288_handle_t *handle);
+
 /**
  * @brief     set the chip text type
  * @param[in] *handle pointer to a syn6288 handle structure
@@ -652,6 +858,74 @@ uint8_t syn6288_get_synthesis_speed(syn6288_handle_t *handle, uint8_t *speed);
  */
 uint8_t syn6288_set_command(syn6288_handle_t *handle, char *command);
 
+/**
+ * @brief     synthesis the text buffer
+ * @param[in] *handle pointer to a syn6288 handle structure
+ * @param[in] *buf pointer to a text buffer encoded as the current text type
+ * @param[in] len text buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 synthesis buffer failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 len is invalid
+ * @note      unlike syn6288_synthesis_text the buffer can hold 0x00 bytes such as unicode text
+ */
+uint8_t syn6288_synthesis_buffer(syn6288_handle_t *handle, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     stop the playing text and synthesis a new text buffer
+ * @param[in] *handle pointer to a syn6288 handle structure
+ * @param[in] *buf pointer to a text buffer encoded as the current text type
+ * @param[in] len text buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 barge in failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 len is invalid
+ * @note      the stop frame and the text frame are written back to back and both acks are checked
+ */
+uint8_t syn6288_barge_in_buffer(syn6288_handle_t *handle, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      get the command stats
+ * @param[in]  *handle pointer to a syn6288 handle structure
+ * @param[out] *stats pointer to a stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the time to first audio is the ack latency of the text frames,
+ *             the answers are polled every 1 ms, so the latency has a 1 ms resolution,
+ *             the playback duration is counted when a status poll finds the chip idle,
+ *             the histograms stay empty when no timestamp_ms is linked
+ */
+uint8_t syn6288_get_stats(syn6288_handle_t *handle, syn6288_stats_t *stats);
+
+/**
+ * @brief     reset the command stats
+ * @param[in] *handle pointer to a syn6288 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t syn6288_reset_stats(syn6288_handle_t *handle);
+
+/**
+ * @brief      calculate the xor checksum of a frame
+ * @param[in]  *buf pointer to a frame buffer
+ * @param[in]  len frame length without the checksum byte
+ * @param[out] *checksum pointer to a checksum buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 buf is NULL
+ * @note       the frames of the driver are built with this function
+ */
+uint8_t syn6288_frame_xor(uint8_t *buf, uint16_t len, uint8_t *checksum);
+
 /**
  * @}
  */
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_syn6288_log.h
+ * @brief     driver syn6288 log header file
+ * @version   2.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>2.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SYN6288_LOG_H
+#define DRIVER_SYN6288_LOG_H
+
+#include "driver_syn6288.h"
+
+/**
+ * @defgroup syn6288_log_driver syn6288 log driver function
+ * @brief    syn6288 log driver modules
+ * @ingroup  syn6288_driver
+ * @{
+ */
+
+/**
+ * @brief     print a debug text
+ * @param[in] HANDLE pointer to a syn6288 handle structure
+ * @param[in] TEXT constant text
+ * @note      the text is removed when SYN6288_LOG_TEXT is 0
+ */
+#if (SYN6288_LOG_TEXT == 1)
+    #define SYN6288_LOG_PRINT(HANDLE, TEXT)    do { if ((HANDLE)->debug_print != NULL) { (HANDLE)->debug_print(TEXT); } } while (0)
+#else
+    #define SYN6288_LOG_PRINT(HANDLE, TEXT)    do { } while (0)
+#endif
+
+/**
+ * @brief     send an event
+ * @param[in] HANDLE pointer to a syn6288 handle structure
+ * @param[in] CODE event code
+ * @param[in] COMMAND command opcode
+ * @param[in] VALUE event value
+ * @note      none
+ */
+#define SYN6288_LOG_EVENT(HANDLE, CODE, COMMAND, VALUE)    do { if ((HANDLE)->event != NULL) { (HANDLE)->event((uint8_t)(CODE), (uint8_t)(COMMAND), (uint32_t)(VALUE)); } } while (0)
+
+/**
+ * @brief     log an error
+ * @param[in] HANDLE pointer to a syn6288 handle structure
+ * @param[in] CODE event code
+ * @param[in] COMMAND command opcode
+ * @param[in] VALUE event value
+ * @param[in] TEXT constant text
+ * @note      removed when SYN6288_LOG_LEVEL is below SYN6288_LOG_LEVEL_ERROR
+ */
+#if (SYN6288_LOG_LEVEL >= SYN6288_LOG_LEVEL_ERROR)
+    #define SYN6288_LOG_ERROR(HANDLE, CODE, COMMAND, VALUE, TEXT)    do { SYN6288_LOG_EVENT(HANDLE, CODE, COMMAND, VALUE); SYN6288_LOG_PRINT(HANDLE, TEXT); } while (0)
+#else
+    #define SYN6288_LOG_ERROR(HANDLE, CODE, COMMAND, VALUE, TEXT)    do { (void)(COMMAND); (void)(VALUE); } while (0)
+#endif
+
+/**
+ * @brief     log a warning
+ * @param[in] HANDLE pointer to a syn6288 handle structure
+ * @param[in] CODE event code
+ * @param[in] COMMAND command opcode
+ * @param[in] VALUE event value
+ * @param[in] TEXT constant text
+ * @note      removed when SYN6288_LOG_LEVEL is below SYN6288_LOG_LEVEL_WARNING
+ */
+#if (SYN6288_LOG_LEVEL >= SYN6288_LOG_LEVEL_WARNING)
+    #define SYN6288_LOG_WARNING(HANDLE, CODE, COMMAND, VALUE, TEXT)    do { SYN6288_LOG_EVENT(HANDLE, CODE, COMMAND, VALUE); SYN6288_LOG_PRINT(HANDLE, TEXT); } while (0)
+#else
+    #define SYN6288_LOG_WARNING(HANDLE, CODE, COMMAND, VALUE, TEXT)    do { (void)(COMMAND); (void)(VALUE); } while (0)
+#endif
+
+/**
+ * @}
+ */
+
+#endif
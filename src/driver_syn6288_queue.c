@@ -0,0 +1,2880 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_syn6288_queue.c
+ * @brief     driver syn6288 queue source file
+ * @version   2.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>2.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_syn6288_queue.h"
+#include "driver_syn6288_log.h"
+#include "driver_syn6288_trace.h"
+
+/**
+ * @brief duration estimation definition
+ */
+#define SYN6288_QUEUE_SHORT_PAUSE_MS        150         /**< comma pause */
+#define SYN6288_QUEUE_LONG_PAUSE_MS         300         /**< full stop pause */
+#define SYN6288_QUEUE_SOUND_MS              600         /**< sound prompt duration */
+#define SYN6288_QUEUE_MESSAGE_MS            1500        /**< message prompt duration */
+#define SYN6288_QUEUE_RING_MS               3500        /**< ring prompt duration */
+
+/**
+ * @brief char class definition
+ */
+#define SYN6288_QUEUE_CLASS_SILENT          0x00        /**< silent char */
+#define SYN6288_QUEUE_CLASS_CHAR            0x01        /**< spoken char */
+#define SYN6288_QUEUE_CLASS_SHORT_PAUSE     0x02        /**< comma like punctuation */
+#define SYN6288_QUEUE_CLASS_LONG_PAUSE      0x03        /**< full stop like punctuation */
+
+/**
+ * @brief unknown chip setting definition
+ */
+#define SYN6288_QUEUE_UNKNOWN               0xFF        /**< unknown setting */
+
+/**
+ * @brief marks frame definition
+ */
+#define SYN6288_QUEUE_MARK_RETRY            10          /**< max status polls after a marks frame */
+#define SYN6288_QUEUE_MARK_INTERVAL         10          /**< status poll interval in ms */
+
+/**
+ * @brief spoken char duration at each speed, speed 0 is the slowest
+ */
+static const uint16_t gs_char_ms[6] =
+{
+    360, 320, 290, 260, 235, 210,
+};
+
+/**
+ * @brief      read one char from a text buffer
+ * @param[in]  type text type
+ * @param[in]  *buf pointer to a text buffer
+ * @param[in]  len text buffer length
+ * @param[in]  pos read position
+ * @param[out] *c pointer to a char buffer
+ * @return     read bytes, 0 means the end of the text
+ * @note       two bytes chars are returned as msb << 8 | lsb
+ */
+static uint16_t a_syn6288_queue_get_char(uint8_t type, uint8_t *buf, uint16_t len, uint16_t pos, uint16_t *c)
+{
+    if (pos >= len)                                                       /* check the end */
+    {
+        return 0;                                                         /* end of text */
+    }
+    if (type == SYN6288_TYPE_UNICODE)                                     /* unicode is always 2 bytes */
+    {
+        if ((pos + 1) >= len)                                             /* check the odd byte */
+        {
+            *c = 0;                                                       /* ignore the byte */
+
+            return 1;                                                     /* read 1 byte */
+        }
+        *c = (uint16_t)(((uint16_t)buf[pos] << 8) | buf[pos + 1]);        /* big endian */
+
+        return 2;                                                         /* read 2 bytes */
+    }
+    if ((buf[pos] >= 0x80) && ((pos + 1) < len))                          /* double bytes char */
+    {
+        *c = (uint16_t)(((uint16_t)buf[pos] << 8) | buf[pos + 1]);        /* set the char */
+
+        return 2;                                                         /* read 2 bytes */
+    }
+    *c = buf[pos];                                                        /* ascii char */
+
+    return 1;                                                             /* read 1 byte */
+}
+
+/**
+ * @brief     classify one char
+ * @param[in] type text type
+ * @param[in] c char
+ * @return    char class
+ * @note      none
+ */
+static uint8_t a_syn6288_queue_classify(uint8_t type, uint16_t c)
+{
+    if (c < 0x80)                                                                           /* ascii char */
+    {
+        if (((c >= '0') && (c <= '9')) || ((c >= 'a') && (c <= 'z')) ||
+            ((c >= 'A') && (c <= 'Z')))                                                     /* letters and numbers */
+        {
+            return SYN6288_QUEUE_CLASS_CHAR;                                                /* spoken char */
+        }
+        if ((c == ',') || (c == ';') || (c == ':'))                                         /* comma like */
+        {
+            return SYN6288_QUEUE_CLASS_SHORT_PAUSE;                                         /* short pause */
+        }
+        if ((c == '.') || (c == '!') || (c == '?') || (c == '\n'))                          /* full stop like */
+        {
+            return SYN6288_QUEUE_CLASS_LONG_PAUSE;                                          /* long pause */
+        }
+
+        return SYN6288_QUEUE_CLASS_SILENT;                                                  /* silent char */
+    }
+    if (type == SYN6288_TYPE_UNICODE)                                                       /* unicode */
+    {
+        if ((c == 0x3001) || (c == 0xFF0C) || (c == 0xFF1B) || (c == 0xFF1A))               /* 、，；： */
+        {
+            return SYN6288_QUEUE_CLASS_SHORT_PAUSE;                                         /* short pause */
+        }
+        if ((c == 0x3002) || (c == 0xFF01) || (c == 0xFF1F))                                /* 。！？ */
+        {
+            return SYN6288_QUEUE_CLASS_LONG_PAUSE;                                          /* long pause */
+        }
+        if (((c >= 0x3000) && (c <= 0x303F)) || ((c >= 0xFF00) && (c <= 0xFF0F)))          /* other punctuations */
+        {
+            return SYN6288_QUEUE_CLASS_SILENT;                                              /* silent char */
+        }
+
+        return SYN6288_QUEUE_CLASS_CHAR;                                                    /* spoken char */
+    }
+    if (type == SYN6288_TYPE_BIG5)                                                          /* big5 */
+    {
+        if ((c == 0xA141) || (c == 0xA142) || (c == 0xA146) || (c == 0xA147))               /* ，、；： */
+        {
+            return SYN6288_QUEUE_CLASS_SHORT_PAUSE;                                         /* short pause */
+        }
+        if ((c == 0xA143) || (c == 0xA148) || (c == 0xA149))                                /* 。？！ */
+        {
+            return SYN6288_QUEUE_CLASS_LONG_PAUSE;                                          /* long pause */
+        }
+        if ((c >> 8) <= 0xA3)                                                               /* symbol area */
+        {
+            return SYN6288_QUEUE_CLASS_SILENT;                                              /* silent char */
+        }
+
+        return SYN6288_QUEUE_CLASS_CHAR;                                                    /* spoken char */
+    }
+    if ((c == 0xA1A2) || (c == 0xA3AC) || (c == 0xA3BB) || (c == 0xA3BA))                   /* gb2312 、，；： */
+    {
+        return SYN6288_QUEUE_CLASS_SHORT_PAUSE;                                             /* short pause */
+    }
+    if ((c == 0xA1A3) || (c == 0xA3A1) || (c == 0xA3BF))                                    /* gb2312 。！？ */
+    {
+        return SYN6288_QUEUE_CLASS_LONG_PAUSE;                                              /* long pause */
+    }
+    if (((c >> 8) >= 0xA1) && ((c >> 8) <= 0xA9))                                           /* symbol area */
+    {
+        return SYN6288_QUEUE_CLASS_SILENT;                                                  /* silent char */
+    }
+
+    return SYN6288_QUEUE_CLASS_CHAR;                                                        /* spoken char */
+}
+
+/**
+ * @brief     check whether an ascii word starts at the position
+ * @param[in] type text type
+ * @param[in] *buf pointer to a text buffer
+ * @param[in] len text buffer length
+ * @param[in] pos start position
+ * @param[in] *word pointer to an ascii word
+ * @return    matched bytes, 0 means not matched
+ * @note      none
+ */
+static uint16_t a_syn6288_queue_match(uint8_t type, uint8_t *buf, uint16_t len, uint16_t pos, const char *word)
+{
+    uint16_t start;
+    uint16_t l;
+    uint16_t c;
+
+    start = pos;                                                               /* save the start */
+    while (*word != '\0')                                                      /* compare all chars */
+    {
+        l = a_syn6288_queue_get_char(type, buf, len, pos, &c);                 /* get the char */
+        if ((l == 0) || (c != (uint16_t)(uint8_t)(*word)))                     /* check the char */
+        {
+            return 0;                                                          /* not matched */
+        }
+        pos += l;                                                              /* next char */
+        word++;                                                                /* next word char */
+    }
+
+    return (uint16_t)(pos - start);                                            /* return matched bytes */
+}
+
+/**
+ * @brief     check whether a text ends with a pause
+ * @param[in] type text type
+ * @param[in] *buf pointer to a text buffer
+ * @param[in] len text buffer length
+ * @return    1 if the last char is a punctuation pause, otherwise 0
+ * @note      none
+ */
+static uint8_t a_syn6288_queue_ends_with_pause(uint8_t type, uint8_t *buf, uint16_t len)
+{
+    uint16_t c;
+    uint8_t cls;
+
+    if (len == 0)                                                                           /* check length */
+    {
+        return 0;                                                                           /* no pause */
+    }
+    if ((type == SYN6288_TYPE_UNICODE) || ((len > 1) && (buf[len - 2] >= 0x80)))           /* 2 bytes char */
+    {
+        if (len < 2)                                                                        /* check length */
+        {
+            return 0;                                                                       /* no pause */
+        }
+        c = (uint16_t)(((uint16_t)buf[len - 2] << 8) | buf[len - 1]);                       /* get the last char */
+    }
+    else
+    {
+        c = buf[len - 1];                                                                   /* get the last char */
+    }
+    cls = a_syn6288_queue_classify(type, c);                                                /* classify the char */
+
+    return ((cls == SYN6288_QUEUE_CLASS_SHORT_PAUSE) || (cls == SYN6288_QUEUE_CLASS_LONG_PAUSE)) ? 1 : 0;
+}
+
+/**
+ * @brief     check whether a text has inline marks
+ * @param[in] type text type
+ * @param[in] *buf pointer to a text buffer
+ * @param[in] len text buffer length
+ * @return    1 if the text has marks, otherwise 0
+ * @note      none
+ */
+static uint8_t a_syn6288_queue_has_mark(uint8_t type, uint8_t *buf, uint16_t len)
+{
+    uint16_t pos;
+    uint16_t l;
+    uint16_t c;
+
+    pos = 0;                                                                   /* init position */
+    while ((l = a_syn6288_queue_get_char(type, buf, len, pos, &c)) != 0)       /* read all chars */
+    {
+        if (c == '[')                                                          /* find the mark */
+        {
+            return 1;                                                          /* has mark */
+        }
+        pos += l;                                                              /* next char */
+    }
+
+    return 0;                                                                  /* no mark */
+}
+
+/**
+ * @brief     encode an inline setting mark
+ * @param[in] type text type
+ * @param[in] mark mark char
+ * @param[in] value mark value
+ * @param[in] *buf pointer to an output buffer
+ * @return    encoded length
+ * @note      the output buffer must hold at least 12 bytes
+ */
+static uint16_t a_syn6288_queue_encode_mark(uint8_t type, char mark, uint8_t value, uint8_t *buf)
+{
+    char s[8];
+    uint16_t len;
+    uint16_t i;
+
+    memset(s, 0, sizeof(char) * 8);                                           /* clear the buffer */
+    (void)snprintf(s, 8, "[%c%d]", mark, (int16_t)value);                      /* set the mark */
+    len = (uint16_t)strlen(s);                                                 /* get the length */
+    for (i = 0; i < len; i++)
+    {
+        if (type == SYN6288_TYPE_UNICODE)                                      /* unicode is 2 bytes big endian */
+        {
+            buf[i * 2 + 0] = 0x00;                                             /* set msb */
+            buf[i * 2 + 1] = (uint8_t)s[i];                                    /* set lsb */
+        }
+        else
+        {
+            buf[i] = (uint8_t)s[i];                                            /* set the char */
+        }
+    }
+
+    return (type == SYN6288_TYPE_UNICODE) ? (uint16_t)(len * 2) : len;         /* return the length */
+}
+
+/**
+ * @brief      walk through a text and estimate its playing time
+ * @param[in]  type text type
+ * @param[in]  speed synthesis speed
+ * @param[in]  *buf pointer to a text buffer
+ * @param[in]  len text buffer length
+ * @param[in]  limit elapsed playing time in ms
+ * @param[out] *boundary pointer to a segment boundary buffer
+ * @param[out] *segment pointer to a segment index buffer
+ * @return     estimated time in ms
+ * @note       the walk stops once the limit is passed, boundary is the start of
+ *             the last segment that began playing before the limit and segment is its index
+ */
+static uint32_t a_syn6288_queue_walk(uint8_t type, uint8_t speed, uint8_t *buf, uint16_t len,
+                                     uint32_t limit, uint16_t *boundary, uint16_t *segment)
+{
+    uint16_t pos;
+    uint16_t l;
+    uint16_t c;
+    uint16_t m;
+    uint8_t cls;
+    uint32_t total;
+
+    *boundary = 0;                                                                      /* first segment */
+    *segment = 0;                                                                       /* first index */
+    total = 0;                                                                          /* init 0 */
+    pos = 0;                                                                            /* init position */
+    while (1)
+    {
+        l = a_syn6288_queue_get_char(type, buf, len, pos, &c);                          /* get the char */
+        if (l == 0)                                                                     /* end of text */
+        {
+            break;                                                                      /* break */
+        }
+        if (c == '[')                                                                   /* inline mark */
+        {
+            uint16_t mark;
+            uint16_t value;
+            uint16_t n;
+
+            n = 0;                                                                      /* init 0 */
+            mark = 0;                                                                   /* init 0 */
+            value = 0xFFFF;                                                             /* no value */
+            pos += l;                                                                   /* skip '[' */
+            while (1)                                                                   /* find ']' */
+            {
+                l = a_syn6288_queue_get_char(type, buf, len, pos, &c);                  /* get the char */
+                if (l == 0)                                                             /* end of text */
+                {
+                    break;                                                              /* break */
+                }
+                pos += l;                                                               /* next char */
+                if (c == ']')                                                           /* end of mark */
+                {
+                    break;                                                              /* break */
+                }
+                if (n == 0)                                                             /* mark char */
+                {
+                    mark = c;                                                           /* save the mark */
+                }
+                else if ((c >= '0') && (c <= '9'))                                      /* mark value */
+                {
+                    value = (value == 0xFFFF) ? (uint16_t)(c - '0') : (uint16_t)(value * 10 + (c - '0'));
+                }
+                else
+                {
+
+                }
+                n++;                                                                    /* n++ */
+            }
+            if ((mark == 't') && (value <= 5))                                          /* speed mark */
+            {
+                speed = (uint8_t)value;                                                 /* update the speed */
+            }
+
+            continue;                                                                   /* continue */
+        }
+        if ((m = a_syn6288_queue_match(type, buf, len, pos, "sound")) != 0)             /* sound prompt */
+        {
+            total += SYN6288_QUEUE_SOUND_MS;                                            /* add the duration */
+            pos += m;                                                                   /* skip the name */
+            pos += a_syn6288_queue_get_char(type, buf, len, pos, &c);                   /* skip the index */
+
+            continue;                                                                   /* continue */
+        }
+        if ((m = a_syn6288_queue_match(type, buf, len, pos, "msg")) != 0)               /* message prompt */
+        {
+            total += SYN6288_QUEUE_MESSAGE_MS;                                          /* add the duration */
+            pos += m;                                                                   /* skip the name */
+            pos += a_syn6288_queue_get_char(type, buf, len, pos, &c);                   /* skip the index */
+
+            continue;                                                                   /* continue */
+        }
+        if ((m = a_syn6288_queue_match(type, buf, len, pos, "ring")) != 0)              /* ring prompt */
+        {
+            total += SYN6288_QUEUE_RING_MS;                                             /* add the duration */
+            pos += m;                                                                   /* skip the name */
+            pos += a_syn6288_queue_get_char(type, buf, len, pos, &c);                   /* skip the index */
+
+            continue;                                                                   /* continue */
+        }
+        cls = a_syn6288_queue_classify(type, c);                                        /* classify the char */
+        if (cls == SYN6288_QUEUE_CLASS_CHAR)                                            /* spoken char */
+        {
+            total += gs_char_ms[speed];                                                 /* add the char duration */
+        }
+        else if (cls == SYN6288_QUEUE_CLASS_SHORT_PAUSE)                                /* short pause */
+        {
+            total += SYN6288_QUEUE_SHORT_PAUSE_MS;                                      /* add the pause */
+        }
+        else if (cls == SYN6288_QUEUE_CLASS_LONG_PAUSE)                                 /* long pause */
+        {
+            total += SYN6288_QUEUE_LONG_PAUSE_MS;                                       /* add the pause */
+        }
+        else
+        {
+
+        }
+        pos += l;                                                                       /* next char */
+        if (total > limit)                                                              /* over the limit */
+        {
+            break;                                                                      /* break */
+        }
+        if ((cls == SYN6288_QUEUE_CLASS_SHORT_PAUSE) || (cls == SYN6288_QUEUE_CLASS_LONG_PAUSE))
+        {
+            *boundary = pos;                                                            /* a segment starts here */
+            (*segment)++;                                                               /* index++ */
+        }
+    }
+
+    return total;                                                                       /* return the time */
+}
+
+/**
+ * @brief     check whether the item is newer than another item
+ * @param[in] a item id
+ * @param[in] b item id
+ * @return    1 if a is before b, otherwise 0
+ * @note      id overflow is handled
+ */
+static uint8_t a_syn6288_queue_before(uint32_t a, uint32_t b)
+{
+    return ((int32_t)(a - b) < 0) ? 1 : 0;                                     /* compare with overflow */
+}
+
+/**
+ * @brief     check whether an item is scheduled before another item
+ * @param[in] *a pointer to an item
+ * @param[in] *b pointer to an item
+ * @return    1 if a is before b, otherwise 0
+ * @note      higher priority goes first, inside a priority items with a deadline go first
+ *            in deadline order and the others follow in push order
+ */
+static uint8_t a_syn6288_queue_first(syn6288_queue_item_t *a, syn6288_queue_item_t *b)
+{
+    if (a->priority != b->priority)                                                         /* different priority */
+    {
+        return (a->priority > b->priority) ? 1 : 0;                                         /* higher priority first */
+    }
+    if (a->deadline_valid != b->deadline_valid)                                            /* only one has a deadline */
+    {
+        return (a->deadline_valid != 0) ? 1 : 0;                                            /* deadline first */
+    }
+    if ((a->deadline_valid != 0) && (a->deadline != b->deadline))                           /* both have deadlines */
+    {
+        return ((int32_t)(a->deadline - b->deadline) < 0) ? 1 : 0;                          /* earliest deadline first */
+    }
+
+    return a_syn6288_queue_before(a->id, b->id);                                            /* push order */
+}
+
+/**
+ * @brief     find the next queued item
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @return    item slot, SYN6288_QUEUE_MAX_ITEM means no item
+ * @note      none
+ */
+static uint8_t a_syn6288_queue_next(syn6288_queue_t *queue)
+{
+    uint8_t i;
+    uint8_t slot;
+
+    slot = SYN6288_QUEUE_MAX_ITEM;                                                          /* no item */
+    for (i = 0; i < SYN6288_QUEUE_MAX_ITEM; i++)
+    {
+        if (queue->item[i].status != SYN6288_QUEUE_STATUS_QUEUED)                           /* skip */
+        {
+            continue;                                                                       /* continue */
+        }
+        if ((slot == SYN6288_QUEUE_MAX_ITEM) ||
+            (a_syn6288_queue_first(&queue->item[i], &queue->item[slot]) != 0))              /* scheduled earlier */
+        {
+            slot = i;                                                                       /* save the slot */
+        }
+    }
+
+    return slot;                                                                            /* return the slot */
+}
+
+/**
+ * @brief     drop a queued item
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] slot item slot
+ * @note      none
+ */
+static void a_syn6288_queue_drop(syn6288_queue_t *queue, uint8_t slot)
+{
+    queue->item[slot].status = SYN6288_QUEUE_STATUS_NONE;                                   /* free the slot */
+    queue->receive_callback(SYN6288_QUEUE_EVENT_DROP, queue->item[slot].id);                /* run the callback */
+}
+
+/**
+ * @brief     drop the items that are no longer worth playing
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @note      expired items are dropped first, then every item that would start after its
+ *            deadline either gets room by shedding lower value items in front of it or is dropped,
+ *            only items of the same or a lower priority are shed
+ */
+static void a_syn6288_queue_schedule(syn6288_queue_t *queue)
+{
+    uint8_t i;
+    uint8_t j;
+    uint8_t k;
+    uint8_t n;
+    uint8_t pick;
+    uint32_t now;
+    uint32_t t;
+    uint32_t excess;
+    uint32_t freed;
+    uint8_t order[SYN6288_QUEUE_MAX_ITEM];
+    uint8_t shed[SYN6288_QUEUE_MAX_ITEM];
+    syn6288_queue_item_t *item;
+
+    now = queue->timestamp_ms();                                                            /* get the time */
+    n = 0;                                                                                  /* init 0 */
+    for (i = 0; i < SYN6288_QUEUE_MAX_ITEM; i++)
+    {
+        item = &queue->item[i];                                                             /* set the item */
+        if (item->status != SYN6288_QUEUE_STATUS_QUEUED)                                    /* skip */
+        {
+            continue;                                                                       /* continue */
+        }
+        if ((item->expire_valid != 0) && ((int32_t)(now - item->expire) >= 0))              /* ttl is over */
+        {
+            a_syn6288_queue_drop(queue, i);                                                 /* drop the item */
+            queue->stats.expired++;                                                         /* expired++ */
+
+            continue;                                                                       /* continue */
+        }
+        j = n;                                                                              /* insert position */
+        while ((j > 0) && (a_syn6288_queue_first(item, &queue->item[order[j - 1]]) != 0))  /* insertion sort */
+        {
+            order[j] = order[j - 1];                                                        /* move back */
+            j--;                                                                            /* j-- */
+        }
+        order[j] = i;                                                                       /* insert the slot */
+        n++;                                                                                /* n++ */
+    }
+
+    t = now;                                                                                /* predicted start time */
+    for (k = 0; k < n; k++)
+    {
+        item = &queue->item[order[k]];                                                      /* set the item */
+        if (item->status != SYN6288_QUEUE_STATUS_QUEUED)                                    /* already shed */
+        {
+            continue;                                                                       /* continue */
+        }
+        if ((item->deadline_valid != 0) && ((int32_t)(t - item->deadline) > 0))             /* will miss the deadline */
+        {
+            excess = t - item->deadline;                                                    /* time to free */
+            freed = 0;                                                                      /* init 0 */
+            memset(shed, 0, sizeof(uint8_t) * SYN6288_QUEUE_MAX_ITEM);                      /* clear the flags */
+            while (freed < excess)                                                          /* lowest value first */
+            {
+                pick = SYN6288_QUEUE_MAX_ITEM;                                              /* no item */
+                for (j = 0; j < k; j++)
+                {
+                    if ((queue->item[order[j]].status != SYN6288_QUEUE_STATUS_QUEUED) ||
+                        (shed[j] != 0) || (queue->item[order[j]].value >= item->value) ||
+                        (queue->item[order[j]].priority > item->priority))                  /* not a candidate */
+                    {
+                        continue;                                                           /* continue */
+                    }
+                    if ((pick == SYN6288_QUEUE_MAX_ITEM) ||
+                        (queue->item[order[j]].value < queue->item[order[pick]].value))     /* lower value */
+                    {
+                        pick = j;                                                           /* save the candidate */
+                    }
+                }
+                if (pick == SYN6288_QUEUE_MAX_ITEM)                                         /* no candidate */
+                {
+                    break;                                                                  /* break */
+                }
+                shed[pick] = 1;                                                             /* flag the candidate */
+                freed += queue->item[order[pick]].duration + SYN6288_QUEUE_FRAME_OVERHEAD;  /* add the freed time */
+            }
+            if (freed < excess)                                                             /* can't make it */
+            {
+                a_syn6288_queue_drop(queue, order[k]);                                      /* drop the item */
+                queue->stats.missed++;                                                      /* missed++ */
+
+                continue;                                                                   /* continue */
+            }
+            for (j = 0; j < k; j++)
+            {
+                if (shed[j] != 0)                                                           /* flagged */
+                {
+                    a_syn6288_queue_drop(queue, order[j]);                                  /* shed the item */
+                    queue->stats.shed++;                                                    /* shed++ */
+                }
+            }
+            t -= freed;                                                                     /* move the start time */
+        }
+        t += item->duration + SYN6288_QUEUE_FRAME_OVERHEAD;                                 /* next start time */
+    }
+}
+
+/**
+ * @brief     check whether two items can share one frame
+ * @param[in] *a pointer to an item
+ * @param[in] *b pointer to an item
+ * @return    1 if compatible, otherwise 0
+ * @note      none
+ */
+static uint8_t a_syn6288_queue_compatible(syn6288_queue_item_t *a, syn6288_queue_item_t *b)
+{
+    if ((a->type != b->type) || (a->mode != b->mode) || (a->volume != b->volume) ||
+        (a->background_volume != b->background_volume) || (a->speed != b->speed) ||
+        (a->priority != b->priority) || (a->mark != 0) || (b->mark != 0))                                                   /* check settings */
+    {
+        return 0;                                                                           /* not compatible */
+    }
+
+    return 1;                                                                               /* compatible */
+}
+
+/**
+ * @brief     hash a text with its settings
+ * @param[in] *settings pointer to a settings buffer
+ * @param[in] *buf pointer to a text buffer
+ * @param[in] len text buffer length
+ * @return    fnv-1a hash
+ * @note      settings are text type, mode, volume, background volume and speed
+ */
+static uint32_t a_syn6288_queue_hash(uint8_t *settings, uint8_t *buf, uint16_t len)
+{
+    uint32_t hash;
+    uint16_t i;
+
+    hash = 0x811C9DC5U;                                            /* fnv offset basis */
+    for (i = 0; i < 5; i++)
+    {
+        hash = (hash ^ settings[i]) * 0x01000193U;                 /* fnv prime */
+    }
+    for (i = 0; i < len; i++)
+    {
+        hash = (hash ^ buf[i]) * 0x01000193U;                      /* fnv prime */
+    }
+
+    return hash;                                                   /* return the hash */
+}
+
+/**
+ * @brief     find a duplicate of a text
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] *settings pointer to a settings buffer
+ * @param[in] *buf pointer to a text buffer
+ * @param[in] len text buffer length
+ * @param[in] hash text hash
+ * @param[in] now current timestamp
+ * @return    item slot, SYN6288_QUEUE_MAX_ITEM means no duplicate
+ * @note      none
+ */
+static uint8_t a_syn6288_queue_find_duplicate(syn6288_queue_t *queue, uint8_t *settings,
+                                              uint8_t *buf, uint16_t len, uint32_t hash, uint32_t now)
+{
+    uint8_t i;
+    syn6288_queue_item_t *p;
+
+    for (i = 0; i < SYN6288_QUEUE_MAX_ITEM; i++)
+    {
+        p = &queue->item[i];                                                                /* set the item */
+        if ((p->status == SYN6288_QUEUE_STATUS_NONE) || (p->hash != hash) || (p->len != len))
+        {
+            continue;                                                                       /* continue */
+        }
+        if ((now - p->timestamp) >= queue->dedupe_window)                                   /* out of the window */
+        {
+            continue;                                                                       /* continue */
+        }
+        if ((p->type == settings[0]) && (p->mode == settings[1]) && (p->volume == settings[2]) &&
+            (p->background_volume == settings[3]) && (p->speed == settings[4]) &&
+            (memcmp(p->buf, buf, len) == 0))                                                /* same content */
+        {
+            return i;                                                                       /* return the slot */
+        }
+    }
+
+    return SYN6288_QUEUE_MAX_ITEM;                                                          /* no duplicate */
+}
+
+/**
+ * @brief     finish a playing item
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] slot item slot
+ * @note      none
+ */
+static void a_syn6288_queue_finish(syn6288_queue_t *queue, uint8_t slot)
+{
+    queue->item[slot].status = SYN6288_QUEUE_STATUS_NONE;                                   /* free the slot */
+    queue->receive_callback(SYN6288_QUEUE_EVENT_DONE, queue->item[slot].id);                /* run the callback */
+}
+
+/**
+ * @brief     get the backlog adaptive speed
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] speed configured speed
+ * @return    speed to play the next frame
+ * @note      every full backlog threshold of predicted drain time raises the speed by one step
+ */
+static uint8_t a_syn6288_queue_adapt_speed(syn6288_queue_t *queue, uint8_t speed)
+{
+    uint8_t i;
+    uint8_t depth;
+    uint32_t level;
+    uint32_t drain;
+
+    depth = 0;                                                                              /* init 0 */
+    drain = 0;                                                                              /* init 0 */
+    for (i = 0; i < SYN6288_QUEUE_MAX_ITEM; i++)
+    {
+        if (queue->item[i].status == SYN6288_QUEUE_STATUS_QUEUED)                           /* waiting item */
+        {
+            depth++;                                                                        /* depth++ */
+            drain += queue->item[i].duration;                                               /* add the duration */
+        }
+    }
+    level = (queue->backlog_threshold != 0) ? (drain / queue->backlog_threshold) : 0;       /* drain time level */
+    if ((depth >= SYN6288_QUEUE_MAX_ITEM) && (level == 0))                                  /* queue is full */
+    {
+        level = 1;                                                                          /* at least one step */
+    }
+    if (speed > 5)                                                                          /* check speed */
+    {
+        return speed;                                                                       /* keep the speed */
+    }
+    if (level > (uint32_t)(5 - speed))                                                      /* check the range */
+    {
+        level = (uint32_t)(5 - speed);                                                      /* limit to 5 */
+    }
+
+    return (uint8_t)(speed + level);                                                        /* return the speed */
+}
+
+/**
+ * @brief     get the item duration at a speed
+ * @param[in] *item pointer to an item
+ * @param[in] speed playing speed
+ * @return    estimated duration in ms
+ * @note      none
+ */
+static uint32_t a_syn6288_queue_duration(syn6288_queue_item_t *item, uint8_t speed)
+{
+    uint32_t ms;
+
+    if ((speed == item->speed) || (speed > 5))                                              /* configured speed */
+    {
+        return item->duration;                                                              /* saved estimation */
+    }
+    if (syn6288_queue_estimate_duration((syn6288_type_t)item->type, speed,
+                                        item->buf, item->len, &ms) != 0)                    /* estimate */
+    {
+        return item->duration;                                                              /* saved estimation */
+    }
+
+    return ms;                                                                              /* return the duration */
+}
+
+/**
+ * @brief     check the result of a chip transaction
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] res transaction result
+ * @param[in] start transaction start timestamp in ms
+ * @return    the transaction result
+ * @note      counts the consecutive failures and averages the latency of the successful transactions
+ */
+static uint8_t a_syn6288_queue_check(syn6288_queue_t *queue, uint8_t res, uint32_t start)
+{
+    uint32_t latency;
+
+    if (res != 0)                                                                           /* failed */
+    {
+        if (queue->failures < 0xFF)                                                         /* check the max */
+        {
+            queue->failures++;                                                              /* failures++ */
+        }
+        queue->stats.link_failures++;                                                       /* link failures++ */
+
+        return res;                                                                         /* return the result */
+    }
+    latency = queue->timestamp_ms() - start;                                                /* get the latency */
+    queue->failures = 0;                                                                    /* clear the failures */
+    if (queue->stats.latency == 0)                                                          /* first latency */
+    {
+        queue->stats.latency = latency;                                                     /* set the latency */
+    }
+    else
+    {
+        queue->stats.latency = (queue->stats.latency * 7 + latency) / 8;                   /* average the latency */
+    }
+    if (latency > queue->stats.latency_max)                                                 /* check the max */
+    {
+        queue->stats.latency_max = latency;                                                 /* save the max */
+    }
+    if ((queue->latency_limit != 0) && (queue->stats.latency > queue->latency_limit))       /* latency is too high */
+    {
+        queue->degraded = 1;                                                                /* flag degraded */
+    }
+
+    return res;                                                                             /* return the result */
+}
+
+/**
+ * @brief     wait until the chip has taken a marks frame
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 wait failed
+ * @note      a marks frame plays nothing, so the chip is idle again after a few polls
+ */
+static uint8_t a_syn6288_queue_wait_marks(syn6288_queue_t *queue)
+{
+    uint8_t res;
+    uint8_t i;
+    uint32_t start;
+    syn6288_status_t status;
+
+    for (i = 0; i < SYN6288_QUEUE_MARK_RETRY; i++)
+    {
+        start = queue->timestamp_ms();                                                      /* get the start time */
+        res = syn6288_get_status(queue->handle, &status);                                   /* get status */
+        res = a_syn6288_queue_check(queue, res, start);                                     /* check the result */
+        if (res != 0)                                                                       /* check result */
+        {
+            return 1;                                                                       /* return error */
+        }
+        if (status == SYN6288_STATUS_OK)                                                    /* marks are taken */
+        {
+            return 0;                                                                       /* success return 0 */
+        }
+        queue->handle->delay_ms(SYN6288_QUEUE_MARK_INTERVAL);                               /* delay the interval */
+    }
+    SYN6288_LOG_ERROR(queue->handle, SYN6288_EVENT_IDLE_TIMEOUT, SYN6288_OPCODE_STATUS, i, "syn6288: queue wait marks timeout.\n"); /* wait marks timeout */
+
+    return 1;                                                                               /* return error */
+}
+
+/**
+ * @brief     send the next frame
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] barge_in stop the playing frame in the same transaction
+ * @return    status code
+ *            - 0 success
+ *            - 1 send failed
+ * @note      marks that don't fit in front of the text are sent in a frame of their own,
+ *            the text frame follows once the chip is idle again
+ */
+static uint8_t a_syn6288_queue_dispatch(syn6288_queue_t *queue, uint8_t barge_in)
+{
+    uint8_t res;
+    uint8_t slot;
+    uint8_t i;
+    uint8_t type;
+    uint8_t mode;
+    uint8_t speed;
+    uint16_t pos;
+    uint16_t sep_len;
+    uint32_t offset;
+    uint32_t start;
+    uint8_t sep[2];
+    syn6288_queue_item_t *first;
+    syn6288_queue_item_t *item;
+
+    slot = a_syn6288_queue_next(queue);                                                     /* get the next item */
+    if (slot == SYN6288_QUEUE_MAX_ITEM)                                                     /* no item */
+    {
+        return 0;                                                                           /* success return 0 */
+    }
+    first = &queue->item[slot];                                                             /* set the first item */
+    speed = first->speed;                                                                   /* configured speed */
+    if ((queue->adaptive != 0) && (first->mark == 0))                                       /* backlog adaptive speed */
+    {
+        speed = a_syn6288_queue_adapt_speed(queue, first->speed);                           /* adapt the speed */
+    }
+
+    pos = 0;                                                                                /* init position */
+    if (first->volume != queue->volume)                                                     /* volume changed */
+    {
+        pos += a_syn6288_queue_encode_mark(first->type, 'v', first->volume, &queue->frame[pos]);
+    }
+    if (first->background_volume != queue->background_volume)                               /* background volume changed */
+    {
+        pos += a_syn6288_queue_encode_mark(first->type, 'm', first->background_volume, &queue->frame[pos]);
+    }
+    if (speed != queue->speed)                                                              /* speed changed */
+    {
+        pos += a_syn6288_queue_encode_mark(first->type, 't', speed, &queue->frame[pos]);
+    }
+    type = queue->handle->type;                                                             /* save the text type */
+    mode = queue->handle->mode;                                                             /* save the mode */
+    queue->handle->type = first->type;                                                      /* set the item text type */
+    queue->handle->mode = first->mode;                                                      /* set the item mode */
+    if ((pos + first->len) > SYN6288_QUEUE_MAX_LEN)                                         /* marks don't fit */
+    {
+        start = queue->timestamp_ms();                                                      /* get the start time */
+        if (barge_in != 0)                                                                  /* stop and send */
+        {
+            res = syn6288_barge_in_buffer(queue->handle, queue->frame, pos);                /* barge in with the marks */
+            barge_in = 0;                                                                   /* chip stopped */
+        }
+        else
+        {
+            res = syn6288_synthesis_buffer(queue->handle, queue->frame, pos);               /* send the marks alone */
+        }
+        res = a_syn6288_queue_check(queue, res, start);                                     /* check the result */
+        if (res == 0)                                                                       /* check result */
+        {
+            res = a_syn6288_queue_wait_marks(queue);                                        /* wait before the text frame */
+        }
+        if (res != 0)                                                                       /* check result */
+        {
+            queue->handle->type = type;                                                     /* restore the text type */
+            queue->handle->mode = mode;                                                     /* restore the mode */
+
+            return 1;                                                                       /* return error */
+        }
+        pos = 0;                                                                            /* reset position */
+    }
+    memcpy(&queue->frame[pos], first->buf, first->len);                                     /* copy the text */
+    pos += first->len;                                                                      /* position += len */
+    first->status = SYN6288_QUEUE_STATUS_PLAYING;                                           /* set playing */
+    queue->playing_num = 1;                                                                 /* one item */
+    queue->playing_done = 0;                                                                /* nothing finished */
+    queue->playing_slot[0] = slot;                                                          /* save the slot */
+    offset = a_syn6288_queue_duration(first, speed);                                        /* set the end offset */
+    queue->playing_offset[0] = offset;                                                      /* save the offset */
+
+    if (first->type == SYN6288_TYPE_UNICODE)                                                /* unicode separator */
+    {
+        sep[0] = 0x00;                                                                      /* set msb */
+        sep[1] = ',';                                                                       /* set lsb */
+        sep_len = 2;                                                                        /* 2 bytes */
+    }
+    else
+    {
+        sep[0] = ',';                                                                       /* set the separator */
+        sep_len = 1;                                                                        /* 1 byte */
+    }
+    while (queue->coalesce != 0)                                                            /* merge the following items */
+    {
+        slot = a_syn6288_queue_next(queue);                                                 /* get the next item */
+        if (slot == SYN6288_QUEUE_MAX_ITEM)                                                 /* no item */
+        {
+            break;                                                                          /* break */
+        }
+        item = &queue->item[slot];                                                          /* set the item */
+        if ((a_syn6288_queue_compatible(first, item) == 0) ||
+            ((pos + sep_len + item->len) > SYN6288_QUEUE_MAX_LEN))                          /* check the item */
+        {
+            break;                                                                          /* break */
+        }
+        if (a_syn6288_queue_ends_with_pause(first->type, &queue->frame[0], pos) == 0)       /* no pause at the end */
+        {
+            memcpy(&queue->frame[pos], sep, sep_len);                                       /* keep a pause between items */
+            pos += sep_len;                                                                 /* position += sep_len */
+            offset += SYN6288_QUEUE_SHORT_PAUSE_MS;                                         /* add the pause */
+        }
+        memcpy(&queue->frame[pos], item->buf, item->len);                                   /* copy the text */
+        pos += item->len;                                                                   /* position += len */
+        item->status = SYN6288_QUEUE_STATUS_PLAYING;                                        /* set playing */
+        offset += a_syn6288_queue_duration(item, speed);                                    /* set the end offset */
+        queue->playing_slot[queue->playing_num] = slot;                                     /* save the slot */
+        queue->playing_offset[queue->playing_num] = offset;                                 /* save the offset */
+        queue->playing_num++;                                                               /* item number++ */
+    }
+
+    start = queue->timestamp_ms();                                                          /* get the start time */
+    if (barge_in != 0)                                                                      /* stop and send */
+    {
+        res = syn6288_barge_in_buffer(queue->handle, queue->frame, pos);                    /* barge in with the frame */
+    }
+    else
+    {
+        res = syn6288_synthesis_buffer(queue->handle, queue->frame, pos);                   /* send the frame */
+    }
+    res = a_syn6288_queue_check(queue, res, start);                                         /* check the result */
+    queue->handle->type = type;                                                             /* restore the text type */
+    queue->handle->mode = mode;                                                             /* restore the mode */
+    if (res != 0)                                                                           /* check result */
+    {
+        for (i = 0; i < queue->playing_num; i++)
+        {
+            queue->item[queue->playing_slot[i]].status = SYN6288_QUEUE_STATUS_QUEUED;      /* keep the items */
+        }
+        queue->playing_num = 0;                                                             /* no playing item */
+
+        return 1;                                                                           /* return error */
+    }
+    if (first->mark != 0)                                                                   /* marks in the text */
+    {
+        queue->volume = SYN6288_QUEUE_UNKNOWN;                                              /* unknown volume */
+        queue->background_volume = SYN6288_QUEUE_UNKNOWN;                                   /* unknown background volume */
+        queue->speed = SYN6288_QUEUE_UNKNOWN;                                               /* unknown speed */
+    }
+    else
+    {
+        queue->volume = first->volume;                                                      /* save the volume */
+        queue->background_volume = first->background_volume;                                /* save the background volume */
+        queue->speed = speed;                                                               /* save the speed */
+    }
+    if (speed != queue->rate)                                                               /* rate changed */
+    {
+        queue->rate = speed;                                                                /* save the rate */
+        queue->stats.rate_changes++;                                                        /* rate changes++ */
+    }
+    if (speed != first->speed)                                                              /* boosted frame */
+    {
+        queue->stats.rate_boosted++;                                                        /* boosted frames++ */
+    }
+    queue->playing_speed = speed;                                                           /* save the frame speed */
+    queue->playing_start = queue->timestamp_ms();                                           /* save the start time */
+    queue->journal.id = first->id;                                                          /* journal the first item */
+    queue->journal.segment = 0;                                                             /* first segment */
+    queue->journal.pos = 0;                                                                 /* text start */
+    queue->journal.offset = 0;                                                              /* no offset */
+    queue->journal.valid = 1;                                                               /* set valid */
+    queue->poll_timestamp = queue->playing_start + offset;                                  /* poll after the estimation */
+    queue->receive_callback(SYN6288_QUEUE_EVENT_START, first->id);                          /* run the callback */
+
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     drop the played segments of an item
+ * @param[in] *item pointer to a syn6288 queue item structure
+ * @param[in] pos start of the first unplayed segment
+ * @note      the hash and the duration are computed again
+ */
+static void a_syn6288_queue_trim(syn6288_queue_item_t *item, uint16_t pos)
+{
+    uint8_t settings[5];
+
+    memmove(item->buf, &item->buf[pos], item->len - pos);                                   /* move the text */
+    item->len = (uint16_t)(item->len - pos);                                                /* set the length */
+    settings[0] = item->type;                                                               /* text type */
+    settings[1] = item->mode;                                                               /* mode */
+    settings[2] = item->volume;                                                             /* volume */
+    settings[3] = item->background_volume;                                                  /* background volume */
+    settings[4] = item->speed;                                                              /* speed */
+    item->hash = a_syn6288_queue_hash(settings, item->buf, item->len);                      /* hash the text */
+    if (syn6288_queue_estimate_duration((syn6288_type_t)item->type,
+                                        (item->speed > 5) ? 5 : item->speed,
+                                        item->buf, item->len, &item->duration) != 0)
+    {
+        item->duration = 0;                                                                 /* no estimation */
+    }
+}
+
+/**
+ * @brief     interrupt the playing frame for a higher priority item
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 preempt failed
+ * @note      the interrupted item is queued again from the start of the segment being played,
+ *            the merged items that didn't start are queued again unchanged,
+ *            the chip is stopped by the barge in of the next frame
+ */
+static uint8_t a_syn6288_queue_preempt(syn6288_queue_t *queue)
+{
+    uint8_t k;
+    uint16_t pos;
+    uint16_t segment;
+    uint32_t elapsed;
+    uint32_t start;
+    syn6288_queue_item_t *item;
+
+    elapsed = queue->timestamp_ms() - queue->playing_start;                                 /* get the elapsed time */
+    for (k = queue->playing_done; k < queue->playing_num; k++)
+    {
+        item = &queue->item[queue->playing_slot[k]];                                        /* set the item */
+        if (k != queue->playing_done)                                                       /* not started */
+        {
+            item->status = SYN6288_QUEUE_STATUS_QUEUED;                                     /* queue again */
+
+            continue;                                                                       /* continue */
+        }
+        start = (k == 0) ? 0 : queue->playing_offset[k - 1];                                /* item start offset */
+        (void)a_syn6288_queue_walk(item->type, queue->playing_speed, item->buf, item->len,
+                                   (elapsed > start) ? (elapsed - start) : 0,
+                                   &pos, &segment);                                         /* find the segment */
+        if (pos >= item->len)                                                               /* nothing left */
+        {
+            a_syn6288_queue_finish(queue, queue->playing_slot[k]);                          /* finish the item */
+
+            continue;                                                                       /* continue */
+        }
+        if (pos != 0)                                                                       /* drop the played segments */
+        {
+            a_syn6288_queue_trim(item, pos);                                                /* trim the item */
+        }
+        item->status = SYN6288_QUEUE_STATUS_QUEUED;                                         /* queue again */
+        queue->stats.preempted++;                                                           /* preempted++ */
+        queue->receive_callback(SYN6288_QUEUE_EVENT_PREEMPT, item->id);                     /* run the callback */
+    }
+    queue->playing_num = 0;                                                                 /* no playing item */
+
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     write the journal of the playing frame
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] now current timestamp in ms
+ * @note      the journal keeps the playing item, the index and start of the segment being played
+ *            and the estimated offset inside the item
+ */
+static void a_syn6288_queue_journal(syn6288_queue_t *queue, uint32_t now)
+{
+    uint32_t elapsed;
+    uint32_t start;
+    syn6288_queue_item_t *item;
+
+    if (queue->playing_num == 0)                                                            /* nothing playing */
+    {
+        queue->journal.valid = 0;                                                           /* clear the journal */
+
+        return;                                                                             /* return */
+    }
+    item = &queue->item[queue->playing_slot[queue->playing_done]];                          /* set the item */
+    start = (queue->playing_done == 0) ? 0 : queue->playing_offset[queue->playing_done - 1];
+    elapsed = now - queue->playing_start;                                                   /* get the elapsed time */
+    elapsed = (elapsed > start) ? (elapsed - start) : 0;                                    /* offset in the item */
+    (void)a_syn6288_queue_walk(item->type, queue->playing_speed, item->buf, item->len,
+                               elapsed, &queue->journal.pos, &queue->journal.segment);      /* find the segment */
+    queue->journal.id = item->id;                                                           /* save the id */
+    queue->journal.offset = elapsed;                                                        /* save the offset */
+    queue->journal.valid = 1;                                                               /* set valid */
+}
+
+/**
+ * @brief     queue the in-flight items again after a reset
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @note      the journaled item resumes from its last unplayed segment,
+ *            the other items are submitted again unchanged
+ */
+static void a_syn6288_queue_resume(syn6288_queue_t *queue)
+{
+    uint8_t k;
+    syn6288_queue_item_t *item;
+
+    for (k = queue->playing_done; k < queue->playing_num; k++)
+    {
+        item = &queue->item[queue->playing_slot[k]];                                        /* set the item */
+        if ((queue->journal.valid != 0) && (queue->journal.id == item->id) &&
+            (queue->journal.pos != 0) && (queue->journal.pos < item->len))                  /* journaled item */
+        {
+            a_syn6288_queue_trim(item, queue->journal.pos);                                 /* trim the item */
+            queue->stats.resumed++;                                                         /* resumed++ */
+        }
+        item->status = SYN6288_QUEUE_STATUS_QUEUED;                                         /* submit again */
+        queue->stats.resubmitted++;                                                         /* resubmitted++ */
+    }
+    queue->playing_num = 0;                                                                 /* no playing item */
+    queue->journal.valid = 0;                                                               /* clear the journal */
+}
+
+/**
+ * @brief     update the playing items
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 update failed
+ * @note      none
+ */
+static uint8_t a_syn6288_queue_update(syn6288_queue_t *queue)
+{
+    uint8_t res;
+    uint32_t now;
+    uint32_t elapsed;
+    syn6288_status_t status;
+
+    now = queue->timestamp_ms();                                                            /* get the time */
+    elapsed = now - queue->playing_start;                                                   /* get the elapsed time */
+    while (((queue->playing_done + 1) < queue->playing_num) &&
+           (elapsed >= queue->playing_offset[queue->playing_done]))                         /* merged items by estimation */
+    {
+        a_syn6288_queue_finish(queue, queue->playing_slot[queue->playing_done]);            /* finish the item */
+        queue->playing_done++;                                                              /* done++ */
+        queue->receive_callback(SYN6288_QUEUE_EVENT_START,
+                                queue->item[queue->playing_slot[queue->playing_done]].id);  /* start the next item */
+    }
+    if (queue->failures == 0)                                                               /* link is healthy */
+    {
+        a_syn6288_queue_journal(queue, now);                                                /* write the journal */
+    }
+    if ((int32_t)(now - queue->poll_timestamp) < 0)                                         /* not the poll time */
+    {
+        return 0;                                                                           /* success return 0 */
+    }
+
+    res = syn6288_get_status(queue->handle, &status);                                       /* get status */
+    res = a_syn6288_queue_check(queue, res, now);                                           /* check the result */
+    if (res != 0)                                                                           /* check result */
+    {
+        queue->poll_timestamp = now + SYN6288_QUEUE_POLL_INTERVAL;                          /* poll later */
+
+        return 1;                                                                           /* return error */
+    }
+    if (status == SYN6288_STATUS_BUSY)                                                      /* still playing */
+    {
+        queue->poll_timestamp = now + SYN6288_QUEUE_POLL_INTERVAL;                          /* poll later */
+
+        return 0;                                                                           /* success return 0 */
+    }
+    while (queue->playing_done < queue->playing_num)                                        /* finish all items */
+    {
+        a_syn6288_queue_finish(queue, queue->playing_slot[queue->playing_done]);            /* finish the item */
+        queue->playing_done++;                                                              /* done++ */
+        if (queue->playing_done < queue->playing_num)                                       /* not the last one */
+        {
+            queue->receive_callback(SYN6288_QUEUE_EVENT_START,
+                                    queue->item[queue->playing_slot[queue->playing_done]].id);
+        }
+    }
+    queue->playing_num = 0;                                                                 /* no playing item */
+    queue->journal.valid = 0;                                                               /* clear the journal */
+
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     count the time spent in the current power state
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] now current timestamp in ms
+ * @note      none
+ */
+static void a_syn6288_queue_account(syn6288_queue_t *queue, uint32_t now)
+{
+    if (queue->power == SYN6288_QUEUE_POWER_DOWN)                                           /* powered down */
+    {
+        queue->stats.time_down += now - queue->power_timestamp;                             /* add the down time */
+    }
+    else
+    {
+        queue->stats.time_on += now - queue->power_timestamp;                               /* add the on time */
+    }
+    queue->power_timestamp = now;                                                           /* save the time */
+}
+
+/**
+ * @brief      get the timestamp of the expected work
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *timestamp pointer to a timestamp buffer
+ * @return     1 if work is expected, 0 if not
+ * @note       the scheduled wake time is used first, then the push interval prediction
+ */
+static uint8_t a_syn6288_queue_expected(syn6288_queue_t *queue, uint32_t *timestamp)
+{
+    if (queue->wake_valid != 0)                                                             /* scheduled announcement */
+    {
+        *timestamp = queue->wake_timestamp;                                                 /* set the wake time */
+
+        return 1;                                                                           /* expected */
+    }
+    if (queue->push_interval != 0)                                                          /* push history */
+    {
+        *timestamp = queue->push_timestamp + queue->push_interval;                          /* predict the next push */
+
+        return 1;                                                                           /* expected */
+    }
+
+    return 0;                                                                               /* not expected */
+}
+
+/**
+ * @brief     wake up the chip
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] now current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 wake up failed
+ * @note      the settings sent to the chip are marked unknown, so the next frame restores them
+ */
+static uint8_t a_syn6288_queue_wake(syn6288_queue_t *queue, uint32_t now)
+{
+    uint32_t latency;
+
+    if (a_syn6288_queue_check(queue, syn6288_wake_up(queue->handle), now) != 0)            /* wake up the chip */
+    {
+        return 1;                                                                           /* return error */
+    }
+    latency = queue->timestamp_ms() - now;                                                  /* get the latency */
+    a_syn6288_queue_account(queue, now);                                                    /* count the down time */
+    queue->power = SYN6288_QUEUE_POWER_ON;                                                  /* powered on */
+    queue->idle_timestamp = now;                                                            /* restart the idle time */
+    queue->volume = SYN6288_QUEUE_UNKNOWN;                                                  /* restore the volume */
+    queue->background_volume = SYN6288_QUEUE_UNKNOWN;                                       /* restore the background volume */
+    queue->speed = SYN6288_QUEUE_UNKNOWN;                                                   /* restore the speed */
+    queue->stats.wakes++;                                                                   /* wakes++ */
+    queue->stats.wake_latency = latency;                                                    /* save the latency */
+    if (latency > queue->stats.wake_latency_max)                                            /* check the max */
+    {
+        queue->stats.wake_latency_max = latency;                                            /* save the max */
+    }
+
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     manage the chip power
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] now current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 power switch failed
+ * @note      the chip is powered down after the idle time unless work is expected inside the pre-wake time,
+ *            a powered down chip is woken for a queued item or ahead of the expected work
+ */
+static uint8_t a_syn6288_queue_power(syn6288_queue_t *queue, uint32_t now)
+{
+    uint8_t expected;
+    uint32_t timestamp = 0;
+
+    expected = a_syn6288_queue_expected(queue, &timestamp);                                 /* get the expected work */
+    if (queue->power == SYN6288_QUEUE_POWER_DOWN)                                           /* powered down */
+    {
+        if (a_syn6288_queue_next(queue) != SYN6288_QUEUE_MAX_ITEM)                          /* queued item */
+        {
+            return a_syn6288_queue_wake(queue, now);                                        /* wake up */
+        }
+        if ((queue->prewake != 0) && (expected != 0) &&
+            ((int32_t)(timestamp - queue->down_timestamp) > 0) &&
+            ((int32_t)(timestamp - now) <= (int32_t)queue->prewake))                        /* expected work is close */
+        {
+            if (a_syn6288_queue_wake(queue, now) != 0)                                      /* wake up */
+            {
+                return 1;                                                                   /* return error */
+            }
+            queue->wake_valid = 0;                                                          /* wake time is used */
+            queue->stats.prewakes++;                                                        /* prewakes++ */
+        }
+
+        return 0;                                                                           /* success return 0 */
+    }
+
+    if ((queue->playing_num != 0) || (a_syn6288_queue_next(queue) != SYN6288_QUEUE_MAX_ITEM))
+    {
+        queue->idle_timestamp = now;                                                        /* busy */
+
+        return 0;                                                                           /* success return 0 */
+    }
+    if ((queue->idle_time == 0) || ((now - queue->idle_timestamp) < queue->idle_time))      /* not idle long enough */
+    {
+        return 0;                                                                           /* success return 0 */
+    }
+    if ((queue->prewake != 0) && (expected != 0) &&
+        ((int32_t)(timestamp - now) > 0) &&
+        ((int32_t)(timestamp - now) <= (int32_t)queue->prewake))                            /* expected work is close */
+    {
+        return 0;                                                                           /* success return 0 */
+    }
+    if (a_syn6288_queue_check(queue, syn6288_power_down(queue->handle), now) != 0)         /* power down */
+    {
+        return 1;                                                                           /* return error */
+    }
+    a_syn6288_queue_account(queue, now);                                                    /* count the on time */
+    queue->power = SYN6288_QUEUE_POWER_DOWN;                                                /* powered down */
+    queue->down_timestamp = now;                                                            /* save the time */
+    queue->stats.power_downs++;                                                             /* power downs++ */
+
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     recover the link and the chip
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] now current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 recover failed
+ * @note      flushes and reopens the uart, probes the chip until it acks, marks the settings
+ *            unknown so the next frame restores them and resumes the in-flight items from the journal
+ */
+static uint8_t a_syn6288_queue_recover(syn6288_queue_t *queue, uint32_t now)
+{
+    uint8_t res;
+    uint32_t elapsed;
+
+    res = queue->handle->uart_flush();                                                      /* uart flush */
+    (void)queue->handle->uart_deinit();                                                     /* uart deinit */
+    res |= queue->handle->uart_init();                                                      /* uart init */
+    if (res == 0)                                                                           /* uart is open */
+    {
+        res = syn6288_wake_up(queue->handle);                                               /* probe the chip */
+    }
+    if (res != 0)                                                                           /* check result */
+    {
+        queue->recover_timestamp = now + SYN6288_QUEUE_RECOVER_INTERVAL;                    /* retry later */
+        queue->stats.recovery_failures++;                                                   /* recovery failures++ */
+
+        return 1;                                                                           /* return error */
+    }
+    if (queue->power == SYN6288_QUEUE_POWER_DOWN)                                           /* the probe wakes the chip */
+    {
+        a_syn6288_queue_account(queue, now);                                                /* count the down time */
+        queue->power = SYN6288_QUEUE_POWER_ON;                                              /* powered on */
+    }
+    queue->volume = SYN6288_QUEUE_UNKNOWN;                                                  /* restore the volume */
+    queue->background_volume = SYN6288_QUEUE_UNKNOWN;                                       /* restore the background volume */
+    queue->speed = SYN6288_QUEUE_UNKNOWN;                                                   /* restore the speed */
+    a_syn6288_queue_resume(queue);                                                          /* resume the in-flight items */
+    queue->failures = 0;                                                                    /* clear the failures */
+    queue->degraded = 0;                                                                    /* clear the flag */
+    queue->stats.latency = 0;                                                               /* restart the average */
+    queue->idle_timestamp = now;                                                            /* restart the idle time */
+    elapsed = queue->timestamp_ms() - now;                                                  /* get the recovery time */
+    queue->stats.recoveries++;                                                              /* recoveries++ */
+    queue->stats.recovery_time = elapsed;                                                   /* save the time */
+    if (elapsed > queue->stats.recovery_time_max)                                           /* check the max */
+    {
+        queue->stats.recovery_time_max = elapsed;                                           /* save the max */
+    }
+
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     initialize the queue
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] *handle pointer to an initialized syn6288 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 handle is invalid
+ * @note      none
+ */
+uint8_t syn6288_queue_init(syn6288_queue_t *queue, syn6288_handle_t *handle)
+{
+    uint8_t i;
+
+    if (queue == NULL)                                                          /* check queue */
+    {
+        return 2;                                                               /* return error */
+    }
+    if ((handle == NULL) || (handle->inited != 1))                              /* check handle */
+    {
+        return 4;                                                               /* return error */
+    }
+    if (queue->timestamp_ms == NULL)                                            /* check timestamp_ms */
+    {
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_LINK_NULL, SYN6288_OPCODE_NUM, SYN6288_LINK_TIMESTAMP_MS, "syn6288: timestamp_ms is null.\n"); /* timestamp_ms is null */
+
+        return 3;                                                               /* return error */
+    }
+    if (queue->receive_callback == NULL)                                        /* check receive_callback */
+    {
+        SYN6288_LOG_ERROR(handle, SYN6288_EVENT_LINK_NULL, SYN6288_OPCODE_NUM, SYN6288_LINK_RECEIVE_CALLBACK, "syn6288: receive_callback is null.\n"); /* receive_callback is null */
+
+        return 3;                                                               /* return error */
+    }
+
+    queue->handle = handle;                                                     /* save the handle */
+    for (i = 0; i < SYN6288_QUEUE_MAX_ITEM; i++)
+    {
+        queue->item[i].status = SYN6288_QUEUE_STATUS_NONE;                      /* clear the slot */
+    }
+    queue->id = 1;                                                              /* first id */
+    queue->volume = handle->volume;                                             /* chip volume */
+    queue->background_volume = handle->background_volume;                       /* chip background volume */
+    queue->speed = handle->speed;                                               /* chip speed */
+    queue->rate = handle->speed;                                                /* last frame speed */
+    queue->backlog_threshold = SYN6288_QUEUE_BACKLOG_THRESHOLD;                 /* default backlog threshold */
+    queue->value = SYN6288_QUEUE_DEFAULT_VALUE;                                 /* default value */
+    queue->priority = SYN6288_QUEUE_PRIORITY_NORMAL;                            /* default priority */
+    queue->item_volume = SYN6288_QUEUE_SETTING_HANDLE;                          /* handle volume */
+    queue->item_background_volume = SYN6288_QUEUE_SETTING_HANDLE;               /* handle background volume */
+    queue->item_speed = SYN6288_QUEUE_SETTING_HANDLE;                           /* handle speed */
+    queue->fail_threshold = SYN6288_QUEUE_FAIL_THRESHOLD;                       /* default failure threshold */
+    queue->playing_num = 0;                                                     /* no playing item */
+    queue->playing_done = 0;                                                    /* nothing finished */
+    queue->power = SYN6288_QUEUE_POWER_ON;                                      /* powered on */
+    queue->power_timestamp = queue->timestamp_ms();                             /* start the time accounting */
+    queue->idle_timestamp = queue->power_timestamp;                             /* start the idle time */
+    queue->inited = 1;                                                          /* flag finish initialization */
+
+    return 0;                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     close the queue
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      all waiting items are dropped
+ */
+uint8_t syn6288_queue_deinit(syn6288_queue_t *queue)
+{
+    uint8_t i;
+
+    if (queue == NULL)                                                          /* check queue */
+    {
+        return 2;                                                               /* return error */
+    }
+    if (queue->inited != 1)                                                     /* check queue initialization */
+    {
+        return 3;                                                               /* return error */
+    }
+
+    for (i = 0; i < SYN6288_QUEUE_MAX_ITEM; i++)
+    {
+        if (queue->item[i].status != SYN6288_QUEUE_STATUS_NONE)                 /* used slot */
+        {
+            queue->item[i].status = SYN6288_QUEUE_STATUS_NONE;                  /* free the slot */
+            queue->receive_callback(SYN6288_QUEUE_EVENT_DROP, queue->item[i].id);
+        }
+    }
+    queue->playing_num = 0;                                                     /* no playing item */
+    queue->inited = 0;                                                          /* flag close */
+
+    return 0;                                                                   /* success return 0 */
+}
+
+/**
+ * @brief      push a text into the queue
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[in]  *buf pointer to a text buffer encoded as the current text type
+ * @param[in]  len text buffer length
+ * @param[out] *id pointer to an item id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 queue is full
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ *             - 4 len is invalid
+ * @note       the current text type, mode, volumes and speed of the handle and the current
+ *             deadline, ttl, value and priority of the queue are saved with the item, a duplicate of a queued or playing item inside the dedupe window is suppressed
+ *             and the id of the original item is returned
+ */
+uint8_t syn6288_queue_push(syn6288_queue_t *queue, uint8_t *buf, uint16_t len, uint32_t *id)
+{
+    uint8_t i;
+    uint32_t now;
+    uint32_t hash;
+    uint8_t settings[5];
+    syn6288_queue_item_t *item;
+
+    if (queue == NULL)                                                          /* check queue */
+    {
+        return 2;                                                               /* return error */
+    }
+    if (queue->inited != 1)                                                     /* check queue initialization */
+    {
+        return 3;                                                               /* return error */
+    }
+    if ((buf == NULL) || (len == 0) || (len > SYN6288_QUEUE_MAX_LEN))           /* check length */
+    {
+        SYN6288_LOG_WARNING(queue->handle, SYN6288_EVENT_PARAM_INVALID, SYN6288_OPCODE_NUM, len, "syn6288: len is invalid.\n"); /* len is invalid */
+
+        return 4;                                                               /* return error */
+    }
+
+    now = queue->timestamp_ms();                                                /* get the time */
+    settings[0] = queue->handle->type;                                          /* text type */
+    settings[1] = queue->handle->mode;                                          /* mode */
+    settings[2] = (queue->item_volume != SYN6288_QUEUE_SETTING_HANDLE) ?
+                  queue->item_volume : queue->handle->volume;                   /* volume */
+    settings[3] = (queue->item_background_volume != SYN6288_QUEUE_SETTING_HANDLE) ?
+                  queue->item_background_volume : queue->handle->background_volume; /* background volume */
+    settings[4] = (queue->item_speed != SYN6288_QUEUE_SETTING_HANDLE) ?
+                  queue->item_speed : queue->handle->speed;                     /* speed */
+    hash = a_syn6288_queue_hash(settings, buf, len);                            /* hash the text */
+    if (queue->dedupe_window != 0)                                              /* dedupe is enabled */
+    {
+        i = a_syn6288_queue_find_duplicate(queue, settings, buf, len, hash, now);
+        if (i != SYN6288_QUEUE_MAX_ITEM)                                        /* find a duplicate */
+        {
+            queue->stats.suppressed++;                                          /* suppressed++ */
+            if (queue->dedupe_mode == SYN6288_QUEUE_DEDUPE_EXTEND)              /* extend the window */
+            {
+                queue->item[i].timestamp = now;                                 /* restart the window */
+                queue->stats.extended++;                                        /* extended++ */
+            }
+            if (id != NULL)                                                     /* check id */
+            {
+                *id = queue->item[i].id;                                        /* output the original id */
+            }
+
+            return 0;                                                           /* success return 0 */
+        }
+    }
+
+    for (i = 0; i < SYN6288_QUEUE_MAX_ITEM; i++)
+    {
+        if (queue->item[i].status == SYN6288_QUEUE_STATUS_NONE)                 /* find a free slot */
+        {
+            break;                                                              /* break */
+        }
+    }
+    if (i == SYN6288_QUEUE_MAX_ITEM)                                            /* check the slot */
+    {
+        SYN6288_LOG_WARNING(queue->handle, SYN6288_EVENT_QUEUE_FULL, SYN6288_OPCODE_NUM, len, "syn6288: queue is full.\n"); /* queue is full */
+
+        return 1;                                                               /* return error */
+    }
+    item = &queue->item[i];                                                     /* set the item */
+    item->id = queue->id;                                                       /* set the id */
+    item->timestamp = now;                                                      /* set the push time */
+    item->hash = hash;                                                          /* save the hash */
+    item->type = settings[0];                                                   /* save the text type */
+    item->mode = settings[1];                                                   /* save the mode */
+    item->volume = settings[2];                                                 /* save the volume */
+    item->background_volume = settings[3];                                      /* save the background volume */
+    item->speed = settings[4];                                                  /* save the speed */
+    item->len = len;                                                            /* save the length */
+    memcpy(item->buf, buf, len);                                                /* copy the text */
+    item->mark = a_syn6288_queue_has_mark(item->type, item->buf, item->len);    /* check the marks */
+    item->value = queue->value;                                                 /* save the value */
+    item->priority = queue->priority;                                           /* save the priority */
+    item->deadline_valid = (queue->deadline != 0) ? 1 : 0;                      /* check the deadline */
+    item->deadline = now + queue->deadline;                                     /* latest start time */
+    item->expire_valid = (queue->ttl != 0) ? 1 : 0;                             /* check the ttl */
+    item->expire = now + queue->ttl;                                            /* expire time */
+    if (syn6288_queue_estimate_duration((syn6288_type_t)item->type,
+                                        (item->speed > 5) ? 5 : item->speed,
+                                        item->buf, item->len, &item->duration) != 0)
+    {
+        item->duration = 0;                                                     /* no estimation */
+    }
+    item->status = SYN6288_QUEUE_STATUS_QUEUED;                                 /* set queued */
+    if (queue->id != 1)                                                         /* not the first push */
+    {
+        if (queue->push_interval == 0)                                          /* first interval */
+        {
+            queue->push_interval = now - queue->push_timestamp;                 /* set the interval */
+        }
+        else
+        {
+            queue->push_interval = (queue->push_interval * 3 +
+                                    (now - queue->push_timestamp)) / 4;         /* average the interval */
+        }
+    }
+    queue->push_timestamp = now;                                                /* save the push time */
+    queue->stats.pushed++;                                                      /* pushed++ */
+    queue->id++;                                                                /* id++ */
+    if (queue->id == 0)                                                         /* skip the invalid id */
+    {
+        queue->id = 1;                                                          /* set 1 */
+    }
+    if (id != NULL)                                                             /* check id */
+    {
+        *id = item->id;                                                         /* output the id */
+    }
+
+    return 0;                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     process the queue
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 process failed
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      call this function periodically
+ */
+uint8_t syn6288_queue_process(syn6288_queue_t *queue)
+{
+    uint8_t slot;
+    uint8_t barge_in;
+    uint32_t now;
+
+    if (queue == NULL)                                                          /* check queue */
+    {
+        return 2;                                                               /* return error */
+    }
+    if (queue->inited != 1)                                                     /* check queue initialization */
+    {
+        return 3;                                                               /* return error */
+    }
+
+    now = queue->timestamp_ms();                                                /* get the time */
+    if ((queue->failures >= queue->fail_threshold) || (queue->degraded != 0))   /* link is unhealthy */
+    {
+        if ((int32_t)(now - queue->recover_timestamp) < 0)                      /* wait the retry interval */
+        {
+            return 1;                                                           /* return error */
+        }
+        if (a_syn6288_queue_recover(queue, now) != 0)                           /* recover */
+        {
+            return 1;                                                           /* return error */
+        }
+    }
+    if (queue->power == SYN6288_QUEUE_POWER_DOWN)                               /* powered down */
+    {
+        if (a_syn6288_queue_power(queue, now) != 0)                             /* wake up if needed */
+        {
+            return 1;                                                           /* return error */
+        }
+        if (queue->power == SYN6288_QUEUE_POWER_DOWN)                           /* still powered down */
+        {
+            return 0;                                                           /* success return 0 */
+        }
+    }
+    barge_in = 0;                                                               /* init 0 */
+    if (queue->playing_num != 0)                                                /* playing */
+    {
+        queue->idle_timestamp = now;                                            /* busy */
+        if (a_syn6288_queue_update(queue) != 0)                                 /* update */
+        {
+            return 1;                                                           /* return error */
+        }
+        if (queue->playing_num != 0)                                            /* still playing */
+        {
+            slot = a_syn6288_queue_next(queue);                                 /* get the next item */
+            if ((slot == SYN6288_QUEUE_MAX_ITEM) ||
+                (queue->item[slot].priority <=
+                 queue->item[queue->playing_slot[queue->playing_done]].priority))
+            {
+                return 0;                                                       /* success return 0 */
+            }
+            if (a_syn6288_queue_preempt(queue) != 0)                            /* preempt */
+            {
+                return 1;                                                       /* return error */
+            }
+            barge_in = 1;                                                       /* the chip is still playing */
+        }
+    }
+    a_syn6288_queue_schedule(queue);                                            /* drop the stale items */
+    if (a_syn6288_queue_dispatch(queue, barge_in) != 0)                         /* send the next frame */
+    {
+        if (barge_in != 0)                                                      /* barge in failed */
+        {
+            (void)syn6288_stop(queue->handle);                                  /* stop the chip */
+        }
+
+        return 1;                                                               /* return error */
+    }
+    if ((barge_in != 0) && (queue->playing_num == 0))                           /* nothing sent */
+    {
+        if (syn6288_stop(queue->handle) != 0)                                   /* stop the chip */
+        {
+            return 1;                                                           /* return error */
+        }
+    }
+
+    return a_syn6288_queue_power(queue, now);                                   /* power down if idle */
+}
+
+/**
+ * @brief      get the item status
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[in]  id item id
+ * @param[out] *status pointer to an item status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       finished items and unknown ids are reported as SYN6288_QUEUE_STATUS_NONE
+ */
+uint8_t syn6288_queue_get_item_status(syn6288_queue_t *queue, uint32_t id, syn6288_queue_status_t *status)
+{
+    uint8_t i;
+
+    if (queue == NULL)                                                          /* check queue */
+    {
+        return 2;                                                               /* return error */
+    }
+    if (queue->inited != 1)                                                     /* check queue initialization */
+    {
+        return 3;                                                               /* return error */
+    }
+
+    *status = SYN6288_QUEUE_STATUS_NONE;                                        /* default none */
+    for (i = 0; i < SYN6288_QUEUE_MAX_ITEM; i++)
+    {
+        if ((queue->item[i].status != SYN6288_QUEUE_STATUS_NONE) &&
+            (queue->item[i].id == id))                                          /* find the id */
+        {
+            *status = (syn6288_queue_status_t)(queue->item[i].status);          /* set the status */
+
+            break;                                                              /* break */
+        }
+    }
+
+    return 0;                                                                   /* success return 0 */
+}
+
+/**
+ * @brief      get the item number in the queue
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *count pointer to an item number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       playing items are included
+ */
+uint8_t syn6288_queue_get_count(syn6288_queue_t *queue, uint8_t *count)
+{
+    uint8_t i;
+
+    if (queue == NULL)                                                          /* check queue */
+    {
+        return 2;                                                               /* return error */
+    }
+    if (queue->inited != 1)                                                     /* check queue initialization */
+    {
+        return 3;                                                               /* return error */
+    }
+
+    *count = 0;                                                                 /* init 0 */
+    for (i = 0; i < SYN6288_QUEUE_MAX_ITEM; i++)
+    {
+        if (queue->item[i].status != SYN6288_QUEUE_STATUS_NONE)                 /* used slot */
+        {
+            (*count)++;                                                         /* count++ */
+        }
+    }
+
+    return 0;                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     enable or disable merging queued items into one frame
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      only consecutive items with the same text type, mode, volumes and speed are merged
+ */
+uint8_t syn6288_queue_set_coalesce(syn6288_queue_t *queue, syn6288_bool_t enable)
+{
+    if (queue == NULL)                      /* check queue */
+    {
+        return 2;                           /* return error */
+    }
+    if (queue->inited != 1)                 /* check queue initialization */
+    {
+        return 3;                           /* return error */
+    }
+
+    queue->coalesce = (uint8_t)enable;      /* set coalesce */
+
+    return 0;                               /* success return 0 */
+}
+
+/**
+ * @brief      get the coalesce status
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_coalesce(syn6288_queue_t *queue, syn6288_bool_t *enable)
+{
+    if (queue == NULL)                                     /* check queue */
+    {
+        return 2;                                          /* return error */
+    }
+    if (queue->inited != 1)                                /* check queue initialization */
+    {
+        return 3;                                          /* return error */
+    }
+
+    *enable = (syn6288_bool_t)(queue->coalesce);           /* get coalesce */
+
+    return 0;                                              /* success return 0 */
+}
+
+/**
+ * @brief     set the dedupe window
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] ms window in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      0 means disable
+ */
+uint8_t syn6288_queue_set_dedupe_window(syn6288_queue_t *queue, uint32_t ms)
+{
+    if (queue == NULL)                      /* check queue */
+    {
+        return 2;                           /* return error */
+    }
+    if (queue->inited != 1)                 /* check queue initialization */
+    {
+        return 3;                           /* return error */
+    }
+
+    queue->dedupe_window = ms;              /* set the window */
+
+    return 0;                               /* success return 0 */
+}
+
+/**
+ * @brief      get the dedupe window
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *ms pointer to a window buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_dedupe_window(syn6288_queue_t *queue, uint32_t *ms)
+{
+    if (queue == NULL)                      /* check queue */
+    {
+        return 2;                           /* return error */
+    }
+    if (queue->inited != 1)                 /* check queue initialization */
+    {
+        return 3;                           /* return error */
+    }
+
+    *ms = queue->dedupe_window;             /* get the window */
+
+    return 0;                               /* success return 0 */
+}
+
+/**
+ * @brief     set the dedupe mode
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] mode dedupe mode
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      none
+ */
+uint8_t syn6288_queue_set_dedupe_mode(syn6288_queue_t *queue, syn6288_queue_dedupe_t mode)
+{
+    if (queue == NULL)                      /* check queue */
+    {
+        return 2;                           /* return error */
+    }
+    if (queue->inited != 1)                 /* check queue initialization */
+    {
+        return 3;                           /* return error */
+    }
+
+    queue->dedupe_mode = (uint8_t)mode;     /* set the mode */
+
+    return 0;                               /* success return 0 */
+}
+
+/**
+ * @brief      get the dedupe mode
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *mode pointer to a dedupe mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_dedupe_mode(syn6288_queue_t *queue, syn6288_queue_dedupe_t *mode)
+{
+    if (queue == NULL)                                      /* check queue */
+    {
+        return 2;                                           /* return error */
+    }
+    if (queue->inited != 1)                                 /* check queue initialization */
+    {
+        return 3;                                           /* return error */
+    }
+
+    *mode = (syn6288_queue_dedupe_t)(queue->dedupe_mode);   /* get the mode */
+
+    return 0;                                               /* success return 0 */
+}
+
+/**
+ * @brief     enable or disable the backlog adaptive speed
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      the speed returns to the configured speed of each item when the backlog drains
+ */
+uint8_t syn6288_queue_set_adaptive_speed(syn6288_queue_t *queue, syn6288_bool_t enable)
+{
+    if (queue == NULL)                      /* check queue */
+    {
+        return 2;                           /* return error */
+    }
+    if (queue->inited != 1)                 /* check queue initialization */
+    {
+        return 3;                           /* return error */
+    }
+
+    queue->adaptive = (uint8_t)enable;      /* set adaptive */
+
+    return 0;                               /* success return 0 */
+}
+
+/**
+ * @brief      get the backlog adaptive speed status
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_adaptive_speed(syn6288_queue_t *queue, syn6288_bool_t *enable)
+{
+    if (queue == NULL)                                     /* check queue */
+    {
+        return 2;                                          /* return error */
+    }
+    if (queue->inited != 1)                                /* check queue initialization */
+    {
+        return 3;                                          /* return error */
+    }
+
+    *enable = (syn6288_bool_t)(queue->adaptive);           /* get adaptive */
+
+    return 0;                                              /* success return 0 */
+}
+
+/**
+ * @brief     set the backlog threshold
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] ms predicted drain time of one speed step in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      none
+ */
+uint8_t syn6288_queue_set_backlog_threshold(syn6288_queue_t *queue, uint32_t ms)
+{
+    if (queue == NULL)                      /* check queue */
+    {
+        return 2;                           /* return error */
+    }
+    if (queue->inited != 1)                 /* check queue initialization */
+    {
+        return 3;                           /* return error */
+    }
+
+    queue->backlog_threshold = ms;          /* set the threshold */
+
+    return 0;                               /* success return 0 */
+}
+
+/**
+ * @brief      get the backlog threshold
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *ms pointer to a threshold buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_backlog_threshold(syn6288_queue_t *queue, uint32_t *ms)
+{
+    if (queue == NULL)                      /* check queue */
+    {
+        return 2;                           /* return error */
+    }
+    if (queue->inited != 1)                 /* check queue initialization */
+    {
+        return 3;                           /* return error */
+    }
+
+    *ms = queue->backlog_threshold;         /* get the threshold */
+
+    return 0;                               /* success return 0 */
+}
+
+/**
+ * @brief     set the deadline
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] ms latest start time after the push in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      applies to the following pushes, 0 means no deadline
+ */
+uint8_t syn6288_queue_set_deadline(syn6288_queue_t *queue, uint32_t ms)
+{
+    if (queue == NULL)                      /* check queue */
+    {
+        return 2;                           /* return error */
+    }
+    if (queue->inited != 1)                 /* check queue initialization */
+    {
+        return 3;                           /* return error */
+    }
+
+    queue->deadline = ms;               /* set the deadline */
+
+    return 0;                               /* success return 0 */
+}
+
+/**
+ * @brief      get the deadline
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *ms pointer to a deadline buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_deadline(syn6288_queue_t *queue, uint32_t *ms)
+{
+    if (queue == NULL)                      /* check queue */
+    {
+        return 2;                           /* return error */
+    }
+    if (queue->inited != 1)                 /* check queue initialization */
+    {
+        return 3;                           /* return error */
+    }
+
+    *ms = queue->deadline;              /* get the deadline */
+
+    return 0;                               /* success return 0 */
+}
+
+/**
+ * @brief     set the ttl
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] ms lifetime after the push in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      applies to the following pushes, 0 means no limit
+ */
+uint8_t syn6288_queue_set_ttl(syn6288_queue_t *queue, uint32_t ms)
+{
+    if (queue == NULL)                      /* check queue */
+    {
+        return 2;                           /* return error */
+    }
+    if (queue->inited != 1)                 /* check queue initialization */
+    {
+        return 3;                           /* return error */
+    }
+
+    queue->ttl = ms;                    /* set the ttl */
+
+    return 0;                               /* success return 0 */
+}
+
+/**
+ * @brief      get the ttl
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *ms pointer to a ttl buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_ttl(syn6288_queue_t *queue, uint32_t *ms)
+{
+    if (queue == NULL)                      /* check queue */
+    {
+        return 2;                           /* return error */
+    }
+    if (queue->inited != 1)                 /* check queue initialization */
+    {
+        return 3;                           /* return error */
+    }
+
+    *ms = queue->ttl;                   /* get the ttl */
+
+    return 0;                               /* success return 0 */
+}
+
+/**
+ * @brief     set the value
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] value importance of the item
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      applies to the following pushes, lower value items are shed first under overload
+ */
+uint8_t syn6288_queue_set_value(syn6288_queue_t *queue, uint8_t value)
+{
+    if (queue == NULL)                      /* check queue */
+    {
+        return 2;                           /* return error */
+    }
+    if (queue->inited != 1)                 /* check queue initialization */
+    {
+        return 3;                           /* return error */
+    }
+
+    queue->value = value;               /* set the value */
+
+    return 0;                               /* success return 0 */
+}
+
+/**
+ * @brief      get the value
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *value pointer to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_value(syn6288_queue_t *queue, uint8_t *value)
+{
+    if (queue == NULL)                      /* check queue */
+    {
+        return 2;                           /* return error */
+    }
+    if (queue->inited != 1)                 /* check queue initialization */
+    {
+        return 3;                           /* return error */
+    }
+
+    *value = queue->value;              /* get the value */
+
+    return 0;                               /* success return 0 */
+}
+
+/**
+ * @brief     set the priority
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] priority item priority
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      applies to the following pushes, a higher priority item interrupts the playing one
+ */
+uint8_t syn6288_queue_set_priority(syn6288_queue_t *queue, syn6288_queue_priority_t priority)
+{
+    if (queue == NULL)                          /* check queue */
+    {
+        return 2;                               /* return error */
+    }
+    if (queue->inited != 1)                     /* check queue initialization */
+    {
+        return 3;                               /* return error */
+    }
+
+    queue->priority = (uint8_t)priority;        /* set the priority */
+
+    return 0;                                   /* success return 0 */
+}
+
+/**
+ * @brief      get the priority
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *priority pointer to a priority buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_priority(syn6288_queue_t *queue, syn6288_queue_priority_t *priority)
+{
+    if (queue == NULL)                                              /* check queue */
+    {
+        return 2;                                                   /* return error */
+    }
+    if (queue->inited != 1)                                         /* check queue initialization */
+    {
+        return 3;                                                   /* return error */
+    }
+
+    *priority = (syn6288_queue_priority_t)(queue->priority);        /* get the priority */
+
+    return 0;                                                       /* success return 0 */
+}
+
+/**
+ * @brief     set the synthesis volume
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] volume synthesis volume, SYN6288_QUEUE_SETTING_HANDLE uses the handle setting
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ *            - 4 volume is invalid
+ * @note      applies to the following pushes, nothing is sent to the chip until the item is played
+ */
+uint8_t syn6288_queue_set_synthesis_volume(syn6288_queue_t *queue, uint8_t volume)
+{
+    if (queue == NULL)                                                      /* check queue */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (queue->inited != 1)                                                 /* check queue initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+    if ((volume > 16) && (volume != SYN6288_QUEUE_SETTING_HANDLE))          /* check volume */
+    {
+        SYN6288_LOG_WARNING(queue->handle, SYN6288_EVENT_PARAM_INVALID, SYN6288_OPCODE_NUM, volume, "syn6288: volume is invalid.\n"); /* volume is invalid */
+
+        return 4;                                                           /* return error */
+    }
+
+    queue->item_volume = volume;                                            /* set the synthesis volume */
+
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief      get the synthesis volume
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *volume pointer to a synthesis volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_synthesis_volume(syn6288_queue_t *queue, uint8_t *volume)
+{
+    if (queue == NULL)                                                      /* check queue */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (queue->inited != 1)                                                 /* check queue initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+
+    *volume = queue->item_volume;                                           /* get the synthesis volume */
+
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief     set the background volume
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] volume background volume, SYN6288_QUEUE_SETTING_HANDLE uses the handle setting
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ *            - 4 volume is invalid
+ * @note      applies to the following pushes, nothing is sent to the chip until the item is played
+ */
+uint8_t syn6288_queue_set_background_volume(syn6288_queue_t *queue, uint8_t volume)
+{
+    if (queue == NULL)                                                      /* check queue */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (queue->inited != 1)                                                 /* check queue initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+    if ((volume > 16) && (volume != SYN6288_QUEUE_SETTING_HANDLE))          /* check volume */
+    {
+        SYN6288_LOG_WARNING(queue->handle, SYN6288_EVENT_PARAM_INVALID, SYN6288_OPCODE_NUM, volume, "syn6288: volume is invalid.\n"); /* volume is invalid */
+
+        return 4;                                                           /* return error */
+    }
+
+    queue->item_background_volume = volume;                                 /* set the background volume */
+
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief      get the background volume
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *volume pointer to a background volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_background_volume(syn6288_queue_t *queue, uint8_t *volume)
+{
+    if (queue == NULL)                                                      /* check queue */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (queue->inited != 1)                                                 /* check queue initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+
+    *volume = queue->item_background_volume;                                /* get the background volume */
+
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief     set the synthesis speed
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] speed synthesis speed, SYN6288_QUEUE_SETTING_HANDLE uses the handle setting
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ *            - 4 speed is invalid
+ * @note      applies to the following pushes, nothing is sent to the chip until the item is played
+ */
+uint8_t syn6288_queue_set_synthesis_speed(syn6288_queue_t *queue, uint8_t speed)
+{
+    if (queue == NULL)                                                      /* check queue */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (queue->inited != 1)                                                 /* check queue initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+    if ((speed > 5) && (speed != SYN6288_QUEUE_SETTING_HANDLE))          /* check speed */
+    {
+        SYN6288_LOG_WARNING(queue->handle, SYN6288_EVENT_PARAM_INVALID, SYN6288_OPCODE_NUM, speed, "syn6288: speed is invalid.\n"); /* speed is invalid */
+
+        return 4;                                                           /* return error */
+    }
+
+    queue->item_speed = speed;                                              /* set the synthesis speed */
+
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief      get the synthesis speed
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *speed pointer to a synthesis speed buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_synthesis_speed(syn6288_queue_t *queue, uint8_t *speed)
+{
+    if (queue == NULL)                                                      /* check queue */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (queue->inited != 1)                                                 /* check queue initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+
+    *speed = queue->item_speed;                                             /* get the synthesis speed */
+
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief     set the idle time before power down
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] ms idle time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      0 means never power down, the chip is woken when an item is queued
+ */
+uint8_t syn6288_queue_set_idle_time(syn6288_queue_t *queue, uint32_t ms)
+{
+    if (queue == NULL)                          /* check queue */
+    {
+        return 2;                               /* return error */
+    }
+    if (queue->inited != 1)                     /* check queue initialization */
+    {
+        return 3;                               /* return error */
+    }
+
+    queue->idle_time = ms;                      /* set the idle time */
+
+    return 0;                                   /* success return 0 */
+}
+
+/**
+ * @brief      get the idle time before power down
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *ms pointer to an idle time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_idle_time(syn6288_queue_t *queue, uint32_t *ms)
+{
+    if (queue == NULL)                          /* check queue */
+    {
+        return 2;                               /* return error */
+    }
+    if (queue->inited != 1)                     /* check queue initialization */
+    {
+        return 3;                               /* return error */
+    }
+
+    *ms = queue->idle_time;                     /* get the idle time */
+
+    return 0;                                   /* success return 0 */
+}
+
+/**
+ * @brief     set the pre-wake lead time
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] ms lead time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      0 means no pre-wake, otherwise the chip is woken this long before the expected work,
+ *            which is the wake time if set or the next push predicted from the push interval
+ */
+uint8_t syn6288_queue_set_prewake(syn6288_queue_t *queue, uint32_t ms)
+{
+    if (queue == NULL)                          /* check queue */
+    {
+        return 2;                               /* return error */
+    }
+    if (queue->inited != 1)                     /* check queue initialization */
+    {
+        return 3;                               /* return error */
+    }
+
+    queue->prewake = ms;                        /* set the lead time */
+
+    return 0;                                   /* success return 0 */
+}
+
+/**
+ * @brief      get the pre-wake lead time
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *ms pointer to a lead time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_prewake(syn6288_queue_t *queue, uint32_t *ms)
+{
+    if (queue == NULL)                          /* check queue */
+    {
+        return 2;                               /* return error */
+    }
+    if (queue->inited != 1)                     /* check queue initialization */
+    {
+        return 3;                               /* return error */
+    }
+
+    *ms = queue->prewake;                       /* get the lead time */
+
+    return 0;                                   /* success return 0 */
+}
+
+/**
+ * @brief     set the timestamp of the next scheduled announcement
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] timestamp announcement timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      used once by the pre-wake
+ */
+uint8_t syn6288_queue_set_wake_time(syn6288_queue_t *queue, uint32_t timestamp)
+{
+    if (queue == NULL)                          /* check queue */
+    {
+        return 2;                               /* return error */
+    }
+    if (queue->inited != 1)                     /* check queue initialization */
+    {
+        return 3;                               /* return error */
+    }
+
+    queue->wake_timestamp = timestamp;          /* set the wake time */
+    queue->wake_valid = 1;                      /* set valid */
+
+    return 0;                                   /* success return 0 */
+}
+
+/**
+ * @brief      get the chip power state
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *power pointer to a power state buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_power_state(syn6288_queue_t *queue, syn6288_queue_power_t *power)
+{
+    if (queue == NULL)                                          /* check queue */
+    {
+        return 2;                                               /* return error */
+    }
+    if (queue->inited != 1)                                     /* check queue initialization */
+    {
+        return 3;                                               /* return error */
+    }
+
+    *power = (syn6288_queue_power_t)(queue->power);             /* get the power state */
+
+    return 0;                                                   /* success return 0 */
+}
+
+/**
+ * @brief     set the failure threshold
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] num consecutive failures before a recovery
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ *            - 4 num is invalid
+ * @note      num must be larger than 0
+ */
+uint8_t syn6288_queue_set_fail_threshold(syn6288_queue_t *queue, uint8_t num)
+{
+    if (queue == NULL)                                                  /* check queue */
+    {
+        return 2;                                                       /* return error */
+    }
+    if (queue->inited != 1)                                             /* check queue initialization */
+    {
+        return 3;                                                       /* return error */
+    }
+    if (num == 0)                                                       /* check num */
+    {
+        SYN6288_LOG_WARNING(queue->handle, SYN6288_EVENT_PARAM_INVALID, SYN6288_OPCODE_NUM, num, "syn6288: num is invalid.\n"); /* num is invalid */
+
+        return 4;                                                       /* return error */
+    }
+
+    queue->fail_threshold = num;                                        /* set the threshold */
+
+    return 0;                                                           /* success return 0 */
+}
+
+/**
+ * @brief      get the failure threshold
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *num pointer to a failure number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_fail_threshold(syn6288_queue_t *queue, uint8_t *num)
+{
+    if (queue == NULL)                          /* check queue */
+    {
+        return 2;                               /* return error */
+    }
+    if (queue->inited != 1)                     /* check queue initialization */
+    {
+        return 3;                               /* return error */
+    }
+
+    *num = queue->fail_threshold;               /* get the threshold */
+
+    return 0;                                   /* success return 0 */
+}
+
+/**
+ * @brief     set the latency limit
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] ms average transaction latency in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      0 means no limit, otherwise a recovery runs when the average latency is above it
+ */
+uint8_t syn6288_queue_set_latency_limit(syn6288_queue_t *queue, uint32_t ms)
+{
+    if (queue == NULL)                          /* check queue */
+    {
+        return 2;                               /* return error */
+    }
+    if (queue->inited != 1)                     /* check queue initialization */
+    {
+        return 3;                               /* return error */
+    }
+
+    queue->latency_limit = ms;                  /* set the limit */
+
+    return 0;                                   /* success return 0 */
+}
+
+/**
+ * @brief      get the latency limit
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *ms pointer to a latency limit buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_latency_limit(syn6288_queue_t *queue, uint32_t *ms)
+{
+    if (queue == NULL)                          /* check queue */
+    {
+        return 2;                               /* return error */
+    }
+    if (queue->inited != 1)                     /* check queue initialization */
+    {
+        return 3;                               /* return error */
+    }
+
+    *ms = queue->latency_limit;                 /* get the limit */
+
+    return 0;                                   /* success return 0 */
+}
+
+/**
+ * @brief      get the journal of the playing frame
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *journal pointer to a journal structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       the journal is written on every process call while the link is healthy
+ */
+uint8_t syn6288_queue_get_journal(syn6288_queue_t *queue, syn6288_queue_journal_t *journal)
+{
+    if (queue == NULL)                                                      /* check queue */
+    {
+        return 2;                                                           /* return error */
+    }
+    if (queue->inited != 1)                                                 /* check queue initialization */
+    {
+        return 3;                                                           /* return error */
+    }
+
+    memcpy(journal, &queue->journal, sizeof(syn6288_queue_journal_t));      /* copy the journal */
+
+    return 0;                                                               /* success return 0 */
+}
+
+/**
+ * @brief      get the queue stats
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *stats pointer to a stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       the time in each power state is counted up to this call
+ */
+uint8_t syn6288_queue_get_stats(syn6288_queue_t *queue, syn6288_queue_stats_t *stats)
+{
+    if (queue == NULL)                                                  /* check queue */
+    {
+        return 2;                                                       /* return error */
+    }
+    if (queue->inited != 1)                                             /* check queue initialization */
+    {
+        return 3;                                                       /* return error */
+    }
+
+    a_syn6288_queue_account(queue, queue->timestamp_ms());              /* count the state time */
+    memcpy(stats, &queue->stats, sizeof(syn6288_queue_stats_t));        /* copy the stats */
+
+    return 0;                                                           /* success return 0 */
+}
+
+/**
+ * @brief     reset the queue stats
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      none
+ */
+uint8_t syn6288_queue_reset_stats(syn6288_queue_t *queue)
+{
+    if (queue == NULL)                                                  /* check queue */
+    {
+        return 2;                                                       /* return error */
+    }
+    if (queue->inited != 1)                                             /* check queue initialization */
+    {
+        return 3;                                                       /* return error */
+    }
+
+    memset(&queue->stats, 0, sizeof(syn6288_queue_stats_t));            /* clear the stats */
+    queue->power_timestamp = queue->timestamp_ms();                     /* restart the time accounting */
+
+    return 0;                                                           /* success return 0 */
+}
+
+/**
+ * @brief      estimate the playing duration of a text
+ * @param[in]  type text type
+ * @param[in]  speed synthesis speed
+ * @param[in]  *buf pointer to a text buffer
+ * @param[in]  len text buffer length
+ * @param[out] *ms pointer to a duration buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 buf is NULL
+ *             - 4 speed is invalid
+ * @note       inline speed marks and prompt tones in the text are taken into account
+ */
+uint8_t syn6288_queue_estimate_duration(syn6288_type_t type, uint8_t speed, uint8_t *buf, uint16_t len, uint32_t *ms)
+{
+    uint16_t pos;
+    uint16_t segment;
+
+    if ((buf == NULL) || (ms == NULL))                                                  /* check buf */
+    {
+        return 2;                                                                       /* return error */
+    }
+    if (speed > 5)                                                                      /* check speed */
+    {
+        return 4;                                                                       /* return error */
+    }
+
+    *ms = a_syn6288_queue_walk((uint8_t)type, speed, buf, len, 0xFFFFFFFFU,
+                               &pos, &segment);                                         /* estimate the text */
+
+    return 0;                                                                           /* success return 0 */
+}
@@ -0,0 +1,880 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_syn6288_queue.h
+ * @brief     driver syn6288 queue header file
+ * @version   2.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>2.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SYN6288_QUEUE_H
+#define DRIVER_SYN6288_QUEUE_H
+
+#include "driver_syn6288.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup syn6288_queue_driver syn6288 queue driver function
+ * @brief    syn6288 queue driver modules
+ * @ingroup  syn6288_driver
+ * @{
+ */
+
+/**
+ * @brief syn6288 queue max item definition
+ */
+#ifndef SYN6288_QUEUE_MAX_ITEM
+    #define SYN6288_QUEUE_MAX_ITEM 8        /**< 8 items */
+#endif
+
+/**
+ * @brief syn6288 queue max text length definition
+ */
+#define SYN6288_QUEUE_MAX_LEN 200        /**< 200 bytes */
+
+/**
+ * @brief syn6288 queue status poll interval definition
+ */
+#ifndef SYN6288_QUEUE_POLL_INTERVAL
+    #define SYN6288_QUEUE_POLL_INTERVAL 200        /**< 200 ms */
+#endif
+
+/**
+ * @brief syn6288 queue default backlog threshold definition
+ */
+#ifndef SYN6288_QUEUE_BACKLOG_THRESHOLD
+    #define SYN6288_QUEUE_BACKLOG_THRESHOLD 10000        /**< 10000 ms */
+#endif
+
+/**
+ * @brief syn6288 queue default value definition
+ */
+#ifndef SYN6288_QUEUE_DEFAULT_VALUE
+    #define SYN6288_QUEUE_DEFAULT_VALUE 128        /**< middle value */
+#endif
+
+/**
+ * @brief syn6288 queue handle setting definition
+ */
+#define SYN6288_QUEUE_SETTING_HANDLE 0xFF        /**< use the setting of the handle */
+
+/**
+ * @brief syn6288 queue frame overhead definition
+ */
+#define SYN6288_QUEUE_FRAME_OVERHEAD 100        /**< 100 ms ack wait of one frame */
+
+/**
+ * @brief syn6288 queue default failure threshold definition
+ */
+#ifndef SYN6288_QUEUE_FAIL_THRESHOLD
+    #define SYN6288_QUEUE_FAIL_THRESHOLD 3        /**< 3 consecutive failures */
+#endif
+
+/**
+ * @brief syn6288 queue recovery retry interval definition
+ */
+#ifndef SYN6288_QUEUE_RECOVER_INTERVAL
+    #define SYN6288_QUEUE_RECOVER_INTERVAL 1000        /**< 1000 ms */
+#endif
+
+/**
+ * @brief syn6288 queue status enumeration definition
+ */
+typedef enum
+{
+    SYN6288_QUEUE_STATUS_NONE    = 0x00,        /**< unknown or finished */
+    SYN6288_QUEUE_STATUS_QUEUED  = 0x01,        /**< waiting in the queue */
+    SYN6288_QUEUE_STATUS_PLAYING = 0x02,        /**< playing */
+} syn6288_queue_status_t;
+
+/**
+ * @brief syn6288 queue event enumeration definition
+ */
+typedef enum
+{
+    SYN6288_QUEUE_EVENT_START   = 0x00,        /**< item starts playing */
+    SYN6288_QUEUE_EVENT_DONE    = 0x01,        /**< item is finished */
+    SYN6288_QUEUE_EVENT_DROP    = 0x02,        /**< item is dropped */
+    SYN6288_QUEUE_EVENT_PREEMPT = 0x03,        /**< item is interrupted and queued again */
+} syn6288_queue_event_t;
+
+/**
+ * @brief syn6288 queue priority enumeration definition
+ */
+typedef enum
+{
+    SYN6288_QUEUE_PRIORITY_LOW       = 0x00,        /**< low priority */
+    SYN6288_QUEUE_PRIORITY_NORMAL    = 0x01,        /**< normal priority */
+    SYN6288_QUEUE_PRIORITY_HIGH      = 0x02,        /**< high priority */
+    SYN6288_QUEUE_PRIORITY_EMERGENCY = 0x03,        /**< emergency priority */
+} syn6288_queue_priority_t;
+
+/**
+ * @brief syn6288 queue dedupe enumeration definition
+ */
+typedef enum
+{
+    SYN6288_QUEUE_DEDUPE_DROP   = 0x00,        /**< drop the duplicate */
+    SYN6288_QUEUE_DEDUPE_EXTEND = 0x01,        /**< drop the duplicate and restart the window of the original */
+} syn6288_queue_dedupe_t;
+
+/**
+ * @brief syn6288 queue power enumeration definition
+ */
+typedef enum
+{
+    SYN6288_QUEUE_POWER_ON   = 0x00,        /**< chip is powered on */
+    SYN6288_QUEUE_POWER_DOWN = 0x01,        /**< chip is powered down */
+} syn6288_queue_power_t;
+
+/**
+ * @brief syn6288 queue stats structure definition
+ */
+typedef struct syn6288_queue_stats_s
+{
+    uint32_t pushed;            /**< accepted items */
+    uint32_t suppressed;        /**< dropped duplicate items */
+    uint32_t extended;          /**< window extensions */
+    uint32_t rate_changes;      /**< frame speed changes */
+    uint32_t rate_boosted;      /**< frames played above the configured speed */
+    uint32_t expired;           /**< items dropped after the ttl */
+    uint32_t missed;            /**< items dropped before missing the deadline */
+    uint32_t shed;              /**< lower value items dropped under overload */
+    uint32_t preempted;         /**< items interrupted by a higher priority item */
+    uint32_t power_downs;       /**< idle power downs */
+    uint32_t wakes;             /**< wake ups */
+    uint32_t prewakes;          /**< wake ups ahead of the expected work */
+    uint32_t wake_latency;      /**< last wake up latency in ms */
+    uint32_t wake_latency_max;  /**< max wake up latency in ms */
+    uint32_t time_on;           /**< time powered on in ms */
+    uint32_t time_down;         /**< time powered down in ms */
+    uint32_t link_failures;     /**< failed chip transactions */
+    uint32_t latency;           /**< average transaction latency in ms */
+    uint32_t latency_max;       /**< max transaction latency in ms */
+    uint32_t recoveries;        /**< successful recoveries */
+    uint32_t recovery_failures; /**< failed recoveries */
+    uint32_t resubmitted;       /**< in-flight items queued again by a recovery */
+    uint32_t resumed;           /**< items resumed from the journaled segment */
+    uint32_t recovery_time;     /**< last recovery time in ms */
+    uint32_t recovery_time_max; /**< max recovery time in ms */
+} syn6288_queue_stats_t;
+
+/**
+ * @brief syn6288 queue journal structure definition
+ */
+typedef struct syn6288_queue_journal_s
+{
+    uint32_t id;             /**< playing item id */
+    uint32_t offset;         /**< estimated offset in the item in ms */
+    uint16_t segment;        /**< index of the segment being played */
+    uint16_t pos;            /**< start of the segment being played */
+    uint8_t valid;           /**< valid flag */
+} syn6288_queue_journal_t;
+
+/**
+ * @brief syn6288 queue item structure definition
+ */
+typedef struct syn6288_queue_item_s
+{
+    uint32_t id;                                 /**< item id */
+    uint32_t timestamp;                          /**< push timestamp in ms */
+    uint32_t duration;                           /**< estimated duration in ms */
+    uint32_t hash;                               /**< payload and settings hash */
+    uint32_t deadline;                           /**< latest start timestamp in ms */
+    uint32_t expire;                             /**< expire timestamp in ms */
+    uint8_t deadline_valid;                      /**< deadline flag */
+    uint8_t expire_valid;                        /**< expire flag */
+    uint8_t value;                               /**< item value */
+    uint8_t priority;                            /**< item priority */
+    uint8_t status;                              /**< item status */
+    uint8_t type;                                /**< text type */
+    uint8_t mode;                                /**< play mode */
+    uint8_t volume;                              /**< synthesis volume */
+    uint8_t background_volume;                   /**< background volume */
+    uint8_t speed;                               /**< synthesis speed */
+    uint8_t mark;                                /**< inline mark flag */
+    uint16_t len;                                /**< text length */
+    uint8_t buf[SYN6288_QUEUE_MAX_LEN];          /**< text buffer */
+} syn6288_queue_item_t;
+
+/**
+ * @brief syn6288 queue structure definition
+ */
+typedef struct syn6288_queue_s
+{
+    syn6288_handle_t *handle;                                   /**< point to a syn6288 handle */
+    uint32_t (*timestamp_ms)(void);                             /**< point to a timestamp_ms function address */
+    void (*receive_callback)(uint8_t type, uint32_t id);        /**< point to a receive_callback function address */
+    syn6288_queue_item_t item[SYN6288_QUEUE_MAX_ITEM];          /**< item buffer */
+    uint32_t id;                                                /**< next item id */
+    uint8_t coalesce;                                           /**< coalesce flag */
+    uint8_t dedupe_mode;                                        /**< dedupe mode */
+    uint32_t dedupe_window;                                     /**< dedupe window in ms */
+    uint8_t adaptive;                                           /**< adaptive speed flag */
+    uint8_t rate;                                               /**< last frame speed */
+    uint32_t backlog_threshold;                                 /**< backlog threshold in ms */
+    uint32_t deadline;                                          /**< deadline of the next pushes in ms */
+    uint32_t ttl;                                               /**< ttl of the next pushes in ms */
+    uint8_t value;                                              /**< value of the next pushes */
+    uint8_t priority;                                           /**< priority of the next pushes */
+    uint8_t item_volume;                                        /**< volume of the next pushes */
+    uint8_t item_background_volume;                             /**< background volume of the next pushes */
+    uint8_t item_speed;                                         /**< speed of the next pushes */
+    uint32_t idle_time;                                         /**< idle time before power down in ms */
+    uint32_t prewake;                                           /**< wake lead time in ms */
+    uint8_t power;                                              /**< chip power state */
+    uint32_t power_timestamp;                                   /**< state time accounting timestamp */
+    uint32_t idle_timestamp;                                    /**< last busy timestamp */
+    uint32_t down_timestamp;                                    /**< power down timestamp */
+    uint32_t wake_timestamp;                                    /**< expected work timestamp */
+    uint8_t wake_valid;                                         /**< expected work flag */
+    uint32_t push_timestamp;                                    /**< last push timestamp */
+    uint32_t push_interval;                                     /**< average push interval in ms */
+    uint8_t fail_threshold;                                     /**< consecutive failures before a recovery */
+    uint32_t latency_limit;                                     /**< average latency before a recovery in ms */
+    uint8_t failures;                                           /**< consecutive failures */
+    uint8_t degraded;                                           /**< latency limit exceeded flag */
+    uint32_t recover_timestamp;                                 /**< earliest next recovery timestamp */
+    syn6288_queue_stats_t stats;                                /**< queue stats */
+    uint8_t volume;                                             /**< volume sent to the chip */
+    uint8_t background_volume;                                  /**< background volume sent to the chip */
+    uint8_t speed;                                              /**< speed sent to the chip */
+    uint8_t playing_num;                                        /**< playing item number */
+    uint8_t playing_done;                                       /**< finished playing item number */
+    uint8_t playing_slot[SYN6288_QUEUE_MAX_ITEM];               /**< playing item slots */
+    uint32_t playing_offset[SYN6288_QUEUE_MAX_ITEM];            /**< estimated end offset of the playing items */
+    uint32_t playing_start;                                     /**< frame start timestamp */
+    uint8_t playing_speed;                                      /**< frame speed */
+    uint32_t poll_timestamp;                                    /**< next status poll timestamp */
+    syn6288_queue_journal_t journal;                            /**< playing frame journal */
+    uint8_t frame[SYN6288_QUEUE_MAX_LEN];                       /**< frame text buffer */
+    uint8_t inited;                                             /**< inited flag */
+} syn6288_queue_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup syn6288_queue_link_driver syn6288 queue link driver function
+ * @brief    syn6288 queue link driver modules
+ * @ingroup  syn6288_queue_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize syn6288_queue_t structure
+ * @param[in] QUEUE pointer to a syn6288 queue structure
+ * @param[in] STRUCTURE syn6288_queue_t
+ * @note      none
+ */
+#define DRIVER_SYN6288_QUEUE_LINK_INIT(QUEUE, STRUCTURE)          memset(QUEUE, 0, sizeof(STRUCTURE))
+
+/**
+ * @brief     link timestamp_ms function
+ * @param[in] QUEUE pointer to a syn6288 queue structure
+ * @param[in] FUC pointer to a timestamp_ms function address
+ * @note      none
+ */
+#define DRIVER_SYN6288_QUEUE_LINK_TIMESTAMP_MS(QUEUE, FUC)        (QUEUE)->timestamp_ms = FUC
+
+/**
+ * @brief     link receive_callback function
+ * @param[in] QUEUE pointer to a syn6288 queue structure
+ * @param[in] FUC pointer to a receive_callback function address
+ * @note      none
+ */
+#define DRIVER_SYN6288_QUEUE_LINK_RECEIVE_CALLBACK(QUEUE, FUC)    (QUEUE)->receive_callback = FUC
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup syn6288_queue_base_driver syn6288 queue base driver function
+ * @brief    syn6288 queue base driver modules
+ * @ingroup  syn6288_queue_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize the queue
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] *handle pointer to an initialized syn6288 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 handle is invalid
+ * @note      none
+ */
+uint8_t syn6288_queue_init(syn6288_queue_t *queue, syn6288_handle_t *handle);
+
+/**
+ * @brief     close the queue
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      all waiting items are dropped
+ */
+uint8_t syn6288_queue_deinit(syn6288_queue_t *queue);
+
+/**
+ * @brief      push a text into the queue
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[in]  *buf pointer to a text buffer encoded as the current text type
+ * @param[in]  len text buffer length
+ * @param[out] *id pointer to an item id buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 queue is full
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ *             - 4 len is invalid
+ * @note       the current text type, mode, volumes and speed of the handle and the current
+ *             deadline, ttl, value and priority of the queue are saved with the item, a duplicate of a queued or playing item inside the dedupe window is suppressed
+ *             and the id of the original item is returned
+ */
+uint8_t syn6288_queue_push(syn6288_queue_t *queue, uint8_t *buf, uint16_t len, uint32_t *id);
+
+/**
+ * @brief     process the queue
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 process failed
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      call this function periodically
+ */
+uint8_t syn6288_queue_process(syn6288_queue_t *queue);
+
+/**
+ * @brief      get the item status
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[in]  id item id
+ * @param[out] *status pointer to an item status buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       finished items and unknown ids are reported as SYN6288_QUEUE_STATUS_NONE
+ */
+uint8_t syn6288_queue_get_item_status(syn6288_queue_t *queue, uint32_t id, syn6288_queue_status_t *status);
+
+/**
+ * @brief      get the item number in the queue
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *count pointer to an item number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       playing items are included
+ */
+uint8_t syn6288_queue_get_count(syn6288_queue_t *queue, uint8_t *count);
+
+/**
+ * @brief     enable or disable merging queued items into one frame
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      only consecutive items with the same text type, mode, volumes and speed are merged
+ */
+uint8_t syn6288_queue_set_coalesce(syn6288_queue_t *queue, syn6288_bool_t enable);
+
+/**
+ * @brief      get the coalesce status
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_coalesce(syn6288_queue_t *queue, syn6288_bool_t *enable);
+
+/**
+ * @brief     set the dedupe window
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] ms window in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      0 means disable
+ */
+uint8_t syn6288_queue_set_dedupe_window(syn6288_queue_t *queue, uint32_t ms);
+
+/**
+ * @brief      get the dedupe window
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *ms pointer to a window buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_dedupe_window(syn6288_queue_t *queue, uint32_t *ms);
+
+/**
+ * @brief     set the dedupe mode
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] mode dedupe mode
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      none
+ */
+uint8_t syn6288_queue_set_dedupe_mode(syn6288_queue_t *queue, syn6288_queue_dedupe_t mode);
+
+/**
+ * @brief      get the dedupe mode
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *mode pointer to a dedupe mode buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_dedupe_mode(syn6288_queue_t *queue, syn6288_queue_dedupe_t *mode);
+
+/**
+ * @brief     enable or disable the backlog adaptive speed
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      the speed returns to the configured speed of each item when the backlog drains
+ */
+uint8_t syn6288_queue_set_adaptive_speed(syn6288_queue_t *queue, syn6288_bool_t enable);
+
+/**
+ * @brief      get the backlog adaptive speed status
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_adaptive_speed(syn6288_queue_t *queue, syn6288_bool_t *enable);
+
+/**
+ * @brief     set the backlog threshold
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] ms predicted drain time of one speed step in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      none
+ */
+uint8_t syn6288_queue_set_backlog_threshold(syn6288_queue_t *queue, uint32_t ms);
+
+/**
+ * @brief      get the backlog threshold
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *ms pointer to a threshold buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_backlog_threshold(syn6288_queue_t *queue, uint32_t *ms);
+
+/**
+ * @brief     set the deadline
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] ms latest start time after the push in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      applies to the following pushes, 0 means no deadline
+ */
+uint8_t syn6288_queue_set_deadline(syn6288_queue_t *queue, uint32_t ms);
+
+/**
+ * @brief      get the deadline
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *ms pointer to a deadline buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_deadline(syn6288_queue_t *queue, uint32_t *ms);
+
+/**
+ * @brief     set the ttl
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] ms lifetime after the push in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      applies to the following pushes, 0 means no limit
+ */
+uint8_t syn6288_queue_set_ttl(syn6288_queue_t *queue, uint32_t ms);
+
+/**
+ * @brief      get the ttl
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *ms pointer to a ttl buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_ttl(syn6288_queue_t *queue, uint32_t *ms);
+
+/**
+ * @brief     set the value
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] value importance of the item
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      applies to the following pushes, lower value items are shed first under overload
+ */
+uint8_t syn6288_queue_set_value(syn6288_queue_t *queue, uint8_t value);
+
+/**
+ * @brief      get the value
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *value pointer to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_value(syn6288_queue_t *queue, uint8_t *value);
+
+/**
+ * @brief     set the priority
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] priority item priority
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      applies to the following pushes, a higher priority item interrupts the playing one
+ */
+uint8_t syn6288_queue_set_priority(syn6288_queue_t *queue, syn6288_queue_priority_t priority);
+
+/**
+ * @brief      get the priority
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *priority pointer to a priority buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_priority(syn6288_queue_t *queue, syn6288_queue_priority_t *priority);
+
+/**
+ * @brief     set the synthesis volume
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] volume synthesis volume, SYN6288_QUEUE_SETTING_HANDLE uses the handle setting
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ *            - 4 volume is invalid
+ * @note      applies to the following pushes, nothing is sent to the chip until the item is played
+ */
+uint8_t syn6288_queue_set_synthesis_volume(syn6288_queue_t *queue, uint8_t volume);
+
+/**
+ * @brief      get the synthesis volume
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *volume pointer to a synthesis volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_synthesis_volume(syn6288_queue_t *queue, uint8_t *volume);
+
+/**
+ * @brief     set the background volume
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] volume background volume, SYN6288_QUEUE_SETTING_HANDLE uses the handle setting
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ *            - 4 volume is invalid
+ * @note      applies to the following pushes, nothing is sent to the chip until the item is played
+ */
+uint8_t syn6288_queue_set_background_volume(syn6288_queue_t *queue, uint8_t volume);
+
+/**
+ * @brief      get the background volume
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *volume pointer to a background volume buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_background_volume(syn6288_queue_t *queue, uint8_t *volume);
+
+/**
+ * @brief     set the synthesis speed
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] speed synthesis speed, SYN6288_QUEUE_SETTING_HANDLE uses the handle setting
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ *            - 4 speed is invalid
+ * @note      applies to the following pushes, nothing is sent to the chip until the item is played
+ */
+uint8_t syn6288_queue_set_synthesis_speed(syn6288_queue_t *queue, uint8_t speed);
+
+/**
+ * @brief      get the synthesis speed
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *speed pointer to a synthesis speed buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_synthesis_speed(syn6288_queue_t *queue, uint8_t *speed);
+
+/**
+ * @brief     set the idle time before power down
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] ms idle time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      0 means never power down, the chip is woken when an item is queued
+ */
+uint8_t syn6288_queue_set_idle_time(syn6288_queue_t *queue, uint32_t ms);
+
+/**
+ * @brief      get the idle time before power down
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *ms pointer to an idle time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_idle_time(syn6288_queue_t *queue, uint32_t *ms);
+
+/**
+ * @brief     set the pre-wake lead time
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] ms lead time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      0 means no pre-wake, otherwise the chip is woken this long before the expected work,
+ *            which is the wake time if set or the next push predicted from the push interval
+ */
+uint8_t syn6288_queue_set_prewake(syn6288_queue_t *queue, uint32_t ms);
+
+/**
+ * @brief      get the pre-wake lead time
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *ms pointer to a lead time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_prewake(syn6288_queue_t *queue, uint32_t *ms);
+
+/**
+ * @brief     set the timestamp of the next scheduled announcement
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] timestamp announcement timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      used once by the pre-wake
+ */
+uint8_t syn6288_queue_set_wake_time(syn6288_queue_t *queue, uint32_t timestamp);
+
+/**
+ * @brief      get the chip power state
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *power pointer to a power state buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_power_state(syn6288_queue_t *queue, syn6288_queue_power_t *power);
+
+/**
+ * @brief     set the failure threshold
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] num consecutive failures before a recovery
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ *            - 4 num is invalid
+ * @note      num must be larger than 0
+ */
+uint8_t syn6288_queue_set_fail_threshold(syn6288_queue_t *queue, uint8_t num);
+
+/**
+ * @brief      get the failure threshold
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *num pointer to a failure number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_fail_threshold(syn6288_queue_t *queue, uint8_t *num);
+
+/**
+ * @brief     set the latency limit
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @param[in] ms average transaction latency in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      0 means no limit, otherwise a recovery runs when the average latency is above it
+ */
+uint8_t syn6288_queue_set_latency_limit(syn6288_queue_t *queue, uint32_t ms);
+
+/**
+ * @brief      get the latency limit
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *ms pointer to a latency limit buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       none
+ */
+uint8_t syn6288_queue_get_latency_limit(syn6288_queue_t *queue, uint32_t *ms);
+
+/**
+ * @brief      get the journal of the playing frame
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *journal pointer to a journal structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       the journal is written on every process call while the link is healthy
+ */
+uint8_t syn6288_queue_get_journal(syn6288_queue_t *queue, syn6288_queue_journal_t *journal);
+
+/**
+ * @brief      get the queue stats
+ * @param[in]  *queue pointer to a syn6288 queue structure
+ * @param[out] *stats pointer to a stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 queue is NULL
+ *             - 3 queue is not initialized
+ * @note       the time in each power state is counted up to this call
+ */
+uint8_t syn6288_queue_get_stats(syn6288_queue_t *queue, syn6288_queue_stats_t *stats);
+
+/**
+ * @brief     reset the queue stats
+ * @param[in] *queue pointer to a syn6288 queue structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 queue is NULL
+ *            - 3 queue is not initialized
+ * @note      none
+ */
+uint8_t syn6288_queue_reset_stats(syn6288_queue_t *queue);
+
+/**
+ * @brief      estimate the playing duration of a text
+ * @param[in]  type text type
+ * @param[in]  speed synthesis speed
+ * @param[in]  *buf pointer to a text buffer
+ * @param[in]  len text buffer length
+ * @param[out] *ms pointer to a duration buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 buf is NULL
+ *             - 4 speed is invalid
+ * @note       inline speed marks and prompt tones in the text are taken into account
+ */
+uint8_t syn6288_queue_estimate_duration(syn6288_type_t type, uint8_t speed, uint8_t *buf, uint16_t len, uint32_t *ms);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
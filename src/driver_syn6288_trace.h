@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_syn6288_trace.h
+ * @brief     driver syn6288 trace header file
+ * @version   2.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>2.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SYN6288_TRACE_H
+#define DRIVER_SYN6288_TRACE_H
+
+/**
+ * @defgroup syn6288_trace_driver syn6288 trace driver function
+ * @brief    syn6288 trace driver modules
+ * @ingroup  syn6288_driver
+ * @{
+ */
+
+/**
+ * @brief trace backend definition
+ * @note  0 means no tracepoints, 1 means linux usdt probes from <sys/sdt.h>
+ */
+#ifndef SYN6288_TRACE
+    #define SYN6288_TRACE    0        /**< tracepoints are disabled by default */
+#endif
+
+#if (SYN6288_TRACE == 1)
+
+#include <sys/sdt.h>
+
+/**
+ * @brief     trace a built frame before it is written
+ * @param[in] opcode frame opcode
+ * @param[in] buf pointer to the frame buffer
+ * @param[in] len frame length
+ * @note      none
+ */
+#define SYN6288_TRACE_FRAME(opcode, buf, len)    DTRACE_PROBE3(syn6288, frame, (opcode), (buf), (len))
+
+/**
+ * @brief     trace a frame written to the uart
+ * @param[in] opcode frame opcode
+ * @param[in] len frame length
+ * @note      none
+ */
+#define SYN6288_TRACE_WRITE(opcode, len)         DTRACE_PROBE2(syn6288, write, (opcode), (len))
+
+/**
+ * @brief     trace the start of an ack wait
+ * @param[in] num ack number
+ * @note      none
+ */
+#define SYN6288_TRACE_ACK_WAIT(num)              DTRACE_PROBE1(syn6288, ack_wait, (num))
+
+/**
+ * @brief     trace an answer
+ * @param[in] opcode frame opcode
+ * @param[in] res 0 ack, 1 wrong answer, 2 no answer
+ * @param[in] ms time since the write in ms
+ * @note      none
+ */
+#define SYN6288_TRACE_ACK(opcode, res, ms)       DTRACE_PROBE3(syn6288, ack, (opcode), (res), (ms))
+
+/**
+ * @brief     trace a playback status transition
+ * @param[in] playing 0 idle, 1 playing
+ * @note      none
+ */
+#define SYN6288_TRACE_STATUS(playing)            DTRACE_PROBE1(syn6288, status, (playing))
+
+#else
+
+#define SYN6288_TRACE_FRAME(opcode, buf, len)
+#define SYN6288_TRACE_WRITE(opcode, len)
+#define SYN6288_TRACE_ACK_WAIT(num)
+#define SYN6288_TRACE_ACK(opcode, res, ms)
+#define SYN6288_TRACE_STATUS(playing)
+
+#endif
+
+/**
+ * @}
+ */
+
+#endif
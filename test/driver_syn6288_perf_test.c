@@ -0,0 +1,534 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_syn6288_perf_test.c
+ * @brief     driver syn6288 perf test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_syn6288_perf_test.h"
+#include "driver_syn6288_queue.h"
+
+/**
+ * @brief syn6288 perf test answer timeout definition
+ */
+#define SYN6288_PERF_TEST_TIMEOUT 1000        /**< 1000 ms */
+
+/**
+ * @brief syn6288 perf test status poll interval definition
+ */
+#define SYN6288_PERF_TEST_POLL 20        /**< 20 ms */
+
+static syn6288_handle_t gs_handle;                                /**< syn6288 handle */
+static uint32_t gs_sample[SYN6288_PERF_TEST_MAX_TIMES];           /**< latency samples */
+static uint32_t gs_sample_2[SYN6288_PERF_TEST_MAX_TIMES];         /**< second latency samples */
+static uint32_t gs_sample_3[SYN6288_PERF_TEST_MAX_TIMES];         /**< third latency samples */
+
+/**
+ * @brief      build a frame
+ * @param[out] *frame pointer to a frame buffer
+ * @param[in]  cmd command
+ * @param[in]  *data pointer to the param and the data
+ * @param[in]  len param and data length
+ * @return     frame length
+ * @note       none
+ */
+static uint16_t a_syn6288_perf_frame(uint8_t *frame, uint8_t cmd, const uint8_t *data, uint16_t len)
+{
+    uint16_t i;
+    uint8_t xor_cal = 0;
+    
+    frame[0] = 0xFD;
+    frame[1] = (uint8_t)((len + 2) / 256);
+    frame[2] = (uint8_t)((len + 2) % 256);
+    frame[3] = cmd;
+    for (i = 0; i < len; i++)
+    {
+        frame[4 + i] = data[i];
+    }
+    for (i = 0; i < len + 4; i++)
+    {
+        xor_cal ^= frame[i];
+    }
+    frame[len + 4] = xor_cal;
+    
+    return (uint16_t)(len + 5);
+}
+
+/**
+ * @brief      write a frame and time its answer
+ * @param[in]  *frame pointer to a frame
+ * @param[in]  len frame length
+ * @param[out] *answer pointer to an answer buffer
+ * @param[in]  num answer length
+ * @param[out] *ack_ms pointer to a first answer byte time buffer
+ * @param[out] *done_ms pointer to a last answer byte time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 probe failed
+ * @note       the uart is polled every 1 ms from the write
+ */
+static uint8_t a_syn6288_perf_probe(uint8_t *frame, uint16_t len, uint8_t *answer, uint8_t num,
+                                    uint32_t *ack_ms, uint32_t *done_ms)
+{
+    uint8_t got;
+    uint32_t start;
+    uint32_t now;
+    
+    if (syn6288_interface_uart_flush() != 0)
+    {
+        syn6288_interface_debug_print("syn6288: uart flush failed.\n");
+        
+        return 1;
+    }
+    if (syn6288_interface_uart_write(frame, len) != 0)
+    {
+        syn6288_interface_debug_print("syn6288: uart write failed.\n");
+        
+        return 1;
+    }
+    start = syn6288_interface_timestamp_ms();
+    got = 0;
+    while (1)
+    {
+        got = (uint8_t)(got + syn6288_interface_uart_read(&answer[got], (uint16_t)(num - got)));
+        now = syn6288_interface_timestamp_ms();
+        if ((got != 0) && (*ack_ms == 0xFFFFFFFFU))
+        {
+            *ack_ms = now - start;
+        }
+        if (got >= num)
+        {
+            *done_ms = now - start;
+            
+            break;
+        }
+        if ((now - start) > SYN6288_PERF_TEST_TIMEOUT)
+        {
+            syn6288_interface_debug_print("syn6288: answer timeout.\n");
+            
+            return 1;
+        }
+        syn6288_interface_delay_ms(1);
+    }
+    if (answer[0] != 0x41)
+    {
+        syn6288_interface_debug_print("syn6288: answer 0x%02X is invalid.\n", answer[0]);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      time a command frame
+ * @param[in]  cmd command
+ * @param[in]  *data pointer to the param and the data
+ * @param[in]  len param and data length
+ * @param[out] *ms pointer to an ack time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 command failed
+ * @note       none
+ */
+static uint8_t a_syn6288_perf_command(uint8_t cmd, const uint8_t *data, uint16_t len, uint32_t *ms)
+{
+    uint8_t frame[5 + 200];
+    uint8_t answer[1];
+    uint16_t l;
+    uint32_t done;
+    
+    l = a_syn6288_perf_frame(frame, cmd, data, len);
+    *ms = 0xFFFFFFFFU;
+    
+    return a_syn6288_perf_probe(frame, l, answer, 1, ms, &done);
+}
+
+/**
+ * @brief      time a status query
+ * @param[out] *busy pointer to a busy flag buffer
+ * @param[out] *ack_ms pointer to an ack time buffer
+ * @param[out] *rtt_ms pointer to a round trip time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 status failed
+ * @note       none
+ */
+static uint8_t a_syn6288_perf_status(uint8_t *busy, uint32_t *ack_ms, uint32_t *rtt_ms)
+{
+    uint8_t frame[5];
+    uint8_t answer[2];
+    uint16_t l;
+    
+    l = a_syn6288_perf_frame(frame, 0x21, NULL, 0);
+    *ack_ms = 0xFFFFFFFFU;
+    if (a_syn6288_perf_probe(frame, l, answer, 2, ack_ms, rtt_ms) != 0)
+    {
+        return 1;
+    }
+    if ((answer[1] != 0x4E) && (answer[1] != 0x4F))
+    {
+        syn6288_interface_debug_print("syn6288: status 0x%02X is invalid.\n", answer[1]);
+        
+        return 1;
+    }
+    *busy = (answer[1] == 0x4E) ? 1 : 0;
+    
+    return 0;
+}
+
+/**
+ * @brief      wait until the chip is idle
+ * @param[in]  timeout max wait time in ms
+ * @param[out] *ms pointer to a waited time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 wait failed
+ * @note       the status is polled every SYN6288_PERF_TEST_POLL ms
+ */
+static uint8_t a_syn6288_perf_wait_idle(uint32_t timeout, uint32_t *ms)
+{
+    uint8_t busy;
+    uint32_t start;
+    uint32_t ack;
+    uint32_t rtt;
+    
+    start = syn6288_interface_timestamp_ms();
+    while (1)
+    {
+        if (a_syn6288_perf_status(&busy, &ack, &rtt) != 0)
+        {
+            return 1;
+        }
+        if (busy == 0)
+        {
+            *ms = syn6288_interface_timestamp_ms() - start;
+            
+            return 0;
+        }
+        if ((syn6288_interface_timestamp_ms() - start) > timeout)
+        {
+            syn6288_interface_debug_print("syn6288: wait idle timeout.\n");
+            
+            return 1;
+        }
+        syn6288_interface_delay_ms(SYN6288_PERF_TEST_POLL);
+    }
+}
+
+/**
+ * @brief     print a latency distribution
+ * @param[in] *name pointer to a name
+ * @param[in] *sample pointer to a sample buffer
+ * @param[in] num sample number
+ * @note      the samples are sorted
+ */
+static void a_syn6288_perf_print(const char *name, uint32_t *sample, uint32_t num)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t t;
+    uint32_t sum;
+    
+    if (num == 0)
+    {
+        return;
+    }
+    sum = 0;
+    for (i = 0; i < num; i++)
+    {
+        sum += sample[i];
+        t = sample[i];
+        for (j = i; (j > 0) && (sample[j - 1] > t); j--)
+        {
+            sample[j] = sample[j - 1];
+        }
+        sample[j] = t;
+    }
+    syn6288_interface_debug_print("syn6288: %s min %dms avg %dms p50 %dms p90 %dms p99 %dms max %dms.\n",
+                                  name, sample[0], sum / num, sample[num / 2], sample[(num * 9) / 10],
+                                  sample[(num * 99) / 100], sample[num - 1]);
+}
+
+/**
+ * @brief     perf test
+ * @param[in] times sample number of each latency
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      the chip is expected at 9600 bps like the other tests
+ */
+uint8_t syn6288_perf_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t busy;
+    uint8_t param;
+    uint32_t i;
+    uint32_t rounds;
+    uint32_t ms;
+    uint32_t ack;
+    uint32_t rtt;
+    uint32_t play_short;
+    uint32_t play_long;
+    uint32_t estimate;
+    uint32_t start;
+    syn6288_info_t info;
+    uint8_t text[1 + 64];
+    const uint8_t gb2312_text[] = {0xD3, 0xEE, 0xD2, 0xF4, 0xCC, 0xEC, 0xCF, 0xC2};
+    
+    /* link interface function */
+    DRIVER_SYN6288_LINK_INIT(&gs_handle, syn6288_handle_t);
+    DRIVER_SYN6288_LINK_UART_INIT(&gs_handle, syn6288_interface_uart_init);
+    DRIVER_SYN6288_LINK_UART_DEINIT(&gs_handle, syn6288_interface_uart_deinit);
+    DRIVER_SYN6288_LINK_UART_READ(&gs_handle, syn6288_interface_uart_read);
+    DRIVER_SYN6288_LINK_UART_WRITE(&gs_handle, syn6288_interface_uart_write);
+    DRIVER_SYN6288_LINK_UART_FLUSH(&gs_handle, syn6288_interface_uart_flush);
+    DRIVER_SYN6288_LINK_DELAY_MS(&gs_handle, syn6288_interface_delay_ms);
+    DRIVER_SYN6288_LINK_DEBUG_PRINT(&gs_handle, syn6288_interface_debug_print);
+    DRIVER_SYN6288_LINK_TIMESTAMP_MS(&gs_handle, syn6288_interface_timestamp_ms);
+    DRIVER_SYN6288_LINK_EVENT(&gs_handle, syn6288_interface_event);
+    
+    /* get syn6288 information */
+    res = syn6288_info(&info);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: get info failed.\n");
+       
+        return 1;
+    }
+    else
+    {
+        /* print chip information */
+        syn6288_interface_debug_print("syn6288: chip is %s.\n", info.chip_name);
+        syn6288_interface_debug_print("syn6288: manufacturer is %s.\n", info.manufacturer_name);
+        syn6288_interface_debug_print("syn6288: interface is %s.\n", info.interface);
+        syn6288_interface_debug_print("syn6288: driver version is %d.%d.\n", info.driver_version / 1000, (info.driver_version % 1000) / 100);
+        syn6288_interface_debug_print("syn6288: min supply voltage is %0.1fV.\n", info.supply_voltage_min_v);
+        syn6288_interface_debug_print("syn6288: max supply voltage is %0.1fV.\n", info.supply_voltage_max_v);
+        syn6288_interface_debug_print("syn6288: max current is %0.2fmA.\n", info.max_current_ma);
+        syn6288_interface_debug_print("syn6288: max temperature is %0.1fC.\n", info.temperature_max);
+        syn6288_interface_debug_print("syn6288: min temperature is %0.1fC.\n", info.temperature_min);
+    }
+    
+    /* start perf test */
+    syn6288_interface_debug_print("syn6288: start perf test.\n");
+    
+    /* syn6288 init */
+    res = syn6288_init(&gs_handle);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: init failed.\n");
+       
+        return 1;
+    }
+    
+    /* check the times */
+    if (times == 0)
+    {
+        times = 1;
+    }
+    if (times > SYN6288_PERF_TEST_MAX_TIMES)
+    {
+        times = SYN6288_PERF_TEST_MAX_TIMES;
+    }
+    rounds = (times + 3) / 4;
+    
+    /* stop the chip */
+    if (a_syn6288_perf_command(0x02, NULL, 0, &ack) != 0)
+    {
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_syn6288_perf_wait_idle(SYN6288_PERF_TEST_TIMEOUT, &ms) != 0)
+    {
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* ack latency */
+    syn6288_interface_debug_print("syn6288: ack latency test with %d frames.\n", times);
+    for (i = 0; i < times; i++)
+    {
+        if (a_syn6288_perf_command(0x02, NULL, 0, &gs_sample[i]) != 0)
+        {
+            (void)syn6288_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    a_syn6288_perf_print("ack latency", gs_sample, times);
+    
+    /* status round trip */
+    syn6288_interface_debug_print("syn6288: status round trip test with %d frames.\n", times);
+    for (i = 0; i < times; i++)
+    {
+        if (a_syn6288_perf_status(&busy, &gs_sample_2[i], &gs_sample[i]) != 0)
+        {
+            (void)syn6288_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    a_syn6288_perf_print("status ack", gs_sample_2, times);
+    a_syn6288_perf_print("status round trip", gs_sample, times);
+    
+    /* baud rate switch */
+    syn6288_interface_debug_print("syn6288: baud rate switch test with %d frames.\n", rounds);
+    param = 0x00;
+    for (i = 0; i < rounds; i++)
+    {
+        start = syn6288_interface_timestamp_ms();
+        if (a_syn6288_perf_command(0x31, &param, 1, &gs_sample_2[i]) != 0)
+        {
+            (void)syn6288_deinit(&gs_handle);
+            
+            return 1;
+        }
+        if (a_syn6288_perf_status(&busy, &ack, &rtt) != 0)
+        {
+            (void)syn6288_deinit(&gs_handle);
+            
+            return 1;
+        }
+        gs_sample[i] = syn6288_interface_timestamp_ms() - start;
+    }
+    a_syn6288_perf_print("baud rate ack", gs_sample_2, rounds);
+    a_syn6288_perf_print("baud rate switch to ready", gs_sample, rounds);
+    start = syn6288_interface_timestamp_ms();
+    if (syn6288_set_baud_rate(&gs_handle, SYN6288_BAUD_RATE_9600_BPS) != 0)
+    {
+        syn6288_interface_debug_print("syn6288: set baud rate failed.\n");
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: driver baud rate switch %dms.\n", syn6288_interface_timestamp_ms() - start);
+    
+    /* playback rate */
+    syn6288_interface_debug_print("syn6288: playback rate test.\n");
+    text[0] = (uint8_t)(SYN6288_MODE_COMMON | SYN6288_TYPE_GB2312);
+    for (i = 0; i < 8; i++)
+    {
+        memcpy(&text[1 + i * 8], gb2312_text, 8);
+    }
+    if (a_syn6288_perf_command(0x01, text, 1 + 16, &ack) != 0)
+    {
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: text ack of 16 bytes %dms.\n", ack);
+    if (a_syn6288_perf_wait_idle(60000, &play_short) != 0)
+    {
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if (a_syn6288_perf_command(0x01, text, 1 + 64, &ack) != 0)
+    {
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: text ack of 64 bytes %dms.\n", ack);
+    if (a_syn6288_perf_wait_idle(60000, &play_long) != 0)
+    {
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: 8 chars played in %dms, 32 chars played in %dms.\n", play_short, play_long);
+    if (play_long > play_short)
+    {
+        ms = (play_long - play_short) / 24;
+        syn6288_interface_debug_print("syn6288: playback rate %dms per char, %d.%d chars per second.\n",
+                                      ms, 24000 / (play_long - play_short),
+                                      (240000 / (play_long - play_short)) % 10);
+    }
+    if (syn6288_queue_estimate_duration(SYN6288_TYPE_GB2312, 5, &text[1], 64, &estimate) == 0)
+    {
+        syn6288_interface_debug_print("syn6288: 32 chars estimated %dms, played at %d%% of the estimate.\n",
+                                      estimate, (estimate != 0) ? (play_long * 100 / estimate) : 0);
+    }
+    
+    /* stop, pause and resume */
+    syn6288_interface_debug_print("syn6288: stop, pause and resume test with %d rounds.\n", rounds);
+    for (i = 0; i < rounds; i++)
+    {
+        if (a_syn6288_perf_command(0x01, text, 1 + 64, &ack) != 0)
+        {
+            (void)syn6288_deinit(&gs_handle);
+            
+            return 1;
+        }
+        syn6288_interface_delay_ms(500);
+        if (a_syn6288_perf_command(0x03, NULL, 0, &gs_sample[i]) != 0)
+        {
+            (void)syn6288_deinit(&gs_handle);
+            
+            return 1;
+        }
+        syn6288_interface_delay_ms(200);
+        if (a_syn6288_perf_command(0x04, NULL, 0, &gs_sample_2[i]) != 0)
+        {
+            (void)syn6288_deinit(&gs_handle);
+            
+            return 1;
+        }
+        syn6288_interface_delay_ms(200);
+        start = syn6288_interface_timestamp_ms();
+        if (a_syn6288_perf_command(0x02, NULL, 0, &ack) != 0)
+        {
+            (void)syn6288_deinit(&gs_handle);
+            
+            return 1;
+        }
+        if (a_syn6288_perf_wait_idle(SYN6288_PERF_TEST_TIMEOUT, &ms) != 0)
+        {
+            (void)syn6288_deinit(&gs_handle);
+            
+            return 1;
+        }
+        gs_sample_3[i] = syn6288_interface_timestamp_ms() - start;
+    }
+    a_syn6288_perf_print("pause ack", gs_sample, rounds);
+    a_syn6288_perf_print("resume ack", gs_sample_2, rounds);
+    a_syn6288_perf_print("stop to idle", gs_sample_3, rounds);
+    
+    /* finish perf test */
+    syn6288_interface_debug_print("syn6288: finish perf test.\n");
+    (void)syn6288_deinit(&gs_handle);
+    
+    return 0;
+}
@@ -0,0 +1,1245 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_syn6288_queue_test.c
+ * @brief     driver syn6288 queue test source file
+ * @version   2.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-19
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/19  <td>2.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_syn6288_queue_test.h"
+#include "driver_syn6288_queue.h"
+
+static syn6288_handle_t gs_handle;        /**< syn6288 handle */
+static syn6288_queue_t gs_queue;          /**< syn6288 queue */
+
+/**
+ * @brief      play a group of texts through the queue
+ * @param[in]  **text pointer to a text list
+ * @param[in]  num text number
+ * @param[out] *ms pointer to an elapsed time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 play failed
+ * @note       none
+ */
+static uint8_t a_syn6288_queue_test_play(char **text, uint8_t num, uint32_t *ms)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t count;
+    uint32_t id;
+    uint32_t start;
+    
+    start = syn6288_interface_timestamp_ms();
+    for (i = 0; i < num; i++)
+    {
+        res = syn6288_queue_push(&gs_queue, (uint8_t *)text[i], (uint16_t)strlen(text[i]), &id);
+        if (res != 0)
+        {
+            syn6288_interface_debug_print("syn6288: queue push failed.\n");
+            
+            return 1;
+        }
+        syn6288_interface_debug_print("syn6288: push item %d.\n", id);
+    }
+    count = num;
+    while (count != 0)
+    {
+        res = syn6288_queue_process(&gs_queue);
+        if (res != 0)
+        {
+            syn6288_interface_debug_print("syn6288: queue process failed.\n");
+            
+            return 1;
+        }
+        res = syn6288_queue_get_count(&gs_queue, &count);
+        if (res != 0)
+        {
+            syn6288_interface_debug_print("syn6288: queue get count failed.\n");
+            
+            return 1;
+        }
+        syn6288_interface_delay_ms(10);
+    }
+    *ms = syn6288_interface_timestamp_ms() - start;
+    
+    return 0;
+}
+
+/**
+ * @brief  queue test
+ * @return status code
+ *         - 0 success
+ *         - 1 test failed
+ * @note   none
+ */
+uint8_t syn6288_queue_test(void)
+{
+    uint8_t res;
+    uint32_t ms;
+    uint32_t ms_check;
+    uint32_t frames;
+    uint32_t frames_check;
+    syn6288_stats_t chip_stats;
+    syn6288_info_t info;
+    uint32_t window;
+    uint32_t threshold;
+    uint32_t deadline;
+    uint32_t ttl;
+    uint8_t value;
+    uint8_t count;
+    uint32_t start;
+    syn6288_queue_priority_t priority;
+    syn6288_queue_power_t power;
+    uint32_t idle;
+    uint8_t threshold_num;
+    syn6288_queue_journal_t journal;
+    uint32_t limit;
+    uint32_t id;
+    syn6288_bool_t enable;
+    syn6288_queue_dedupe_t mode;
+    syn6288_queue_stats_t stats;
+    char *text[4] = {"door open", "light on", "fan off", "alarm set"};
+    char *alarm[4] = {"pump alarm", "pump alarm", "pump alarm", "pump alarm"};
+    char train[] = "train arriving now";
+    char news[] = "the weather today is sunny, the wind is light, the temperature is mild.";
+    char fire[] = "fire alarm";
+    
+    /* link interface function */
+    DRIVER_SYN6288_LINK_INIT(&gs_handle, syn6288_handle_t);
+    DRIVER_SYN6288_LINK_UART_INIT(&gs_handle, syn6288_interface_uart_init);
+    DRIVER_SYN6288_LINK_UART_DEINIT(&gs_handle, syn6288_interface_uart_deinit);
+    DRIVER_SYN6288_LINK_UART_READ(&gs_handle, syn6288_interface_uart_read);
+    DRIVER_SYN6288_LINK_UART_WRITE(&gs_handle, syn6288_interface_uart_write);
+    DRIVER_SYN6288_LINK_UART_FLUSH(&gs_handle, syn6288_interface_uart_flush);
+    DRIVER_SYN6288_LINK_DELAY_MS(&gs_handle, syn6288_interface_delay_ms);
+    DRIVER_SYN6288_LINK_DEBUG_PRINT(&gs_handle, syn6288_interface_debug_print);
+    DRIVER_SYN6288_LINK_TIMESTAMP_MS(&gs_handle, syn6288_interface_timestamp_ms);
+    DRIVER_SYN6288_LINK_EVENT(&gs_handle, syn6288_interface_event);
+    
+    /* link queue function */
+    DRIVER_SYN6288_QUEUE_LINK_INIT(&gs_queue, syn6288_queue_t);
+    DRIVER_SYN6288_QUEUE_LINK_TIMESTAMP_MS(&gs_queue, syn6288_interface_timestamp_ms);
+    DRIVER_SYN6288_QUEUE_LINK_RECEIVE_CALLBACK(&gs_queue, syn6288_interface_receive_callback);
+    
+    /* get syn6288 information */
+    res = syn6288_info(&info);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: get info failed.\n");
+       
+        return 1;
+    }
+    else
+    {
+        /* print chip information */
+        syn6288_interface_debug_print("syn6288: chip is %s.\n", info.chip_name);
+        syn6288_interface_debug_print("syn6288: manufacturer is %s.\n", info.manufacturer_name);
+        syn6288_interface_debug_print("syn6288: interface is %s.\n", info.interface);
+        syn6288_interface_debug_print("syn6288: driver version is %d.%d.\n", info.driver_version / 1000, (info.driver_version % 1000) / 100);
+        syn6288_interface_debug_print("syn6288: min supply voltage is %0.1fV.\n", info.supply_voltage_min_v);
+        syn6288_interface_debug_print("syn6288: max supply voltage is %0.1fV.\n", info.supply_voltage_max_v);
+        syn6288_interface_debug_print("syn6288: max current is %0.2fmA.\n", info.max_current_ma);
+        syn6288_interface_debug_print("syn6288: max temperature is %0.1fC.\n", info.temperature_max);
+        syn6288_interface_debug_print("syn6288: min temperature is %0.1fC.\n", info.temperature_min);
+    }
+    
+    /* syn6288 init */
+    res = syn6288_init(&gs_handle);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: init failed.\n");
+       
+        return 1;
+    }
+    
+    /* set baud rate 9600 bps */
+    res = syn6288_set_baud_rate(&gs_handle, SYN6288_BAUD_RATE_9600_BPS);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: set baud rate failed.\n");
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set common mode */
+    res = syn6288_set_mode(&gs_handle, SYN6288_MODE_COMMON);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: set mode failed.\n");
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* set gb2312 text type */
+    res = syn6288_set_text_type(&gs_handle, SYN6288_TYPE_GB2312);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: set text type failed.\n");
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* queue init */
+    res = syn6288_queue_init(&gs_queue, &gs_handle);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue init failed.\n");
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: start queue test.\n");
+    
+    /* syn6288_queue_set_coalesce/syn6288_queue_get_coalesce test */
+    syn6288_interface_debug_print("syn6288: syn6288_queue_set_coalesce/syn6288_queue_get_coalesce test.\n");
+    
+    /* disable coalesce */
+    res = syn6288_queue_set_coalesce(&gs_queue, SYN6288_BOOL_FALSE);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set coalesce failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: disable coalesce.\n");
+    res = syn6288_queue_get_coalesce(&gs_queue, &enable);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get coalesce failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: check coalesce %s.\n", enable == SYN6288_BOOL_FALSE ? "ok" : "error");
+    res = syn6288_get_stats(&gs_handle, &chip_stats);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: get stats failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    frames = chip_stats.opcode[SYN6288_OPCODE_SYNTHESIS].frames;
+    res = a_syn6288_queue_test_play(text, 4, &ms);
+    if (res != 0)
+    {
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = syn6288_get_stats(&gs_handle, &chip_stats);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: get stats failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    frames = chip_stats.opcode[SYN6288_OPCODE_SYNTHESIS].frames - frames;
+    syn6288_interface_debug_print("syn6288: play 4 items in %d ms, %d frames.\n", ms, frames);
+    
+    /* enable coalesce */
+    res = syn6288_queue_set_coalesce(&gs_queue, SYN6288_BOOL_TRUE);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set coalesce failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: enable coalesce.\n");
+    res = syn6288_queue_get_coalesce(&gs_queue, &enable);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get coalesce failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: check coalesce %s.\n", enable == SYN6288_BOOL_TRUE ? "ok" : "error");
+    res = syn6288_get_stats(&gs_handle, &chip_stats);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: get stats failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    frames_check = chip_stats.opcode[SYN6288_OPCODE_SYNTHESIS].frames;
+    res = a_syn6288_queue_test_play(text, 4, &ms_check);
+    if (res != 0)
+    {
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = syn6288_get_stats(&gs_handle, &chip_stats);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: get stats failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    frames_check = chip_stats.opcode[SYN6288_OPCODE_SYNTHESIS].frames - frames_check;
+    syn6288_interface_debug_print("syn6288: play 4 items in %d ms, %d frames.\n", ms_check, frames_check);
+    syn6288_interface_debug_print("syn6288: check coalesce frames %s.\n", frames_check < frames ? "ok" : "error");
+    
+    /* syn6288_queue_set_dedupe_window/syn6288_queue_get_dedupe_window test */
+    syn6288_interface_debug_print("syn6288: syn6288_queue_set_dedupe_window/syn6288_queue_get_dedupe_window test.\n");
+    res = syn6288_queue_set_dedupe_window(&gs_queue, 5000);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set dedupe window failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: set dedupe window 5000 ms.\n");
+    res = syn6288_queue_get_dedupe_window(&gs_queue, &window);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get dedupe window failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: check dedupe window %s.\n", window == 5000 ? "ok" : "error");
+    
+    /* syn6288_queue_set_dedupe_mode/syn6288_queue_get_dedupe_mode test */
+    syn6288_interface_debug_print("syn6288: syn6288_queue_set_dedupe_mode/syn6288_queue_get_dedupe_mode test.\n");
+    res = syn6288_queue_set_dedupe_mode(&gs_queue, SYN6288_QUEUE_DEDUPE_EXTEND);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set dedupe mode failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: set dedupe mode extend.\n");
+    res = syn6288_queue_get_dedupe_mode(&gs_queue, &mode);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get dedupe mode failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: check dedupe mode %s.\n", mode == SYN6288_QUEUE_DEDUPE_EXTEND ? "ok" : "error");
+    
+    /* dedupe test */
+    syn6288_interface_debug_print("syn6288: dedupe test.\n");
+    res = syn6288_queue_reset_stats(&gs_queue);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue reset stats failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = a_syn6288_queue_test_play(alarm, 4, &ms);
+    if (res != 0)
+    {
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = syn6288_queue_get_stats(&gs_queue, &stats);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get stats failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: pushed %d, suppressed %d, extended %d.\n",
+                                  stats.pushed, stats.suppressed, stats.extended);
+    syn6288_interface_debug_print("syn6288: check dedupe %s.\n", ((stats.pushed == 1) && (stats.suppressed == 3)) ? "ok" : "error");
+    
+    /* syn6288_queue_set_backlog_threshold/syn6288_queue_get_backlog_threshold test */
+    syn6288_interface_debug_print("syn6288: syn6288_queue_set_backlog_threshold/syn6288_queue_get_backlog_threshold test.\n");
+    res = syn6288_queue_set_backlog_threshold(&gs_queue, 2000);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set backlog threshold failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: set backlog threshold 2000 ms.\n");
+    res = syn6288_queue_get_backlog_threshold(&gs_queue, &threshold);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get backlog threshold failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: check backlog threshold %s.\n", threshold == 2000 ? "ok" : "error");
+    
+    /* syn6288_queue_set_adaptive_speed/syn6288_queue_get_adaptive_speed test */
+    syn6288_interface_debug_print("syn6288: syn6288_queue_set_adaptive_speed/syn6288_queue_get_adaptive_speed test.\n");
+    res = syn6288_queue_set_adaptive_speed(&gs_queue, SYN6288_BOOL_TRUE);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set adaptive speed failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: enable adaptive speed.\n");
+    res = syn6288_queue_get_adaptive_speed(&gs_queue, &enable);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get adaptive speed failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: check adaptive speed %s.\n", enable == SYN6288_BOOL_TRUE ? "ok" : "error");
+    
+    /* adaptive speed test */
+    syn6288_interface_debug_print("syn6288: adaptive speed test.\n");
+    res = syn6288_queue_set_coalesce(&gs_queue, SYN6288_BOOL_FALSE);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set coalesce failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = a_syn6288_queue_test_play(text, 4, &ms_check);
+    if (res != 0)
+    {
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: play 4 items in %d ms.\n", ms_check);
+    res = syn6288_queue_get_stats(&gs_queue, &stats);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get stats failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: rate changes %d, boosted frames %d.\n", stats.rate_changes, stats.rate_boosted);
+    syn6288_interface_debug_print("syn6288: check adaptive speed %s.\n", stats.rate_boosted != 0 ? "ok" : "error");
+    
+    /* syn6288_queue_set_ttl/syn6288_queue_get_ttl test */
+    syn6288_interface_debug_print("syn6288: syn6288_queue_set_ttl/syn6288_queue_get_ttl test.\n");
+    res = syn6288_queue_set_ttl(&gs_queue, 60000);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set ttl failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: set ttl %d ms.\n", 60000);
+    res = syn6288_queue_get_ttl(&gs_queue, &ttl);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get ttl failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: check ttl %s.\n", ttl == 60000 ? "ok" : "error");
+    
+    /* syn6288_queue_set_value/syn6288_queue_get_value test */
+    syn6288_interface_debug_print("syn6288: syn6288_queue_set_value/syn6288_queue_get_value test.\n");
+    res = syn6288_queue_set_value(&gs_queue, 10);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set value failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: set value %d.\n", 10);
+    res = syn6288_queue_get_value(&gs_queue, &value);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get value failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: check value %s.\n", value == 10 ? "ok" : "error");
+    
+    /* syn6288_queue_set_deadline/syn6288_queue_get_deadline test */
+    syn6288_interface_debug_print("syn6288: syn6288_queue_set_deadline/syn6288_queue_get_deadline test.\n");
+    res = syn6288_queue_set_deadline(&gs_queue, 500);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set deadline failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: set deadline %d ms.\n", 500);
+    res = syn6288_queue_get_deadline(&gs_queue, &deadline);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get deadline failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: check deadline %s.\n", deadline == 500 ? "ok" : "error");
+    
+    /* deadline test */
+    syn6288_interface_debug_print("syn6288: deadline test.\n");
+    res = syn6288_queue_reset_stats(&gs_queue);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue reset stats failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = syn6288_queue_push(&gs_queue, (uint8_t *)text[0], (uint16_t)strlen(text[0]), &id);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue push failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: push item %d.\n", id);
+    res = syn6288_queue_push(&gs_queue, (uint8_t *)text[1], (uint16_t)strlen(text[1]), &id);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue push failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: push item %d.\n", id);
+    res = syn6288_queue_set_value(&gs_queue, 200);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set value failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = syn6288_queue_set_deadline(&gs_queue, 2000);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set deadline failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = syn6288_queue_push(&gs_queue, (uint8_t *)train, (uint16_t)strlen(train), &id);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue push failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: push item %d.\n", id);
+    count = 3;
+    while (count != 0)
+    {
+        res = syn6288_queue_process(&gs_queue);
+        if (res != 0)
+        {
+            syn6288_interface_debug_print("syn6288: queue process failed.\n");
+            (void)syn6288_queue_deinit(&gs_queue);
+            (void)syn6288_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = syn6288_queue_get_count(&gs_queue, &count);
+        if (res != 0)
+        {
+            syn6288_interface_debug_print("syn6288: queue get count failed.\n");
+            (void)syn6288_queue_deinit(&gs_queue);
+            (void)syn6288_deinit(&gs_handle);
+            
+            return 1;
+        }
+        syn6288_interface_delay_ms(10);
+    }
+    res = syn6288_queue_get_stats(&gs_queue, &stats);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get stats failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: expired %d, missed %d, shed %d.\n", stats.expired, stats.missed, stats.shed);
+    syn6288_interface_debug_print("syn6288: check deadline %s.\n", ((stats.missed == 1) && (stats.shed == 1)) ? "ok" : "error");
+    res = syn6288_queue_set_deadline(&gs_queue, 0);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set deadline failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* deadline priority test */
+    syn6288_interface_debug_print("syn6288: deadline priority test.\n");
+    res = syn6288_queue_reset_stats(&gs_queue);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue reset stats failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = syn6288_queue_set_priority(&gs_queue, SYN6288_QUEUE_PRIORITY_EMERGENCY);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set priority failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = syn6288_queue_set_value(&gs_queue, 100);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set value failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = syn6288_queue_push(&gs_queue, (uint8_t *)fire, (uint16_t)strlen(fire), &id);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue push failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: push emergency item %d.\n", id);
+    res = syn6288_queue_set_priority(&gs_queue, SYN6288_QUEUE_PRIORITY_LOW);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set priority failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = syn6288_queue_set_value(&gs_queue, 200);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set value failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = syn6288_queue_set_deadline(&gs_queue, 500);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set deadline failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = syn6288_queue_push(&gs_queue, (uint8_t *)train, (uint16_t)strlen(train), &id);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue push failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: push low item %d.\n", id);
+    count = 2;
+    while (count != 0)
+    {
+        res = syn6288_queue_process(&gs_queue);
+        if (res != 0)
+        {
+            syn6288_interface_debug_print("syn6288: queue process failed.\n");
+            (void)syn6288_queue_deinit(&gs_queue);
+            (void)syn6288_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = syn6288_queue_get_count(&gs_queue, &count);
+        if (res != 0)
+        {
+            syn6288_interface_debug_print("syn6288: queue get count failed.\n");
+            (void)syn6288_queue_deinit(&gs_queue);
+            (void)syn6288_deinit(&gs_handle);
+            
+            return 1;
+        }
+        syn6288_interface_delay_ms(10);
+    }
+    res = syn6288_queue_get_stats(&gs_queue, &stats);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get stats failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: pushed %d, missed %d, shed %d.\n", stats.pushed, stats.missed, stats.shed);
+    syn6288_interface_debug_print("syn6288: check emergency item %s.\n", ((stats.shed == 0) && (stats.missed == 1)) ? "ok" : "error");
+    if ((stats.shed != 0) || (stats.missed != 1))
+    {
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = syn6288_queue_set_deadline(&gs_queue, 0);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set deadline failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = syn6288_queue_set_priority(&gs_queue, SYN6288_QUEUE_PRIORITY_NORMAL);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set priority failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* syn6288_queue_set_priority/syn6288_queue_get_priority test */
+    syn6288_interface_debug_print("syn6288: syn6288_queue_set_priority/syn6288_queue_get_priority test.\n");
+    res = syn6288_queue_set_priority(&gs_queue, SYN6288_QUEUE_PRIORITY_EMERGENCY);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set priority failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: set priority emergency.\n");
+    res = syn6288_queue_get_priority(&gs_queue, &priority);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get priority failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: check priority %s.\n", priority == SYN6288_QUEUE_PRIORITY_EMERGENCY ? "ok" : "error");
+    res = syn6288_queue_set_priority(&gs_queue, SYN6288_QUEUE_PRIORITY_NORMAL);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set priority failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* syn6288_queue_set_synthesis_volume/syn6288_queue_get_synthesis_volume test */
+    syn6288_interface_debug_print("syn6288: syn6288_queue_set_synthesis_volume/syn6288_queue_get_synthesis_volume test.\n");
+    res = syn6288_queue_set_synthesis_volume(&gs_queue, 10);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set synthesis volume failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: set synthesis volume 10.\n");
+    res = syn6288_queue_get_synthesis_volume(&gs_queue, &value);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get synthesis volume failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: check synthesis volume %s.\n", value == 10 ? "ok" : "error");
+    res = syn6288_queue_set_synthesis_volume(&gs_queue, SYN6288_QUEUE_SETTING_HANDLE);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set synthesis volume failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* syn6288_queue_set_background_volume/syn6288_queue_get_background_volume test */
+    syn6288_interface_debug_print("syn6288: syn6288_queue_set_background_volume/syn6288_queue_get_background_volume test.\n");
+    res = syn6288_queue_set_background_volume(&gs_queue, 5);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set background volume failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: set background volume 5.\n");
+    res = syn6288_queue_get_background_volume(&gs_queue, &value);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get background volume failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: check background volume %s.\n", value == 5 ? "ok" : "error");
+    res = syn6288_queue_set_background_volume(&gs_queue, SYN6288_QUEUE_SETTING_HANDLE);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set background volume failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* syn6288_queue_set_synthesis_speed/syn6288_queue_get_synthesis_speed test */
+    syn6288_interface_debug_print("syn6288: syn6288_queue_set_synthesis_speed/syn6288_queue_get_synthesis_speed test.\n");
+    res = syn6288_queue_set_synthesis_speed(&gs_queue, 3);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set synthesis speed failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: set synthesis speed 3.\n");
+    res = syn6288_queue_get_synthesis_speed(&gs_queue, &value);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get synthesis speed failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: check synthesis speed %s.\n", value == 3 ? "ok" : "error");
+    res = syn6288_queue_set_synthesis_speed(&gs_queue, SYN6288_QUEUE_SETTING_HANDLE);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set synthesis speed failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* preempt test */
+    syn6288_interface_debug_print("syn6288: preempt test.\n");
+    res = syn6288_queue_reset_stats(&gs_queue);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue reset stats failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = syn6288_queue_push(&gs_queue, (uint8_t *)news, (uint16_t)strlen(news), &id);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue push failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: push item %d.\n", id);
+    start = syn6288_interface_timestamp_ms();
+    while ((syn6288_interface_timestamp_ms() - start) < 3000)
+    {
+        res = syn6288_queue_process(&gs_queue);
+        if (res != 0)
+        {
+            syn6288_interface_debug_print("syn6288: queue process failed.\n");
+            (void)syn6288_queue_deinit(&gs_queue);
+            (void)syn6288_deinit(&gs_handle);
+            
+            return 1;
+        }
+        syn6288_interface_delay_ms(10);
+    }
+    res = syn6288_queue_set_priority(&gs_queue, SYN6288_QUEUE_PRIORITY_EMERGENCY);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set priority failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = syn6288_queue_push(&gs_queue, (uint8_t *)fire, (uint16_t)strlen(fire), &id);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue push failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: push item %d.\n", id);
+    res = syn6288_queue_set_priority(&gs_queue, SYN6288_QUEUE_PRIORITY_NORMAL);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set priority failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    count = 2;
+    while (count != 0)
+    {
+        res = syn6288_queue_process(&gs_queue);
+        if (res != 0)
+        {
+            syn6288_interface_debug_print("syn6288: queue process failed.\n");
+            (void)syn6288_queue_deinit(&gs_queue);
+            (void)syn6288_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = syn6288_queue_get_count(&gs_queue, &count);
+        if (res != 0)
+        {
+            syn6288_interface_debug_print("syn6288: queue get count failed.\n");
+            (void)syn6288_queue_deinit(&gs_queue);
+            (void)syn6288_deinit(&gs_handle);
+            
+            return 1;
+        }
+        syn6288_interface_delay_ms(10);
+    }
+    res = syn6288_queue_get_stats(&gs_queue, &stats);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get stats failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: preempted %d.\n", stats.preempted);
+    syn6288_interface_debug_print("syn6288: check preempt %s.\n", stats.preempted == 1 ? "ok" : "error");
+    
+    /* syn6288_queue_set_idle_time/syn6288_queue_get_idle_time test */
+    syn6288_interface_debug_print("syn6288: syn6288_queue_set_idle_time/syn6288_queue_get_idle_time test.\n");
+    res = syn6288_queue_set_idle_time(&gs_queue, 1000);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set idle time failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: set idle time 1000 ms.\n");
+    res = syn6288_queue_get_idle_time(&gs_queue, &idle);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get idle time failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: check idle time %s.\n", idle == 1000 ? "ok" : "error");
+    
+    /* power test */
+    syn6288_interface_debug_print("syn6288: power test.\n");
+    res = syn6288_queue_reset_stats(&gs_queue);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue reset stats failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    start = syn6288_interface_timestamp_ms();
+    while ((syn6288_interface_timestamp_ms() - start) < 3000)
+    {
+        res = syn6288_queue_process(&gs_queue);
+        if (res != 0)
+        {
+            syn6288_interface_debug_print("syn6288: queue process failed.\n");
+            (void)syn6288_queue_deinit(&gs_queue);
+            (void)syn6288_deinit(&gs_handle);
+            
+            return 1;
+        }
+        syn6288_interface_delay_ms(10);
+    }
+    res = syn6288_queue_get_power_state(&gs_queue, &power);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get power state failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: check power down %s.\n", power == SYN6288_QUEUE_POWER_DOWN ? "ok" : "error");
+    res = a_syn6288_queue_test_play(&text[0], 1, &ms);
+    if (res != 0)
+    {
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = syn6288_queue_get_stats(&gs_queue, &stats);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get stats failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: wake latency %d ms.\n", stats.wake_latency);
+    syn6288_interface_debug_print("syn6288: time on %d ms, time down %d ms.\n", stats.time_on, stats.time_down);
+    syn6288_interface_debug_print("syn6288: check wake up %s.\n", ((stats.power_downs == 1) && (stats.wakes == 1)) ? "ok" : "error");
+    res = syn6288_queue_set_idle_time(&gs_queue, 0);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set idle time failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
+    /* syn6288_queue_set_fail_threshold/syn6288_queue_get_fail_threshold test */
+    syn6288_interface_debug_print("syn6288: syn6288_queue_set_fail_threshold/syn6288_queue_get_fail_threshold test.\n");
+    res = syn6288_queue_set_fail_threshold(&gs_queue, 5);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set fail threshold failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: set fail threshold 5.\n");
+    res = syn6288_queue_get_fail_threshold(&gs_queue, &threshold_num);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get fail threshold failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: check fail threshold %s.\n", threshold_num == 5 ? "ok" : "error");
+    
+    /* syn6288_queue_set_latency_limit/syn6288_queue_get_latency_limit test */
+    syn6288_interface_debug_print("syn6288: syn6288_queue_set_latency_limit/syn6288_queue_get_latency_limit test.\n");
+    res = syn6288_queue_set_latency_limit(&gs_queue, 1000);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue set latency limit failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: set latency limit 1000 ms.\n");
+    res = syn6288_queue_get_latency_limit(&gs_queue, &limit);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get latency limit failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: check latency limit %s.\n", limit == 1000 ? "ok" : "error");
+    
+    /* health test */
+    syn6288_interface_debug_print("syn6288: health test.\n");
+    res = a_syn6288_queue_test_play(&text[1], 1, &ms);
+    if (res != 0)
+    {
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = syn6288_queue_get_stats(&gs_queue, &stats);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get stats failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: latency %d ms, max %d ms.\n", stats.latency, stats.latency_max);
+    syn6288_interface_debug_print("syn6288: link failures %d, recoveries %d.\n", stats.link_failures, stats.recoveries);
+    syn6288_interface_debug_print("syn6288: check health %s.\n", stats.link_failures == 0 ? "ok" : "error");
+    
+    /* journal test */
+    syn6288_interface_debug_print("syn6288: journal test.\n");
+    res = syn6288_queue_push(&gs_queue, (uint8_t *)news, (uint16_t)strlen(news), &id);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue push failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: push item %d.\n", id);
+    start = syn6288_interface_timestamp_ms();
+    while ((syn6288_interface_timestamp_ms() - start) < 5000)
+    {
+        res = syn6288_queue_process(&gs_queue);
+        if (res != 0)
+        {
+            syn6288_interface_debug_print("syn6288: queue process failed.\n");
+            (void)syn6288_queue_deinit(&gs_queue);
+            (void)syn6288_deinit(&gs_handle);
+            
+            return 1;
+        }
+        syn6288_interface_delay_ms(10);
+    }
+    res = syn6288_queue_get_journal(&gs_queue, &journal);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: queue get journal failed.\n");
+        (void)syn6288_queue_deinit(&gs_queue);
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: journal item %d segment %d offset %d ms.\n", journal.id, journal.segment, journal.offset);
+    syn6288_interface_debug_print("syn6288: check journal %s.\n", ((journal.valid != 0) && (journal.id == id) && (journal.segment != 0)) ? "ok" : "error");
+    count = 1;
+    while (count != 0)
+    {
+        res = syn6288_queue_process(&gs_queue);
+        if (res != 0)
+        {
+            syn6288_interface_debug_print("syn6288: queue process failed.\n");
+            (void)syn6288_queue_deinit(&gs_queue);
+            (void)syn6288_deinit(&gs_handle);
+            
+            return 1;
+        }
+        res = syn6288_queue_get_count(&gs_queue, &count);
+        if (res != 0)
+        {
+            syn6288_interface_debug_print("syn6288: queue get count failed.\n");
+            (void)syn6288_queue_deinit(&gs_queue);
+            (void)syn6288_deinit(&gs_handle);
+            
+            return 1;
+        }
+        syn6288_interface_delay_ms(10);
+    }
+    
+    /* finish queue test */
+    syn6288_interface_debug_print("syn6288: finish queue test.\n");
+    (void)syn6288_queue_deinit(&gs_queue);
+    (void)syn6288_deinit(&gs_handle);
+    
+    return 0;
+}
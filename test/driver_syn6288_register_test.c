@@ -51,6 +51,9 @@ uint8_t syn6288_register_test(void)
     uint8_t res;
     uint8_t volume;
     uint8_t speed;
+    uint8_t code;
+    uint8_t command;
+    uint32_t value;
     char s[32];
     syn6288_baud_rate_t rate;
     syn6288_mode_t mode;
@@ -66,6 +69,8 @@ uint8_t syn6288_register_test(void)
     DRIVER_SYN6288_LINK_UART_FLUSH(&gs_handle, syn6288_interface_uart_flush);
     DRIVER_SYN6288_LINK_DELAY_MS(&gs_handle, syn6288_interface_delay_ms);
     DRIVER_SYN6288_LINK_DEBUG_PRINT(&gs_handle, syn6288_interface_debug_print);
+    DRIVER_SYN6288_LINK_TIMESTAMP_MS(&gs_handle, syn6288_interface_timestamp_ms);
+    DRIVER_SYN6288_LINK_EVENT(&gs_handle, syn6288_interface_event);
     
     /* get syn6288 information */
     res = syn6288_info(&info);
@@ -305,6 +310,24 @@ uint8_t syn6288_register_test(void)
     }
     syn6288_interface_debug_print("syn6288: check command %s.\n", res==0?"ok":"error");
     
+    /* syn6288_interface_event test */
+    syn6288_interface_debug_print("syn6288: syn6288_interface_event test.\n");
+    while (syn6288_interface_event_read(&code, &command, &value) == 0)
+    {
+        continue;
+    }
+    res = syn6288_set_synthesis_speed(&gs_handle, 6);
+    if (res == 0)
+    {
+        syn6288_interface_debug_print("syn6288: set synthesis speed 6 should fail.\n");
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: set invalid synthesis speed 6.\n");
+    res = syn6288_interface_event_read(&code, &command, &value);
+    syn6288_interface_debug_print("syn6288: check event %s.\n", ((res == 0) && (code == SYN6288_EVENT_PARAM_INVALID) && (value == 6)) ? "ok" : "error");
+    
     /* finish register test */
     syn6288_interface_debug_print("syn6288: finish register test.\n");
     (void)syn6288_deinit(&gs_handle);
@@ -51,6 +51,10 @@ uint8_t syn6288_synthesis_test(void)
     uint8_t res;
     syn6288_info_t info;
     syn6288_status_t status;
+    syn6288_stats_t stats;
+    syn6288_sequence_item_t item[4];
+    uint32_t frames;
+    uint8_t i;
     char s[32];
     uint8_t gb2312_text[] = {0xD3, 0xEE, 0xD2, 0xF4, 0xCC, 0xEC, 0xCF, 0xC2, 0x00};
     uint8_t gbk_text[] = {0xD3, 0xEE, 0xD2, 0xF4, 0xCC, 0xEC, 0xCF, 0xC2, 0x00};
@@ -66,6 +70,8 @@ uint8_t syn6288_synthesis_test(void)
     DRIVER_SYN6288_LINK_UART_FLUSH(&gs_handle, syn6288_interface_uart_flush);
     DRIVER_SYN6288_LINK_DELAY_MS(&gs_handle, syn6288_interface_delay_ms);
     DRIVER_SYN6288_LINK_DEBUG_PRINT(&gs_handle, syn6288_interface_debug_print);
+    DRIVER_SYN6288_LINK_TIMESTAMP_MS(&gs_handle, syn6288_interface_timestamp_ms);
+    DRIVER_SYN6288_LINK_EVENT(&gs_handle, syn6288_interface_event);
     
     /* get syn6288 information */
     res = syn6288_info(&info);
@@ -298,6 +304,39 @@ uint8_t syn6288_synthesis_test(void)
         return 1;
     }
     
+    /* barge in test */
+    syn6288_interface_debug_print("syn6288: barge in test.\n");
+    res = syn6288_synthesis_text(&gs_handle, (char *)gb2312_text);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: synthesis text failed.\n");
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_delay_ms(1000);
+    res = syn6288_barge_in(&gs_handle, (char *)gb2312_text);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: barge in failed.\n");
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    status = SYN6288_STATUS_BUSY;
+    while (status == SYN6288_STATUS_BUSY)
+    {
+        syn6288_interface_delay_ms(500);
+        res = syn6288_get_status(&gs_handle, &status);
+        if (res != 0)
+        {
+            syn6288_interface_debug_print("syn6288: get status failed.\n");
+            (void)syn6288_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    
     /* synthesis sound test */
     syn6288_interface_debug_print("syn6288: synthesis sound test.\n");
     res = syn6288_synthesis_sound(&gs_handle, SYN6288_SOUND_A);
@@ -630,6 +669,113 @@ uint8_t syn6288_synthesis_test(void)
         }
     }
     
+    /* sequence test */
+    syn6288_interface_debug_print("syn6288: sequence test.\n");
+    res = syn6288_get_stats(&gs_handle, &stats);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: get stats failed.\n");
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    frames = stats.opcode[SYN6288_OPCODE_SYNTHESIS].frames;
+    item[0].type = SYN6288_SEQUENCE_TYPE_SOUND;
+    item[0].index = SYN6288_SOUND_A;
+    item[0].text = NULL;
+    item[0].len = 0;
+    item[1].type = SYN6288_SEQUENCE_TYPE_TEXT;
+    item[1].index = 0;
+    item[1].text = (char *)gb2312_text;
+    item[1].len = 0;
+    item[2].type = SYN6288_SEQUENCE_TYPE_MESSAGE;
+    item[2].index = SYN6288_MESSAGE_A;
+    item[2].text = NULL;
+    item[2].len = 0;
+    item[3].type = SYN6288_SEQUENCE_TYPE_RING;
+    item[3].index = SYN6288_RING_A;
+    item[3].text = NULL;
+    item[3].len = 0;
+    res = syn6288_synthesis_sequence(&gs_handle, item, 4);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: synthesis sequence failed.\n");
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = syn6288_get_stats(&gs_handle, &stats);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: get stats failed.\n");
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    if ((stats.opcode[SYN6288_OPCODE_SYNTHESIS].frames - frames) != 1)
+    {
+        syn6288_interface_debug_print("syn6288: sequence is not packed into one frame.\n");
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    status = SYN6288_STATUS_BUSY;
+    while (status == SYN6288_STATUS_BUSY)
+    {
+        syn6288_interface_delay_ms(500);
+        res = syn6288_get_status(&gs_handle, &status);
+        if (res != 0)
+        {
+            syn6288_interface_debug_print("syn6288: get status failed.\n");
+            (void)syn6288_deinit(&gs_handle);
+            
+            return 1;
+        }
+    }
+    syn6288_interface_debug_print("syn6288: sequence of %d items in 1 frame.\n", 4);
+    item[1].type = SYN6288_SEQUENCE_TYPE_SOUND;
+    item[1].index = 0xFF;
+    res = syn6288_synthesis_sequence(&gs_handle, item, 4);
+    if (res != 4)
+    {
+        syn6288_interface_debug_print("syn6288: invalid item is not rejected.\n");
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: invalid item is rejected.\n");
+    
+    /* stats test */
+    syn6288_interface_debug_print("syn6288: stats test.\n");
+    res = syn6288_get_stats(&gs_handle, &stats);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: get stats failed.\n");
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    syn6288_interface_debug_print("syn6288: synthesis frames %d, bytes %d.\n",
+                                  stats.opcode[SYN6288_OPCODE_SYNTHESIS].frames, stats.opcode[SYN6288_OPCODE_SYNTHESIS].bytes);
+    syn6288_interface_debug_print("syn6288: status frames %d, retries %d.\n",
+                                  stats.opcode[SYN6288_OPCODE_STATUS].frames, stats.opcode[SYN6288_OPCODE_STATUS].retries);
+    syn6288_interface_debug_print("syn6288: time to first audio %d ms.\n", stats.first_audio_last);
+    for (i = 0; i < SYN6288_STATS_BUCKET_NUM; i++)
+    {
+        if (stats.playback[i] != 0)
+        {
+            syn6288_interface_debug_print("syn6288: playback below %d ms: %d.\n", 1 << i, stats.playback[i]);
+        }
+    }
+    res = syn6288_reset_stats(&gs_handle);
+    if (res != 0)
+    {
+        syn6288_interface_debug_print("syn6288: reset stats failed.\n");
+        (void)syn6288_deinit(&gs_handle);
+        
+        return 1;
+    }
+    
     /* finish synthesis test */
     syn6288_interface_debug_print("syn6288: finish synthesis test.\n");
     (void)syn6288_deinit(&gs_handle);